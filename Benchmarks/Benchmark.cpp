@@ -0,0 +1,138 @@
+#include "Benchmark.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <new>
+#include <sstream>
+#include <unordered_map>
+
+namespace
+{
+	/// Number of calls to operator new. The array versions call operator new by default
+	std::atomic<std::size_t> allocationCount{ 0 };
+}
+//--------------------------------------------------------------------------------------------------
+void* operator new(std::size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+	throw std::bad_alloc();
+}
+//--------------------------------------------------------------------------------------------------
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+//--------------------------------------------------------------------------------------------------
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+//--------------------------------------------------------------------------------------------------
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	std::vector<Benchmark>& BenchmarkRegistry::getBenchmarks()
+	{
+		static std::vector<Benchmark> benchmarks;
+		return benchmarks;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void BenchmarkRegistry::add(const std::string& name, std::function<std::size_t()> function)
+	{
+		getBenchmarks().push_back({ name, std::move(function) });
+	}
+	//--------------------------------------------------------------------------------------------------
+	std::vector<BenchmarkResult> BenchmarkRegistry::run(const std::string& filter, double minDuration)
+	{
+		using Clock = std::chrono::steady_clock;
+		std::vector<BenchmarkResult> results;
+		std::cout << std::left << std::setw(48) << "benchmark" << std::right << std::setw(14) << "time/call"
+			<< std::setw(14) << "throughput" << std::setw(14) << "allocs/call" << std::setw(10) << "calls" << std::endl;
+		for (const auto& benchmark : getBenchmarks()) {
+			if (benchmark.name.find(filter) == std::string::npos) continue;
+			// Warmup
+			benchmark.function();
+			std::size_t calls = 0;
+			std::size_t bytes = 0;
+			const std::size_t allocationsBefore = getAllocationCount();
+			const auto start = Clock::now();
+			double duration = 0.0;
+			do {
+				bytes += benchmark.function();
+				calls++;
+				duration = std::chrono::duration<double>(Clock::now() - start).count();
+			} while (duration < minDuration);
+			const std::size_t allocations = getAllocationCount() - allocationsBefore;
+			BenchmarkResult result{ benchmark.name, duration * 1.0e6 / static_cast<double>(calls),
+				static_cast<double>(bytes) / duration / 1.0e6, static_cast<double>(allocations) / static_cast<double>(calls) };
+			std::cout << std::left << std::setw(48) << result.name << std::right << std::fixed << std::setprecision(2)
+				<< std::setw(11) << result.microsecondsPerCall << " us" << std::setw(9) << result.megabytesPerSecond << " MB/s"
+				<< std::setw(14) << result.allocationsPerCall << std::setw(10) << calls << std::endl;
+			results.push_back(std::move(result));
+		}
+		return results;
+	}
+	//--------------------------------------------------------------------------------------------------
+	std::size_t BenchmarkRegistry::getAllocationCount()
+	{
+		return allocationCount.load(std::memory_order_relaxed);
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool BenchmarkRegistry::saveResults(const std::vector<BenchmarkResult>& results, const std::string& path)
+	{
+		std::ofstream file(path);
+		if (!file.is_open()) {
+			std::cout << "Could not open file " << path << std::endl;
+			return false;
+		}
+		// Names can contain spaces, so they are separated from the numbers by a tab
+		file << std::setprecision(9);
+		for (const auto& result : results) {
+			file << result.name << '\t' << result.microsecondsPerCall << '\t' << result.megabytesPerSecond << '\t' << result.allocationsPerCall << '\n';
+		}
+		return file.good();
+	}
+	//--------------------------------------------------------------------------------------------------
+	int BenchmarkRegistry::compareResults(const std::vector<BenchmarkResult>& results, const std::string& path, double tolerance)
+	{
+		std::ifstream file(path);
+		if (!file.is_open()) {
+			std::cout << "Could not open baseline " << path << std::endl;
+			return -1;
+		}
+		std::unordered_map<std::string, BenchmarkResult> baseline;
+		std::string line;
+		while (std::getline(file, line)) {
+			const std::size_t separator = line.find('\t');
+			if (separator == std::string::npos) continue;
+			BenchmarkResult result{ line.substr(0, separator), 0.0, 0.0, 0.0 };
+			std::istringstream numbers(line.substr(separator + 1));
+			if (numbers >> result.microsecondsPerCall >> result.megabytesPerSecond >> result.allocationsPerCall) {
+				baseline[result.name] = result;
+			}
+		}
+		int regressions = 0;
+		for (const auto& result : results) {
+			auto it = baseline.find(result.name);
+			if (it == baseline.end()) continue;
+			const double change = result.microsecondsPerCall / it->second.microsecondsPerCall - 1.0;
+			const bool slower = change > tolerance;
+			// Allocations are deterministic, so every additional allocation is a regression
+			const bool moreAllocations = result.allocationsPerCall > it->second.allocationsPerCall + 0.5;
+			if (!slower && !moreAllocations) continue;
+			regressions++;
+			std::cout << "REGRESSION " << result.name << std::fixed << std::setprecision(2) << ": "
+				<< it->second.microsecondsPerCall << " us -> " << result.microsecondsPerCall << " us ("
+				<< std::showpos << change * 100.0 << std::noshowpos << "%), " << it->second.allocationsPerCall
+				<< " -> " << result.allocationsPerCall << " allocs/call" << std::endl;
+		}
+		std::cout << regressions << " regression(s) compared to " << path << std::endl;
+		return regressions;
+	}
+	//--------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// A single benchmark. The function is called repeatedly and returns the number of bytes it
+	/// processed in this call, which is used for computing the throughput
+	struct Benchmark
+	{
+		std::string name;
+		std::function<std::size_t()> function;
+	};
+	//--------------------------------------------------------------------------------------------------
+	/// Result of running a single benchmark
+	struct BenchmarkResult
+	{
+		std::string name;
+		double microsecondsPerCall;
+		double megabytesPerSecond;
+		/// Number of calls to operator new per call of the benchmark function
+		double allocationsPerCall;
+	};
+	//--------------------------------------------------------------------------------------------------
+	/// Collection of all benchmarks. Benchmarks are registered by static BenchmarkRegistrar objects
+	/// in the source files of this project.
+	/// Note that this is a fully static class that cannot be constructed
+	class BenchmarkRegistry
+	{
+		/// Returns the vector of all benchmarks. A function local static is used, since the
+		/// registrars are constructed during static initialization of other translation units
+		static std::vector<Benchmark>& getBenchmarks();
+	public:
+		/// Deleted constructor: this is a static class!
+		BenchmarkRegistry() = delete;
+		/// Adds a benchmark
+		static void add(const std::string& name, std::function<std::size_t()> function);
+		/// Runs all benchmarks whose name contains the filter and prints and returns the results. Each
+		/// benchmark is called once for warming up, and then repeatedly for at least minDuration seconds
+		static std::vector<BenchmarkResult> run(const std::string& filter = "", double minDuration = 0.5);
+		/// Returns the number of calls to operator new since the program started
+		static std::size_t getAllocationCount();
+		/// Saves the given results in a file (one benchmark per line), such that they can be used as
+		/// baseline for compareResults(). Returns true on success
+		static bool saveResults(const std::vector<BenchmarkResult>& results, const std::string& path);
+		/// Compares the given results to the baseline stored in the given file and prints all benchmarks
+		/// that got slower by more than the given tolerance (relative), or that allocate more often.
+		/// Returns the number of regressions, or -1 if the baseline could not be loaded
+		static int compareResults(const std::vector<BenchmarkResult>& results, const std::string& path, double tolerance = 0.1);
+	};
+	//--------------------------------------------------------------------------------------------------
+	/// Helper struct for registering benchmarks during static initialization
+	struct BenchmarkRegistrar
+	{
+		BenchmarkRegistrar(const std::string& name, std::function<std::size_t()> function)
+		{
+			BenchmarkRegistry::add(name, std::move(function));
+		}
+	};
+	//--------------------------------------------------------------------------------------------------
+}
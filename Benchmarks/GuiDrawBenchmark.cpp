@@ -0,0 +1,114 @@
+#include "Benchmark.h"
+#include "Graphics/CommandLog.h"
+#include "Graphics/Renderer.h"
+#include "Gui/GuiManager.h"
+#include "Gui/GuiElements/GuiPanel.h"
+#include "Gui/GuiElements/GuiImage.h"
+#include "Gui/GuiElements/GuiTextBox.h"
+
+#include <iostream>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// Number of rows and columns of the grid of elements
+		constexpr int gridSize = 16;
+		/// Size of a single cell of the grid in pixels
+		constexpr int cellSize = 60;
+		//--------------------------------------------------------------------------------------------------
+		/// Helper function that registers the given element as a child of the grid panel and moves it
+		/// to the guiManager
+		template<typename GuiElementType>
+		void addToGrid(GuiManager& guiManager, GuiPanel& grid, GuiElementType&& guiElement)
+		{
+			grid.registerChild(guiElement);
+			guiManager.moveElement(std::move(guiElement));
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Creates a GuiManager with a panel containing a grid of panels, images and text boxes. If 
+		/// retainedDrawing is set to true, the panel is drawn in retained mode. If the engine could not be
+		/// initialized, nullptr is returned and the benchmarks are skipped.
+		/// The GuiManager is never deleted, since it would be destroyed after the engine was terminated
+		GuiManager* createGuiManager(bool retainedDrawing)
+		{
+			if (!GuiElement::defaultFont.isValid()) {
+				std::cout << "Could not load the default font, skipping gui draw benchmarks" << std::endl;
+				return nullptr;
+			}
+			GuiManager* guiManager = new GuiManager();
+			GuiPanel grid(Vec2i(0, 0), Vec2i(gridSize * cellSize, gridSize * cellSize),
+				GuiElement::ResizeMode::RESIZE_RANGE, Color4f(0.1f, 0.1f, 0.1f, 1.0f));
+			grid.setRetainedDrawing(retainedDrawing);
+			guiManager->registerElement(grid);
+			for (int y = 0; y < gridSize; ++y) {
+				for (int x = 0; x < gridSize; ++x) {
+					const Vec2i position(x * cellSize, y * cellSize);
+					switch ((x + y) % 3)
+					{
+					case 0:
+						addToGrid(*guiManager, grid, GuiPanel(position, Vec2i(cellSize - 4, cellSize - 4),
+							GuiElement::ResizeMode::RESIZE_RANGE, Color4f(0.2f, 0.3f, 0.4f, 1.0f),
+							Color4f(1.0f, 1.0f, 1.0f, 1.0f), (x % 2) * 8.0f, (y % 2) * 2.0f));
+						break;
+					case 1:
+					{
+						GuiImage image;
+						image.setPositionAndSize(position, Vec2i(cellSize - 4, cellSize - 4));
+						addToGrid(*guiManager, grid, std::move(image));
+						break;
+					}
+					default:
+						addToGrid(*guiManager, grid, GuiTextBox(position, Vec2i(cellSize - 4, cellSize - 4),
+							"Label " + std::to_string(x + y * gridSize)));
+						break;
+					}
+				}
+			}
+			guiManager->moveElement(std::move(grid));
+			guiManager->update(0.0);
+			return guiManager;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Prints the statistics of the last frame recorded by the CommandLog
+		void printFrameStatistics(const std::string& name)
+		{
+			const CommandLog::FrameStatistics& statistics = CommandLog::getLastFrameStatistics();
+			std::cout << name << ": " << statistics.drawCalls << " draw calls, " << statistics.instances << " instances, "
+				<< statistics.getBytesUploaded() << " bytes uploaded (" << statistics.bufferBytesUploaded << " buffers, "
+				<< statistics.textureBytesUploaded << " textures, " << statistics.uniformBytesUploaded << " uniforms), "
+				<< statistics.uniformUploads << " uniform uploads (" << statistics.uniformUploadsElided << " skipped), "
+				<< statistics.stateChanges << " state changes (" << statistics.stateChangesElided << " skipped)" << std::endl;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Draws the whole GUI of the given guiManager once. Nothing is sent to a GPU, the commands are only
+		/// recorded by the CommandLog. The statistics of the first (warmup) frame are printed. Returns the 
+		/// number of bytes uploaded in this frame
+		std::size_t drawFrame(GuiManager* guiManager, const std::string& name, bool& printed)
+		{
+			if (!guiManager) return 0;
+			guiManager->draw();
+			Renderer::swapBuffers();
+			if (!printed) {
+				printFrameStatistics(name);
+				printed = true;
+			}
+			return CommandLog::getLastFrameStatistics().getBytesUploaded();
+		}
+		//--------------------------------------------------------------------------------------------------
+		const BenchmarkRegistrar guiDrawBenchmark("GuiManager draw/grid", []() -> std::size_t {
+			static GuiManager* guiManager = createGuiManager(false);
+			static bool printed = false;
+			return drawFrame(guiManager, "GuiManager draw/grid", printed);
+		});
+		//--------------------------------------------------------------------------------------------------
+		/// Same grid, but drawn in retained mode: after the first frame only the cached texture is drawn
+		const BenchmarkRegistrar guiDrawRetainedBenchmark("GuiManager draw/grid retained", []() -> std::size_t {
+			static GuiManager* guiManager = createGuiManager(true);
+			static bool printed = false;
+			return drawFrame(guiManager, "GuiManager draw/grid retained", printed);
+		});
+		//--------------------------------------------------------------------------------------------------
+	}
+}
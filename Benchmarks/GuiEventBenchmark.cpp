@@ -0,0 +1,131 @@
+#include "Benchmark.h"
+#include "Gui/GuiManager.h"
+#include "Gui/GuiEventTable.h"
+#include "Gui/GuiElements/GuiPanel.h"
+
+#include <iostream>
+#include <unordered_set>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// Number of rows and columns of the grid of panels
+		constexpr int gridSize = 128;
+		/// Size of a single cell of the grid in pixels
+		constexpr int cellSize = 12;
+		/// Number of elements subscribed to the update event
+		constexpr int subscriberCount = 32768;
+		//--------------------------------------------------------------------------------------------------
+		/// Element that signs up for the update event
+		class UpdateSubscriber : public GuiElement
+		{
+		protected:
+			void onRegister() override { signUpEvent(CallbackType::UPDATE); }
+		};
+		//--------------------------------------------------------------------------------------------------
+		/// Creates a GuiManager with a panel containing a large grid of small panels. If the engine could 
+		/// not be initialized, nullptr is returned and the benchmarks are skipped.
+		/// The GuiManager is never deleted, since it would be destroyed after the engine was terminated
+		GuiManager* createGuiManager()
+		{
+			if (!GuiElement::defaultFont.isValid()) {
+				std::cout << "Could not load the default font, skipping gui event benchmarks" << std::endl;
+				return nullptr;
+			}
+			GuiManager* guiManager = new GuiManager();
+			GuiPanel grid(Vec2i(0, 0), Vec2i(gridSize * cellSize, gridSize * cellSize),
+				GuiElement::ResizeMode::RESIZE_RANGE, Color4f(0.1f, 0.1f, 0.1f, 1.0f));
+			guiManager->registerElement(grid);
+			for (int y = 0; y < gridSize; ++y) {
+				for (int x = 0; x < gridSize; ++x) {
+					GuiPanel panel(Vec2i(x * cellSize, y * cellSize), Vec2i(cellSize - 2, cellSize - 2),
+						GuiElement::ResizeMode::RESIZE_RANGE, Color4f(0.2f, 0.3f, 0.4f, 1.0f));
+					grid.registerChild(panel);
+					guiManager->moveElement(std::move(panel));
+				}
+			}
+			guiManager->moveElement(std::move(grid));
+			guiManager->update(0.0);
+			return guiManager;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Creates a GuiManager with subscriberCount elements that are subscribed to the update event
+		GuiManager* createSubscriberGuiManager()
+		{
+			if (!GuiElement::defaultFont.isValid()) {
+				std::cout << "Could not load the default font, skipping gui event benchmarks" << std::endl;
+				return nullptr;
+			}
+			GuiManager* guiManager = new GuiManager();
+			for (int i = 0; i < subscriberCount; ++i) {
+				UpdateSubscriber element;
+				guiManager->registerElement(element);
+				guiManager->moveElement(std::move(element));
+			}
+			guiManager->update(0.0);
+			return guiManager;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Moves the mouse across the grid. Every call hit tests the whole GUI for finding the element 
+		/// below the cursor
+		const BenchmarkRegistrar guiMouseMotionBenchmark("GuiManager mouse motion/grid", []() -> std::size_t {
+			static GuiManager* guiManager = createGuiManager();
+			static unsigned int step = 0;
+			if (!guiManager) return 0;
+			for (unsigned int i = 0; i < 64; ++i, ++step) {
+				const double x = static_cast<double>((step * 37) % (gridSize * cellSize));
+				const double y = static_cast<double>((step * 101) % (gridSize * cellSize));
+				guiManager->callbackMouseMotion(Vec2d(x, y));
+			}
+			return 0;
+		});
+		//--------------------------------------------------------------------------------------------------
+		/// Dispatches the update event to all subscribers
+		const BenchmarkRegistrar guiUpdateDispatchBenchmark("GuiManager update/subscribers", []() -> std::size_t {
+			static GuiManager* guiManager = createSubscriberGuiManager();
+			if (!guiManager) return 0;
+			guiManager->update(0.0);
+			return subscriberCount * sizeof(GuiID);
+		});
+		//--------------------------------------------------------------------------------------------------
+		/// Iterates an event table with subscriberCount entries and resubscribes every 16th entry, such
+		/// that the table is changed between iterations
+		const BenchmarkRegistrar guiEventTableBenchmark("GuiEventTable iterate/subscribers", []() -> std::size_t {
+			static GuiEventTable table = []() {
+				GuiEventTable table;
+				for (GuiID guiID = 1; guiID <= subscriberCount; ++guiID) table.insert(guiID);
+				return table;
+			}();
+			static GuiID nextResubscribed = 1;
+			std::size_t sum = 0;
+			table.forEach([&sum](GuiID guiID) { sum += static_cast<std::size_t>(guiID); });
+			for (int i = 0; i < subscriberCount / 16; ++i) {
+				table.erase(nextResubscribed);
+				table.insert(nextResubscribed);
+				nextResubscribed = nextResubscribed % subscriberCount + 1;
+			}
+			return sum > 0 ? subscriberCount * sizeof(GuiID) : 0;
+		});
+		//--------------------------------------------------------------------------------------------------
+		/// Same as above with a std::unordered_set, which was used for the event sets before
+		const BenchmarkRegistrar guiEventSetBenchmark("GuiEventTable iterate/subscribers unordered_set", []() -> std::size_t {
+			static std::unordered_set<GuiID> set = []() {
+				std::unordered_set<GuiID> set;
+				for (GuiID guiID = 1; guiID <= subscriberCount; ++guiID) set.insert(guiID);
+				return set;
+			}();
+			static GuiID nextResubscribed = 1;
+			std::size_t sum = 0;
+			for (GuiID guiID : set) sum += static_cast<std::size_t>(guiID);
+			for (int i = 0; i < subscriberCount / 16; ++i) {
+				set.erase(nextResubscribed);
+				set.insert(nextResubscribed);
+				nextResubscribed = nextResubscribed % subscriberCount + 1;
+			}
+			return sum > 0 ? subscriberCount * sizeof(GuiID) : 0;
+		});
+		//--------------------------------------------------------------------------------------------------
+	}
+}
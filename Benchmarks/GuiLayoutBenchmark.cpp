@@ -0,0 +1,159 @@
+#include "Benchmark.h"
+#include "Gui/GuiManager.h"
+#include "Gui/GuiElements/GuiPanel.h"
+#include "Gui/Layouts/VerticalListLayout.h"
+#include "Gui/Layouts/HorizontalListLayout.h"
+#include "Gui/Layouts/VirtualListLayout.h"
+
+#include <iostream>
+#include <memory>
+#include <functional>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// Number of rows of the vertical list layout
+		constexpr int rowCount = 256;
+		/// Number of panels in each row
+		constexpr int columnCount = 8;
+		//--------------------------------------------------------------------------------------------------
+		/// Creates a GuiManager with a panel containing a vertical list layout of rowCount horizontal 
+		/// list layouts, each containing columnCount panels. The panel is stored in container. If the
+		/// engine could not be initialized, nullptr is returned and the benchmarks are skipped.
+		/// The GuiManager is never deleted, since it would be destroyed after the engine was terminated
+		GuiManager* createGuiManager(GuiID& container)
+		{
+			if (!GuiElement::defaultFont.isValid()) {
+				std::cout << "Could not load the default font, skipping gui layout benchmarks" << std::endl;
+				return nullptr;
+			}
+			GuiManager* guiManager = new GuiManager();
+			GuiPanel panel(Vec2i(0, 0), Vec2i(1000, rowCount * 20), GuiElement::ResizeMode::RESIZE_RANGE);
+			guiManager->registerElement(panel);
+			GuiVerticalListLayout column;
+			panel.registerChild(column);
+			for (int y = 0; y < rowCount; ++y) {
+				GuiHorizontalListLayout row;
+				row.setResizeMode(GuiElement::ResizeMode::RESIZE_RANGE);
+				row.setPreferredHeight(16);
+				column.registerChild(row);
+				for (int x = 0; x < columnCount; ++x) {
+					GuiPanel cell(Vec2i(0, 0), Vec2i(40, 16), GuiElement::ResizeMode::RESIZE_RANGE);
+					cell.setPreferredSize(Vec2i(40 + x, 16));
+					row.registerChild(cell);
+					guiManager->moveElement(std::move(cell));
+				}
+				guiManager->moveElement(std::move(row));
+			}
+			guiManager->moveElement(std::move(column));
+			container = panel.getGuiID();
+			guiManager->moveElement(std::move(panel));
+			guiManager->update(0.0);
+			return guiManager;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// State of a resize benchmark. The GuiManager is created on the first call, after the engine
+		/// was initialized
+		struct ResizeBenchmark
+		{
+			std::string name;
+			bool parallelLayouts = false;
+			bool initialized = false;
+			GuiManager* guiManager = nullptr;
+			GuiID container = -1;
+			int step = 0;
+			/// Changes the width of the outer panel and enforces all layouts of the subtree
+			std::size_t operator()()
+			{
+				if (!initialized) {
+					guiManager = createGuiManager(container);
+					if (guiManager) guiManager->setParallelLayouts(parallelLayouts);
+					initialized = true;
+				}
+				if (!guiManager) return 0;
+				GuiElement* panel = guiManager->getGuiElement(container);
+				if (!panel) return 0;
+				panel->setWidth(1000 + (step++ % 2) * 100);
+				guiManager->update(0.0);
+				if (step == 1) {
+					const GuiManager::LayoutStatistics& statistics = guiManager->getLayoutStatistics();
+					std::cout << name << ": " << statistics.layoutsEnforced << " layouts enforced, "
+						<< statistics.layoutsSkipped << " skipped, " << statistics.layoutsPrecomputed << " precomputed" << std::endl;
+				}
+				return 0;
+			}
+		};
+		//--------------------------------------------------------------------------------------------------
+		/// Returns a resize benchmark with the given name
+		std::function<std::size_t()> createResizeBenchmark(const std::string& name, bool parallelLayouts)
+		{
+			auto benchmark = std::make_shared<ResizeBenchmark>();
+			benchmark->name = name;
+			benchmark->parallelLayouts = parallelLayouts;
+			return [benchmark]() -> std::size_t { return (*benchmark)(); };
+		}
+		//--------------------------------------------------------------------------------------------------
+		const BenchmarkRegistrar guiLayoutResizeBenchmark("GuiManager layout/resize", createResizeBenchmark("GuiManager layout/resize", false));
+		const BenchmarkRegistrar guiLayoutResizeParallelBenchmark("GuiManager layout/resize parallel", createResizeBenchmark("GuiManager layout/resize parallel", true));
+		//--------------------------------------------------------------------------------------------------
+		/// State of a virtual list scroll benchmark. The GuiManager is created on the first call
+		struct VirtualListScrollBenchmark
+		{
+			std::size_t itemCount = 0;
+			bool initialized = false;
+			GuiManager* guiManager = nullptr;
+			GuiID list = -1;
+			/// Creates a panel containing a virtual list with itemCount items of varying height
+			void initialize()
+			{
+				initialized = true;
+				if (!GuiElement::defaultFont.isValid()) {
+					std::cout << "Could not load the default font, skipping virtual list benchmarks" << std::endl;
+					return;
+				}
+				guiManager = new GuiManager();
+				GuiPanel panel(Vec2i(0, 0), Vec2i(400, 600), GuiElement::ResizeMode::RESIZE_RANGE);
+				guiManager->registerElement(panel);
+				GuiVirtualListLayout virtualList(
+					[]() { return std::make_unique<GuiPanel>(); },
+					[](GuiElement& row, std::size_t itemIndex) {
+						static_cast<GuiPanel&>(row).setBackgroundColor(Color4f(static_cast<float>(itemIndex % 256) / 255.0f, 1.0f));
+					}, itemCount, 20);
+				for (std::size_t i = 0; i < itemCount; i += 7) virtualList.setItemHeight(i, 40);
+				panel.registerChild(virtualList);
+				list = virtualList.getGuiID();
+				guiManager->moveElement(std::move(virtualList));
+				guiManager->moveElement(std::move(panel));
+				guiManager->update(0.0);
+			}
+			/// Scrolls the list by a bit more than one page and enforces all layouts
+			std::size_t operator()()
+			{
+				if (!initialized) initialize();
+				if (!guiManager) return 0;
+				GuiVirtualListLayout* virtualList = static_cast<GuiVirtualListLayout*>(guiManager->getGuiElement(list));
+				if (!virtualList) return 0;
+				const int lastScrollOffset = virtualList->getScrollOffset();
+				virtualList->setScrollOffset(lastScrollOffset + 650);
+				// Start at the top again after reaching the end
+				if (virtualList->getScrollOffset() == lastScrollOffset) virtualList->setScrollOffset(0);
+				guiManager->update(0.0);
+				return virtualList->getRowCount();
+			}
+		};
+		//--------------------------------------------------------------------------------------------------
+		/// Returns a scroll benchmark for a virtual list with the given number of items
+		std::function<std::size_t()> createVirtualListScrollBenchmark(std::size_t itemCount)
+		{
+			auto benchmark = std::make_shared<VirtualListScrollBenchmark>();
+			benchmark->itemCount = itemCount;
+			return [benchmark]() -> std::size_t { return (*benchmark)(); };
+		}
+		//--------------------------------------------------------------------------------------------------
+		const BenchmarkRegistrar guiVirtualListScrollSmallBenchmark("GuiVirtualListLayout scroll/50 items", createVirtualListScrollBenchmark(50));
+		const BenchmarkRegistrar guiVirtualListScrollLargeBenchmark("GuiVirtualListLayout scroll/1M items", createVirtualListScrollBenchmark(1000000));
+		//--------------------------------------------------------------------------------------------------
+	}
+}
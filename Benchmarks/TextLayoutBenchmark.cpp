@@ -0,0 +1,181 @@
+#include "Benchmark.h"
+#include "Core/Engine.h"
+#include "AssetManager/FontManager.h"
+#include "Gui/Text/Text.h"
+#include "Gui/Text/TextLayoutCache.h"
+#include "Gui/Text/Unicode.h"
+
+#include <array>
+#include <iostream>
+#include <random>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// Path of the font used for all text layout benchmarks, relative to the resource directory
+		constexpr const char* fontPath = "fonts/Arial.ttf";
+		/// Parameters used for all texts
+		constexpr double fontSize = 16.0;
+		constexpr double textWidth = 600.0;
+		constexpr float cursorWidth = 1.0f;
+		//--------------------------------------------------------------------------------------------------
+		/// Returns the font used for the benchmarks. If the font can't be loaded (eg. because the engine
+		/// could not be initialized), nullptr is returned and the benchmarks are skipped.
+		/// The font is never deleted, since it would be destroyed after the engine was terminated
+		Font* getFont()
+		{
+			static Font* font = []() -> Font* {
+				if (!Engine::getFullPath(fontPath).has_value()) {
+					std::cout << "Could not find font " << fontPath << ", skipping text layout benchmarks" << std::endl;
+					return nullptr;
+				}
+				// Glyphs are generated on the calling thread during the warmup call, such that only the
+				// layout is measured and not the placeholder glyphs of the asynchronous glyph generation
+				FontManager::setAsyncGlyphGeneration(false);
+				// Each call should lay out the text again, instead of returning a cached layout
+				TextLayoutCache::setCapacity(0);
+				Font* font = new Font(fontPath);
+				if (!font->isValid()) return nullptr;
+				return font;
+			}();
+			return font;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Common english words, used for prose and identifiers
+		const std::array<const char*, 32> words{ "the", "of", "and", "to", "in", "is", "was", "that", "for", "it",
+			"with", "as", "his", "on", "be", "at", "by", "this", "had", "not", "are", "but", "from", "or", "have",
+			"an", "they", "which", "one", "you", "were", "her" };
+		//--------------------------------------------------------------------------------------------------
+		/// Generates sentences of english words. If paragraphs is set to false, no newlines are inserted
+		std::string generateProse(std::size_t byteCount, bool paragraphs)
+		{
+			std::mt19937 random(42);
+			std::string text;
+			while (text.size() < byteCount) {
+				const unsigned int sentenceLength = 4 + random() % 12;
+				for (unsigned int i = 0; i < sentenceLength; ++i) {
+					std::string word = words[random() % words.size()];
+					if (i == 0) word[0] = static_cast<char>(word[0] - 'a' + 'A');
+					text += word;
+					text += i + 1 == sentenceLength ? ". " : (random() % 8 == 0 ? ", " : " ");
+				}
+				if (paragraphs && random() % 6 == 0) text.back() = '\n';
+			}
+			return text;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Generates C++ like source code with indentation and short lines
+		std::string generateCode(std::size_t byteCount)
+		{
+			std::mt19937 random(42);
+			auto identifier = [&]() {
+				std::string name = words[random() % words.size()];
+				std::string second = words[random() % words.size()];
+				second[0] = static_cast<char>(second[0] - 'a' + 'A');
+				return name + second;
+			};
+			std::string text;
+			while (text.size() < byteCount) {
+				text += "void " + identifier() + "(const int& " + identifier() + ")\n{\n";
+				const unsigned int statements = 2 + random() % 6;
+				for (unsigned int i = 0; i < statements; ++i) {
+					switch (random() % 3)
+					{
+					case 0: text += "\tif (" + identifier() + " < " + std::to_string(random() % 1000) + ") return;\n"; break;
+					case 1: text += "\tauto " + identifier() + " = " + identifier() + "(" + identifier() + ", " + identifier() + ");\n"; break;
+					default: text += "\t" + identifier() + " += " + std::to_string(random() % 100) + ";\n"; break;
+					}
+				}
+				text += "}\n";
+			}
+			return text;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Generates CJK text without spaces. A small range of characters is used, such that the warmup
+		/// does not need to generate thousands of glyphs
+		std::string generateCJK(std::size_t byteCount)
+		{
+			std::mt19937 random(42);
+			std::string text;
+			while (text.size() < byteCount) {
+				const unsigned int sentenceLength = 8 + random() % 24;
+				for (unsigned int i = 0; i < sentenceLength; ++i) {
+					appendUnicodeCharacter(text, 0x4E00 + random() % 256);
+				}
+				// Ideographic comma or full stop
+				appendUnicodeCharacter(text, random() % 3 == 0 ? 0x3002 : 0xFF0C);
+				if (random() % 8 == 0) text.push_back('\n');
+			}
+			return text;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// A text that is used as benchmark input
+		struct Corpus
+		{
+			std::string name;
+			std::string text;
+		};
+		//--------------------------------------------------------------------------------------------------
+		const std::vector<Corpus>& getCorpora()
+		{
+			static const std::vector<Corpus> corpora{
+				{ "prose", generateProse(16 * 1024, true) },
+				{ "code", generateCode(16 * 1024) },
+				{ "cjk", generateCJK(16 * 1024) },
+				{ "long line", generateProse(64 * 1024, false) },
+			};
+			return corpora;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Registers the layout benchmarks of all text classes for the given corpus and parse mode.
+		/// Each call constructs a text, which parses it and creates the model (recorded on the CPU)
+		struct TextLayoutBenchmarks
+		{
+			TextLayoutBenchmarks(std::size_t corpusIndex, const std::string& corpusName, StaticText::ParseMode parseMode, const std::string& parseModeName)
+			{
+				const std::string suffix = "/" + corpusName + "/" + parseModeName;
+				BenchmarkRegistry::add("StaticText layout" + suffix, [corpusIndex, parseMode]() -> std::size_t {
+					Font* font = getFont();
+					if (!font) return 0;
+					const std::string& text = getCorpora()[corpusIndex].text;
+					StaticText staticText(text, *font, fontSize, textWidth, 1.0, parseMode);
+					return text.size();
+				});
+				BenchmarkRegistry::add("DynamicText layout" + suffix, [corpusIndex, parseMode]() -> std::size_t {
+					Font* font = getFont();
+					if (!font) return 0;
+					const std::string& text = getCorpora()[corpusIndex].text;
+					DynamicText dynamicText(text, *font, fontSize, textWidth, 1.0, parseMode);
+					return text.size();
+				});
+				BenchmarkRegistry::add("EditableText layout" + suffix, [corpusIndex, parseMode]() -> std::size_t {
+					Font* font = getFont();
+					if (!font) return 0;
+					const std::string& text = getCorpora()[corpusIndex].text;
+					EditableText editableText(text, *font, fontSize, textWidth, cursorWidth, 1.0, parseMode);
+					return text.size();
+				});
+			}
+		};
+		//--------------------------------------------------------------------------------------------------
+		/// Registers the benchmarks for all parse modes of the given corpus
+		struct CorpusBenchmarks
+		{
+			TextLayoutBenchmarks wordByWord;
+			TextLayoutBenchmarks characters;
+			TextLayoutBenchmarks singleLine;
+			CorpusBenchmarks(std::size_t corpusIndex, const std::string& corpusName)
+				: wordByWord(corpusIndex, corpusName, StaticText::ParseMode::WORD_BY_WORD, "WORD_BY_WORD"),
+				characters(corpusIndex, corpusName, StaticText::ParseMode::CHARACTERS, "CHARACTERS"),
+				singleLine(corpusIndex, corpusName, StaticText::ParseMode::SINGLE_LINE, "SINGLE_LINE") {}
+		};
+		//--------------------------------------------------------------------------------------------------
+		const CorpusBenchmarks proseBenchmarks(0, "prose");
+		const CorpusBenchmarks codeBenchmarks(1, "code");
+		const CorpusBenchmarks cjkBenchmarks(2, "cjk");
+		const CorpusBenchmarks longLineBenchmarks(3, "long line");
+		//--------------------------------------------------------------------------------------------------
+	}
+}
@@ -0,0 +1,133 @@
+#include "Benchmark.h"
+#include "Gui/Text/Unicode.h"
+
+#include <random>
+#include <iostream>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// A text that is used as benchmark input
+		struct Corpus
+		{
+			std::string name;
+			std::string textUTF8;
+			std::vector<Unicode> codepoints;
+		};
+		//--------------------------------------------------------------------------------------------------
+		/// Range [first, last] of codepoints of a script
+		struct Script
+		{
+			Unicode first;
+			Unicode last;
+		};
+		//--------------------------------------------------------------------------------------------------
+		/// Generates approximately byteCount bytes of words from the given scripts, separated by spaces,
+		/// punctuation and newlines. Each word is written in a single, randomly chosen script
+		Corpus generateCorpus(const std::string& name, const std::vector<Script>& scripts, std::size_t byteCount)
+		{
+			std::mt19937 random(42);
+			Corpus corpus{ name, {}, {} };
+			std::size_t length = 0;
+			while (length < byteCount) {
+				const Script& script = scripts[random() % scripts.size()];
+				const unsigned int wordLength = 2 + random() % 8;
+				for (unsigned int i = 0; i < wordLength; ++i) {
+					corpus.codepoints.push_back(script.first + random() % (script.last - script.first + 1));
+					length += getLengthUTF8(corpus.codepoints.back());
+				}
+				const unsigned int separator = random() % 16;
+				if (separator == 0) corpus.codepoints.push_back('\n');
+				else if (separator == 1) corpus.codepoints.insert(corpus.codepoints.end(), { ',', ' ' });
+				else corpus.codepoints.push_back(' ');
+				length += separator == 1 ? 2 : 1;
+			}
+			encodeUTF8(corpus.codepoints.data(), corpus.codepoints.size(), corpus.textUTF8);
+			return corpus;
+		}
+		//--------------------------------------------------------------------------------------------------
+		const std::vector<Corpus>& getCorpora()
+		{
+			static const std::vector<Corpus> corpora = []() {
+				const Script latin{ 'a', 'z' };
+				const Script latinExtended{ 0x00E0, 0x00FF };
+				const Script greek{ 0x03B1, 0x03C9 };
+				const Script cyrillic{ 0x0430, 0x044F };
+				const Script cjk{ 0x4E00, 0x9FFF };
+				const Script hiragana{ 0x3041, 0x3096 };
+				const Script emoji{ 0x1F600, 0x1F64F };
+				const std::size_t size = 1 << 20;
+				std::vector<Corpus> corpora;
+				corpora.push_back(generateCorpus("ascii", { latin }, size));
+				corpora.push_back(generateCorpus("european", { latin, latinExtended, greek, cyrillic }, size));
+				corpora.push_back(generateCorpus("cjk", { cjk, hiragana }, size));
+				corpora.push_back(generateCorpus("mixed", { latin, latin, latin, cyrillic, cjk, emoji }, size));
+				// Check that the bulk functions agree with the per codepoint functions
+				for (const auto& corpus : corpora) {
+					std::vector<Unicode> decoded;
+					const bool valid = decodeUTF8(corpus.textUTF8, decoded) == corpus.textUTF8.size() && isValidUTF8(corpus.textUTF8);
+					std::string encoded;
+					for (const Unicode& codepoint : corpus.codepoints) appendUnicodeCharacter(encoded, codepoint);
+					if (!valid || decoded != corpus.codepoints || encoded != corpus.textUTF8) {
+						std::cout << "UTF8 round trip failed for corpus " << corpus.name << std::endl;
+					}
+				}
+				return corpora;
+			}();
+			return corpora;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Registers all UTF8 benchmarks for the given corpus
+		struct UnicodeBenchmarks
+		{
+			UnicodeBenchmarks(std::size_t corpusIndex, const std::string& corpusName)
+			{
+				BenchmarkRegistry::add("UTF8 decode per codepoint/" + corpusName, [corpusIndex]() {
+					static std::vector<Unicode> codepoints;
+					const std::string& text = getCorpora()[corpusIndex].textUTF8;
+					codepoints.clear();
+					unsigned int position = 0;
+					while (position < text.size()) {
+						std::optional<Unicode> codepoint = getNextCodepointUTF8(text, position);
+						if (!codepoint.has_value()) break;
+						codepoints.push_back(codepoint.value());
+					}
+					return text.size();
+				});
+				BenchmarkRegistry::add("UTF8 decode bulk/" + corpusName, [corpusIndex]() {
+					static std::vector<Unicode> codepoints;
+					const std::string& text = getCorpora()[corpusIndex].textUTF8;
+					codepoints.clear();
+					decodeUTF8(text, codepoints);
+					return text.size();
+				});
+				BenchmarkRegistry::add("UTF8 validate/" + corpusName, [corpusIndex]() {
+					const std::string& text = getCorpora()[corpusIndex].textUTF8;
+					return isValidUTF8(text) ? text.size() : 0;
+				});
+				BenchmarkRegistry::add("UTF8 encode per codepoint/" + corpusName, [corpusIndex]() {
+					static std::string text;
+					const std::vector<Unicode>& codepoints = getCorpora()[corpusIndex].codepoints;
+					text.clear();
+					for (const Unicode& codepoint : codepoints) appendUnicodeCharacter(text, codepoint);
+					return text.size();
+				});
+				BenchmarkRegistry::add("UTF8 encode bulk/" + corpusName, [corpusIndex]() {
+					static std::string text;
+					const std::vector<Unicode>& codepoints = getCorpora()[corpusIndex].codepoints;
+					text.clear();
+					encodeUTF8(codepoints.data(), codepoints.size(), text);
+					return text.size();
+				});
+			}
+		};
+		//--------------------------------------------------------------------------------------------------
+		const UnicodeBenchmarks asciiBenchmarks(0, "ascii");
+		const UnicodeBenchmarks europeanBenchmarks(1, "european");
+		const UnicodeBenchmarks cjkBenchmarks(2, "cjk");
+		const UnicodeBenchmarks mixedBenchmarks(3, "mixed");
+		//--------------------------------------------------------------------------------------------------
+	}
+}
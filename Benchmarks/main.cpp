@@ -0,0 +1,35 @@
+#include "Benchmark.h"
+#include "Core/Engine.h"
+
+#include <iostream>
+
+/// Runs all benchmarks. Usage:
+///		Benchmarks.exe [filter] [--save <file>] [--compare <file>] [--resources <path>]
+/// Only benchmarks whose name contains the filter are run, eg. "Benchmarks.exe UTF8".
+/// --save stores the results as baseline, --compare prints all benchmarks that got slower (or allocate
+/// more) than in the given baseline and returns a non-zero exit code if there are any.
+/// The engine is started in headless mode, so no window or GPU is required
+int main(int argc, char** argv)
+{
+	std::string filter;
+	std::string savePath;
+	std::string comparePath;
+	std::string resourcePath;
+	for (int i = 1; i < argc; ++i) {
+		const std::string argument = argv[i];
+		if (argument == "--save" && i + 1 < argc) savePath = argv[++i];
+		else if (argument == "--compare" && i + 1 < argc) comparePath = argv[++i];
+		else if (argument == "--resources" && i + 1 < argc) resourcePath = argv[++i];
+		else filter = argument;
+	}
+	const bool initialized = SnackerEngine::Engine::initializeHeadless(resourcePath);
+	if (!initialized) {
+		std::cout << "Could not initialize the engine, benchmarks that need resources will be skipped" << std::endl;
+	}
+	const auto results = SnackerEngine::BenchmarkRegistry::run(filter);
+	int exitCode = 0;
+	if (!savePath.empty() && !SnackerEngine::BenchmarkRegistry::saveResults(results, savePath)) exitCode = 1;
+	if (!comparePath.empty() && SnackerEngine::BenchmarkRegistry::compareResults(results, comparePath) != 0) exitCode = 1;
+	if (initialized) SnackerEngine::Engine::terminate();
+	return exitCode;
+}
@@ -0,0 +1,271 @@
+#include "Math/BoundingVolumes.h"
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SNACKER_ENGINE_CULLING_SSE
+#include <emmintrin.h>
+#endif
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	static_assert(sizeof(BoundingSphere) == 4 * sizeof(float), "BoundingSphere has to be tightly packed for batch culling");
+	//------------------------------------------------------------------------------------------------------
+	AABB AABB::Empty()
+	{
+		const float max = std::numeric_limits<float>::max();
+		return AABB{ Vec3f(max), Vec3f(-max) };
+	}
+	//------------------------------------------------------------------------------------------------------
+	void AABB::extend(const Vec3f& point)
+	{
+		minimum = Vec3f(std::min(minimum.x, point.x), std::min(minimum.y, point.y), std::min(minimum.z, point.z));
+		maximum = Vec3f(std::max(maximum.x, point.x), std::max(maximum.y, point.y), std::max(maximum.z, point.z));
+	}
+	//------------------------------------------------------------------------------------------------------
+	void AABB::extend(const AABB& other)
+	{
+		if (!other.isValid()) return;
+		extend(other.minimum);
+		extend(other.maximum);
+	}
+	//------------------------------------------------------------------------------------------------------
+	AABB AABB::transform(const Mat4f& matrix) const
+	{
+		if (!isValid()) return *this;
+		// Arvo's method: transform the center and project the extents onto the new axes
+		const Vec3f center = getCenter();
+		const Vec3f extents = getExtents();
+		Vec3f newCenter, newExtents;
+		for (unsigned int row = 0; row < 3; ++row) {
+			newCenter[row] = matrix.data[row * 4 + 3];
+			newExtents[row] = 0.0f;
+			for (unsigned int column = 0; column < 3; ++column) {
+				newCenter[row] += matrix.data[row * 4 + column] * center[column];
+				newExtents[row] += std::abs(matrix.data[row * 4 + column]) * extents[column];
+			}
+		}
+		return AABB{ newCenter - newExtents, newCenter + newExtents };
+	}
+	//------------------------------------------------------------------------------------------------------
+	BoundingSphere BoundingSphere::transform(const Mat4f& matrix) const
+	{
+		Vec3f newCenter;
+		float maxScaleSquared = 0.0f;
+		for (unsigned int row = 0; row < 3; ++row) {
+			newCenter[row] = matrix.data[row * 4 + 3];
+			for (unsigned int column = 0; column < 3; ++column) {
+				newCenter[row] += matrix.data[row * 4 + column] * center[column];
+			}
+		}
+		for (unsigned int column = 0; column < 3; ++column) {
+			const Vec3f axis(matrix.data[column], matrix.data[4 + column], matrix.data[8 + column]);
+			maxScaleSquared = std::max(maxScaleSquared, axis.squaredMagnitude());
+		}
+		return BoundingSphere{ newCenter, radius * std::sqrt(maxScaleSquared) };
+	}
+	//------------------------------------------------------------------------------------------------------
+	AABB computeAABB(const std::vector<Vec3f>& positions)
+	{
+		AABB result = AABB::Empty();
+		for (const auto& position : positions) result.extend(position);
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+	BoundingSphere computeBoundingSphere(const std::vector<Vec3f>& positions)
+	{
+		if (positions.empty()) return BoundingSphere{};
+		// Find a point far away from an arbitrary point, and a point far away from that point
+		const auto findFarthest = [&positions](const Vec3f& from) {
+			std::size_t farthest = 0;
+			float maxDistanceSquared = -1.0f;
+			for (std::size_t i = 0; i < positions.size(); ++i) {
+				const float distanceSquared = (positions[i] - from).squaredMagnitude();
+				if (distanceSquared > maxDistanceSquared) {
+					maxDistanceSquared = distanceSquared;
+					farthest = i;
+				}
+			}
+			return positions[farthest];
+		};
+		const Vec3f a = findFarthest(positions[0]);
+		const Vec3f b = findFarthest(a);
+		BoundingSphere sphere{ (a + b) * 0.5f, (b - a).magnitude() * 0.5f };
+		// Grow the sphere to include all points
+		for (const auto& position : positions) {
+			const float distance = (position - sphere.center).magnitude();
+			if (distance > sphere.radius) {
+				const float newRadius = (sphere.radius + distance) * 0.5f;
+				sphere.center += (position - sphere.center) * ((newRadius - sphere.radius) / distance);
+				sphere.radius = newRadius;
+			}
+		}
+		return sphere;
+	}
+	//------------------------------------------------------------------------------------------------------
+	BoundingSphere computeBoundingSphere(const AABB& box)
+	{
+		if (!box.isValid()) return BoundingSphere{};
+		return BoundingSphere{ box.getCenter(), box.getExtents().magnitude() };
+	}
+	//------------------------------------------------------------------------------------------------------
+	Frustum Frustum::FromViewProjection(const Mat4f& viewProjection)
+	{
+		// The matrix is row major and multiplies column vectors. A point is inside the frustum if its clip coordinates
+		// satisfy -w <= x, y, z <= w, i.e. (row3 +- row_i) * p >= 0
+		const auto row = [&viewProjection](const unsigned int& i) {
+			return Vec4f(viewProjection.data[i * 4], viewProjection.data[i * 4 + 1], viewProjection.data[i * 4 + 2], viewProjection.data[i * 4 + 3]);
+		};
+		const Vec4f r0 = row(0), r1 = row(1), r2 = row(2), r3 = row(3);
+		Frustum frustum;
+		frustum.planes[LEFT] = r3 + r0;
+		frustum.planes[RIGHT] = r3 - r0;
+		frustum.planes[BOTTOM] = r3 + r1;
+		frustum.planes[TOP] = r3 - r1;
+		frustum.planes[NEAR_PLANE] = r3 + r2;
+		frustum.planes[FAR_PLANE] = r3 - r2;
+		for (auto& plane : frustum.planes) {
+			const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+			if (length > 0.0f) plane = plane / length;
+		}
+		return frustum;
+	}
+	//------------------------------------------------------------------------------------------------------
+	bool Frustum::intersects(const BoundingSphere& sphere) const
+	{
+		for (const auto& plane : planes) {
+			if (plane.x * sphere.center.x + plane.y * sphere.center.y + plane.z * sphere.center.z + plane.w < -sphere.radius) return false;
+		}
+		return true;
+	}
+	//------------------------------------------------------------------------------------------------------
+	bool Frustum::intersects(const AABB& box) const
+	{
+		const Vec3f center = box.getCenter();
+		const Vec3f extents = box.getExtents();
+		for (const auto& plane : planes) {
+			// Signed distance of the corner of the box that lies farthest in the direction of the plane normal
+			const float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w
+				+ std::abs(plane.x) * extents.x + std::abs(plane.y) * extents.y + std::abs(plane.z) * extents.z;
+			if (distance < 0.0f) return false;
+		}
+		return true;
+	}
+	//------------------------------------------------------------------------------------------------------
+	std::size_t cullBoundingSpheres(const Frustum& frustum, const BoundingSphere* spheres, const std::size_t& count, unsigned char* visible)
+	{
+		std::size_t visibleCount = 0;
+		std::size_t i = 0;
+#ifdef SNACKER_ENGINE_CULLING_SSE
+		__m128 planeX[6], planeY[6], planeZ[6], planeW[6];
+		for (unsigned int p = 0; p < 6; ++p) {
+			planeX[p] = _mm_set1_ps(frustum.planes[p].x);
+			planeY[p] = _mm_set1_ps(frustum.planes[p].y);
+			planeZ[p] = _mm_set1_ps(frustum.planes[p].z);
+			planeW[p] = _mm_set1_ps(frustum.planes[p].w);
+		}
+		const __m128 zero = _mm_setzero_ps();
+		for (; i + 4 <= count; i += 4) {
+			// Load four spheres and transpose them, such that each register stores one component of all spheres
+			const float* data = reinterpret_cast<const float*>(spheres + i);
+			__m128 x = _mm_loadu_ps(data);
+			__m128 y = _mm_loadu_ps(data + 4);
+			__m128 z = _mm_loadu_ps(data + 8);
+			__m128 radius = _mm_loadu_ps(data + 12);
+			_MM_TRANSPOSE4_PS(x, y, z, radius);
+			const __m128 negativeRadius = _mm_sub_ps(zero, radius);
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (unsigned int p = 0; p < 6; ++p) {
+				__m128 distance = _mm_add_ps(_mm_mul_ps(planeX[p], x), planeW[p]);
+				distance = _mm_add_ps(distance, _mm_mul_ps(planeY[p], y));
+				distance = _mm_add_ps(distance, _mm_mul_ps(planeZ[p], z));
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negativeRadius));
+			}
+			const int mask = _mm_movemask_ps(inside);
+			for (unsigned int j = 0; j < 4; ++j) {
+				visible[i + j] = static_cast<unsigned char>((mask >> j) & 1);
+				visibleCount += visible[i + j];
+			}
+		}
+#endif // SNACKER_ENGINE_CULLING_SSE
+		for (; i < count; ++i) {
+			visible[i] = frustum.intersects(spheres[i]) ? 1 : 0;
+			visibleCount += visible[i];
+		}
+		return visibleCount;
+	}
+	//------------------------------------------------------------------------------------------------------
+	std::size_t cullAABBs(const Frustum& frustum, const AABB* boxes, const std::size_t& count, unsigned char* visible)
+	{
+		std::size_t visibleCount = 0;
+		std::size_t i = 0;
+#ifdef SNACKER_ENGINE_CULLING_SSE
+		__m128 planeX[6], planeY[6], planeZ[6], planeW[6];
+		__m128 absPlaneX[6], absPlaneY[6], absPlaneZ[6];
+		for (unsigned int p = 0; p < 6; ++p) {
+			planeX[p] = _mm_set1_ps(frustum.planes[p].x);
+			planeY[p] = _mm_set1_ps(frustum.planes[p].y);
+			planeZ[p] = _mm_set1_ps(frustum.planes[p].z);
+			planeW[p] = _mm_set1_ps(frustum.planes[p].w);
+			absPlaneX[p] = _mm_set1_ps(std::abs(frustum.planes[p].x));
+			absPlaneY[p] = _mm_set1_ps(std::abs(frustum.planes[p].y));
+			absPlaneZ[p] = _mm_set1_ps(std::abs(frustum.planes[p].z));
+		}
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 zero = _mm_setzero_ps();
+		for (; i + 4 <= count; i += 4) {
+			// Boxes are 24 bytes large, gather their components into structure of arrays form first
+			alignas(16) float minimum[3][4], maximum[3][4];
+			for (unsigned int j = 0; j < 4; ++j) {
+				for (unsigned int axis = 0; axis < 3; ++axis) {
+					minimum[axis][j] = boxes[i + j].minimum[axis];
+					maximum[axis][j] = boxes[i + j].maximum[axis];
+				}
+			}
+			__m128 center[3], extents[3];
+			for (unsigned int axis = 0; axis < 3; ++axis) {
+				const __m128 min = _mm_load_ps(minimum[axis]);
+				const __m128 max = _mm_load_ps(maximum[axis]);
+				center[axis] = _mm_mul_ps(_mm_add_ps(min, max), half);
+				extents[axis] = _mm_mul_ps(_mm_sub_ps(max, min), half);
+			}
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (unsigned int p = 0; p < 6; ++p) {
+				__m128 distance = _mm_add_ps(_mm_mul_ps(planeX[p], center[0]), planeW[p]);
+				distance = _mm_add_ps(distance, _mm_mul_ps(planeY[p], center[1]));
+				distance = _mm_add_ps(distance, _mm_mul_ps(planeZ[p], center[2]));
+				distance = _mm_add_ps(distance, _mm_mul_ps(absPlaneX[p], extents[0]));
+				distance = _mm_add_ps(distance, _mm_mul_ps(absPlaneY[p], extents[1]));
+				distance = _mm_add_ps(distance, _mm_mul_ps(absPlaneZ[p], extents[2]));
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, zero));
+			}
+			const int mask = _mm_movemask_ps(inside);
+			for (unsigned int j = 0; j < 4; ++j) {
+				visible[i + j] = static_cast<unsigned char>((mask >> j) & 1);
+				visibleCount += visible[i + j];
+			}
+		}
+#endif // SNACKER_ENGINE_CULLING_SSE
+		for (; i < count; ++i) {
+			visible[i] = frustum.intersects(boxes[i]) ? 1 : 0;
+			visibleCount += visible[i];
+		}
+		return visibleCount;
+	}
+	//------------------------------------------------------------------------------------------------------
+	std::size_t cullBoundingSpheres(const Frustum& frustum, const std::vector<BoundingSphere>& spheres, std::vector<unsigned char>& visible)
+	{
+		visible.resize(spheres.size());
+		return cullBoundingSpheres(frustum, spheres.data(), spheres.size(), visible.data());
+	}
+	//------------------------------------------------------------------------------------------------------
+	std::size_t cullAABBs(const Frustum& frustum, const std::vector<AABB>& boxes, std::vector<unsigned char>& visible)
+	{
+		visible.resize(boxes.size());
+		return cullAABBs(frustum, boxes.data(), boxes.size(), visible.data());
+	}
+	//------------------------------------------------------------------------------------------------------
+}
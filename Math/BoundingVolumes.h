@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Math/Vec.h"
+#include "Math/Mat.h"
+
+#include <array>
+#include <vector>
+#include <cstddef>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	/// Axis aligned bounding box
+	struct AABB
+	{
+		Vec3f minimum{};
+		Vec3f maximum{};
+		/// Returns an empty box. Extending an empty box by a point results in a box containing only this point
+		static AABB Empty();
+		/// Returns true if this box contains at least one point
+		bool isValid() const { return minimum.x <= maximum.x && minimum.y <= maximum.y && minimum.z <= maximum.z; }
+		/// Returns the center of the box
+		Vec3f getCenter() const { return (minimum + maximum) * 0.5f; }
+		/// Returns half the size of the box along each axis
+		Vec3f getExtents() const { return (maximum - minimum) * 0.5f; }
+		/// Enlarges the box such that it contains the given point
+		void extend(const Vec3f& point);
+		/// Enlarges the box such that it contains the given box
+		void extend(const AABB& other);
+		/// Returns the smallest axis aligned box containing this box transformed by the given (affine) matrix
+		AABB transform(const Mat4f& matrix) const;
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// Bounding sphere. Has the same memory layout as a Vec4f (x, y, z, radius), which is used by cullBoundingSpheres()
+	struct BoundingSphere
+	{
+		Vec3f center{};
+		float radius{};
+		/// Returns a sphere containing this sphere transformed by the given (affine) matrix.
+		/// The radius is scaled by the largest scale of the matrix
+		BoundingSphere transform(const Mat4f& matrix) const;
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// Computes the axis aligned bounding box of the given points. Returns AABB::Empty() if there are no points
+	AABB computeAABB(const std::vector<Vec3f>& positions);
+	/// Computes a bounding sphere of the given points using Ritter's algorithm. The sphere is not minimal,
+	/// but usually a lot tighter than the sphere around the bounding box
+	BoundingSphere computeBoundingSphere(const std::vector<Vec3f>& positions);
+	/// Returns the sphere around the given box
+	BoundingSphere computeBoundingSphere(const AABB& box);
+	//------------------------------------------------------------------------------------------------------
+	/// View frustum given by six planes
+	struct Frustum
+	{
+		/// Order of the planes in the planes array
+		enum Plane { LEFT, RIGHT, BOTTOM, TOP, NEAR_PLANE, FAR_PLANE };
+		/// Planes (a, b, c, d) with normalized normal vector (a, b, c) pointing inside the frustum. 
+		/// A point p is inside the plane if a*p.x + b*p.y + c*p.z + d >= 0
+		std::array<Vec4f, 6> planes{};
+		/// Extracts the frustum planes from a combined view projection matrix (projection * view), such that
+		/// the planes are given in world space (Gribb and Hartmann). If a model view projection matrix is used instead,
+		/// the planes are given in model space.
+		static Frustum FromViewProjection(const Mat4f& viewProjection);
+		/// Returns false if the sphere is completely outside of the frustum
+		bool intersects(const BoundingSphere& sphere) const;
+		/// Returns false if the box is completely outside of the frustum
+		bool intersects(const AABB& box) const;
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// Tests count bounding spheres against the frustum, four at a time using SSE where available. 
+	/// visible[i] is set to 1 if sphere i intersects the frustum and to 0 otherwise. The test is conservative:
+	/// spheres near the corners of the frustum can be reported as visible even though they are outside.
+	/// Returns the number of visible spheres.
+	std::size_t cullBoundingSpheres(const Frustum& frustum, const BoundingSphere* spheres, const std::size_t& count, unsigned char* visible);
+	/// Same as above for axis aligned bounding boxes
+	std::size_t cullAABBs(const Frustum& frustum, const AABB* boxes, const std::size_t& count, unsigned char* visible);
+	/// Overloads for vectors. visible is resized to the number of bounding volumes
+	std::size_t cullBoundingSpheres(const Frustum& frustum, const std::vector<BoundingSphere>& spheres, std::vector<unsigned char>& visible);
+	std::size_t cullAABBs(const Frustum& frustum, const std::vector<AABB>& boxes, std::vector<unsigned char>& visible);
+	//------------------------------------------------------------------------------------------------------
+}
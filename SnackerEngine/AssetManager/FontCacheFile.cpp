@@ -0,0 +1,51 @@
+#include "AssetManager/FontCacheFile.h"
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	void hashFNV1a(std::uint64_t& hash, const void* data, const std::size_t& size)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (std::size_t i = 0; i < size; ++i) {
+			hash ^= bytes[i];
+			hash *= 0x100000001b3ull;
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	void writeFontCacheHeader(std::ostream& stream, const std::uint64_t& key)
+	{
+		const FontCacheHeader header{ fontCacheMagic, fontCacheVersion, key };
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	}
+	//------------------------------------------------------------------------------------------------------
+	void writeFontCacheGlyph(std::ostream& stream, const FontCacheGlyphRecord& record, const unsigned char* pixels)
+	{
+		stream.write(reinterpret_cast<const char*>(&record), sizeof(record));
+		if (record.width <= 0 || record.height <= 0 || !pixels) return;
+		stream.write(reinterpret_cast<const char*>(pixels), static_cast<std::streamsize>(record.width) * record.height * 3);
+	}
+	//------------------------------------------------------------------------------------------------------
+	FontCacheReadResult readFontCache(std::istream& stream, const std::uint64_t& key, std::vector<FontCacheGlyph>& glyphs)
+	{
+		// The key is part of the file name, but check it again in case the file was renamed
+		FontCacheHeader header{};
+		if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != fontCacheMagic ||
+			header.version != fontCacheVersion || header.key != key) return FontCacheReadResult::INVALID;
+		// Read glyph records until the end of the file
+		while (true) {
+			FontCacheGlyph glyph;
+			if (!stream.read(reinterpret_cast<char*>(&glyph.record), sizeof(glyph.record))) {
+				return stream.gcount() == 0 ? FontCacheReadResult::COMPLETE : FontCacheReadResult::TRUNCATED;
+			}
+			if (glyph.record.width < 0 || glyph.record.height < 0) return FontCacheReadResult::INVALID;
+			if (glyph.record.width > 0 && glyph.record.height > 0) {
+				glyph.pixels.resize(static_cast<std::size_t>(glyph.record.width) * glyph.record.height * 3);
+				if (!stream.read(reinterpret_cast<char*>(glyph.pixels.data()), static_cast<std::streamsize>(glyph.pixels.size()))) {
+					return FontCacheReadResult::TRUNCATED;
+				}
+			}
+			glyphs.push_back(std::move(glyph));
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+}
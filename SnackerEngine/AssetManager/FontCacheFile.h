@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	/// The font atlas cache is a binary file consisting of a header and a list of glyph records. Each record
+	/// stores the codepoint, the size of the glyph box and the glyph bitmap (uncompressed, 3 bytes per pixel).
+	/// New glyphs are appended to the end of the file. The atlas layout is not stored, the glyphs are packed
+	/// again when the cache is loaded (see FontManager)
+	constexpr std::uint32_t fontCacheMagic = 0x43464553; // "SEFC"
+	constexpr std::uint32_t fontCacheVersion = 1;
+	/// Header of the font atlas cache file
+	struct FontCacheHeader
+	{
+		std::uint32_t magic{};
+		std::uint32_t version{};
+		std::uint64_t key{};
+	};
+	/// Header of a single glyph record in the font atlas cache file
+	struct FontCacheGlyphRecord
+	{
+		std::uint32_t codepoint{};
+		std::int32_t width{};
+		std::int32_t height{};
+	};
+	/// A glyph record together with its bitmap, as read by readFontCache()
+	struct FontCacheGlyph
+	{
+		FontCacheGlyphRecord record{};
+		/// width * height * 3 bytes
+		std::vector<unsigned char> pixels{};
+	};
+	/// Result of readFontCache()
+	enum class FontCacheReadResult
+	{
+		INVALID,		/// The header does not match or a record is corrupt, the file can't be used
+		COMPLETE,		/// All records were read
+		TRUNCATED,		/// The last record is incomplete, all complete records were read
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// Offset basis of the 64 bit FNV-1a hash
+	constexpr std::uint64_t fnv1aOffsetBasis = 0xcbf29ce484222325ull;
+	/// Adds the given bytes to a 64 bit FNV-1a hash, which should be initialized with fnv1aOffsetBasis.
+	/// Unlike std::hash, this is guaranteed to be the same on every platform and run
+	void hashFNV1a(std::uint64_t& hash, const void* data, const std::size_t& size);
+	/// Writes the header of a font atlas cache file with the given key
+	void writeFontCacheHeader(std::ostream& stream, const std::uint64_t& key);
+	/// Writes a glyph record. pixels has to point to record.width * record.height * 3 bytes, and may be
+	/// nullptr if the glyph box is empty
+	void writeFontCacheGlyph(std::ostream& stream, const FontCacheGlyphRecord& record, const unsigned char* pixels);
+	/// Reads a font atlas cache file and appends its glyphs to the given vector. The file is only valid if 
+	/// its header contains the given key. A truncated file (eg. because the application was terminated
+	/// while appending) has to be written again before new records can be appended to it
+	FontCacheReadResult readFontCache(std::istream& stream, const std::uint64_t& key, std::vector<FontCacheGlyph>& glyphs);
+	//------------------------------------------------------------------------------------------------------
+}
@@ -8,8 +8,20 @@
 #include "Gui/Text/Unicode.h"
 #include "Core\Assert.h"
 #include "Gui\Text\FontData.h"
+#include "Graphics/Renderer.h"
+#include "AssetManager/FontCacheFile.h"
 
 #include <fstream>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
 #include <msdfgen.h>
 #include <msdfgen-ext.h>
 #include <msdf-atlas-gen.h>
@@ -23,6 +35,71 @@ namespace SnackerEngine
 {
     /// Vector that stores all FontData structs. FontIDs are indices into this vector
     static std::vector<FontData> fontDataArray{};
+    /// Counter used to give each loaded font a unique load index
+    static std::size_t fontLoadCounter = 0;
+    /// Sets the OpenGL unpack alignment used when uploading the atlas. Does nothing in headless mode,
+    /// where the atlas is generated on the CPU and its upload is only recorded by the CommandLog
+    static void setUnpackAlignment(const int& alignment)
+    {
+        if (Renderer::isHeadless()) return;
+        GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, alignment));
+    }
+
+    //======================================================================================================
+    // Background glyph generation
+    //======================================================================================================
+
+    /// A glyph whose MSDF bitmap is generated by one of the glyph worker threads
+    struct GlyphJob
+    {
+        /// The font the glyph belongs to, and the load index of the font at the time of the request.
+        /// If the font was deleted or reloaded in the meantime, the glyph is discarded
+        unsigned int fontID{};
+        std::size_t fontLoadIndex{};
+        Unicode codepoint{};
+        /// Geometry of the glyph. Is loaded on the main thread, because FreeType is not thread safe
+        msdf_atlas::GlyphGeometry glyph{};
+        /// The generated bitmap
+        msdfgen::Bitmap<float, 3> bitmap{};
+    };
+    /// Glyphs waiting to be generated, and the mutex and condition variable for thread-safe access
+    static std::deque<GlyphJob> glyphJobs{};
+    static std::mutex glyphJobsMutex{};
+    static std::condition_variable glyphJobsConditionVariable{};
+    /// If this is set to true, the worker threads stop. Guarded by glyphJobsMutex
+    static bool stopGlyphWorkerThreads = false;
+    /// Generated glyphs waiting to be added to their atlas by FontManager::update()
+    static std::vector<GlyphJob> finishedGlyphJobs{};
+    static std::mutex finishedGlyphJobsMutex{};
+    /// The glyph worker threads
+    static std::vector<std::thread> glyphWorkerThreads{};
+    /// Number of threads used by the atlas generator when generating many glyphs at once (eg. the default charset)
+    static int atlasGeneratorThreadCount = 1;
+
+    //======================================================================================================
+    // Font atlas cache
+    //======================================================================================================
+
+    /// Returns the atlas storage of the given font. The atlas generator only exposes its storage as const, 
+    /// but we need to put glyph bitmaps that were generated somewhere else into it
+    static msdf_atlas::BitmapAtlasStorage<msdf_atlas::byte, 3>& getMutableAtlasStorage(FontData& fontData)
+    {
+        return const_cast<msdf_atlas::BitmapAtlasStorage<msdf_atlas::byte, 3>&>(fontData.dynamicAtlas.atlasGenerator().atlasStorage());
+    }
+    /// Writes a glyph record with the bitmap of the given glyph (which has to be in the atlas already)
+    static void writeFontCacheGlyphRecord(std::ofstream& file, FontData& fontData, const msdf_atlas::GlyphGeometry& glyph)
+    {
+        FontCacheGlyphRecord record{ glyph.getCodepoint(), 0, 0 };
+        int left = 0, bottom = 0;
+        if (!glyph.isWhitespace()) glyph.getBoxRect(left, bottom, record.width, record.height);
+        if (record.width <= 0 || record.height <= 0) {
+            writeFontCacheGlyph(file, record, nullptr);
+            return;
+        }
+        msdfgen::Bitmap<msdf_atlas::byte, 3> bitmap(record.width, record.height);
+        getMutableAtlasStorage(fontData).get(left, bottom, bitmap);
+        writeFontCacheGlyph(file, record, static_cast<const msdf_atlas::byte*>(bitmap));
+    }
     
     //======================================================================================================
     // Helper functions for loading and updating fonts
@@ -30,16 +107,20 @@ namespace SnackerEngine
 
     void FontManager::setupMissingCharacterReplacement(const FontID& fontID)
     {
-        if (addNewGlyph(0x25a1, fontID)) { // White square
+        // The glyph may have been loaded already, eg. from the font atlas cache
+        const auto loadGlyph = [fontID](const Unicode& codepoint) {
+            return fontDataArray[fontID].fontGeometry.getGlyph(codepoint) != nullptr || addNewGlyph(codepoint, fontID);
+        };
+        if (loadGlyph(0x25a1)) { // White square
             fontDataArray[fontID].missingCharacterReplacement = 0x25a1;
         }
-        else if (addNewGlyph(0xfffd, fontID)) { // Black diamond with question mark
+        else if (loadGlyph(0xfffd)) { // Black diamond with question mark
             fontDataArray[fontID].missingCharacterReplacement = 0xfffd;
         }
-        else if (addNewGlyph(0x25a1, fontID)) { // White square small
+        else if (loadGlyph(0x25ab)) { // White square small
             fontDataArray[fontID].missingCharacterReplacement = 0x25ab;
         }
-        else if (addNewGlyph(0x3f, fontID)) { // Question mark
+        else if (loadGlyph(0x3f)) { // Question mark
             fontDataArray[fontID].missingCharacterReplacement = 0x3f;
         }
         else {
@@ -116,6 +197,9 @@ namespace SnackerEngine
         fontDataArray[fontID].glyphs.clear();
         fontDataArray[fontID].fontGeometry = msdf_atlas::FontGeometry(&fontDataArray[fontID].glyphs);
         fontDataArray[fontID].dynamicAtlas = DynamicAtlas();
+        fontDataArray[fontID].dynamicAtlas.atlasGenerator().setThreadCount(atlasGeneratorThreadCount);
+        fontDataArray[fontID].glyphCache.clear();
+        fontDataArray[fontID].loadIndex = ++fontLoadCounter;
         // specifies the maximum angle to be considered a corner in radians
         fontDataArray[fontID].maxCornerAngle = 3.0;
         // glyph scale
@@ -146,12 +230,13 @@ namespace SnackerEngine
             glyph.wrapBox(fontDataArray[fontID].glyphScale, fontDataArray[fontID].pixelRange / fontDataArray[fontID].glyphScale, fontDataArray[fontID].miterLimit);
         }
         fontDataArray[fontID].dynamicAtlas.add(fontDataArray[fontID].glyphs.data(), static_cast<int>(fontDataArray[fontID].glyphs.size()));
+        fontDataArray[fontID].glyphCache.setKerning(fontDataArray[fontID].fontGeometry.getKerning());
 
         msdfgen::BitmapConstRef<msdf_atlas::byte, 3>& storageRef = (msdfgen::BitmapConstRef<msdf_atlas::byte, 3>&)fontDataArray[fontID].dynamicAtlas.atlasGenerator().atlasStorage();
         fontDataArray[fontID].msdfTexture = Texture::Create2D(Vec2i(storageRef.width, storageRef.height));
-        GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1)); // disable byte-alignment restriction
+        setUnpackAlignment(1); // disable byte-alignment restriction
         TextureManager::fillTexture2D(fontDataArray[fontID].msdfTexture, storageRef.pixels);
-        GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 4)); // enable byte-alignment restriction
+        setUnpackAlignment(4); // enable byte-alignment restriction
     }
     //------------------------------------------------------------------------------------------------------
     bool FontManager::addNewGlyph(const Unicode& codepoint, const FontID& fontID)
@@ -175,9 +260,11 @@ namespace SnackerEngine
             // Atlas has been enlarged: create new texture
             msdfgen::BitmapConstRef<msdf_atlas::byte, 3>& storageRef = (msdfgen::BitmapConstRef<msdf_atlas::byte, 3>&)fontDataArray[fontID].dynamicAtlas.atlasGenerator().atlasStorage();
             TextureManager::resize(fontDataArray[fontID].msdfTexture, Vec2i(storageRef.width, storageRef.height));
-            GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1)); // disable byte-alignment restriction
+            setUnpackAlignment(1); // disable byte-alignment restriction
             TextureManager::fillTexture2D(fontDataArray[fontID].msdfTexture, storageRef.pixels);
-            GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 4)); // enable byte-alignment restriction
+            setUnpackAlignment(4); // enable byte-alignment restriction
+            // The atlas changed, cached glyphs have to be looked up again
+            fontDataArray[fontID].glyphCache.clearGlyphs();
             // TODO: Update all texts using this font ...
         }
         else {
@@ -186,10 +273,11 @@ namespace SnackerEngine
             glyph.getBoxRect(offset.x, offset.y, size.x, size.y);
             msdfgen::Bitmap<msdf_atlas::byte, 3> subBitmap(size.x, size.y);
             fontDataArray[fontID].dynamicAtlas.atlasGenerator().atlasStorage().get(offset.x, offset.y, subBitmap);
-            GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1)); // disable byte-alignment restriction
+            setUnpackAlignment(1); // disable byte-alignment restriction
             TextureManager::fillTexture2D(fontDataArray[fontID].msdfTexture, subBitmap, offset, size);
-            GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 4)); // enable byte-alignment restriction
+            setUnpackAlignment(4); // enable byte-alignment restriction
         }
+        appendGlyphsToFontCache(fontID, &glyph, 1);
         return true;
     }
     //------------------------------------------------------------------------------------------------------
@@ -201,32 +289,284 @@ namespace SnackerEngine
             return {};
         }
 #endif // _DEBUG
-        const msdf_atlas::GlyphGeometry* glyph = fontDataArray[font.fontID].fontGeometry.getGlyph(codepoint);
+        // Fast path: the glyph was looked up before
+        const GlyphCache::Entry* entry = fontDataArray[font.fontID].glyphCache.find(codepoint);
+        if (entry) return entry->glyph;
+        return cacheGlyph(font.fontID, codepoint).glyph;
+    }
+    //------------------------------------------------------------------------------------------------------
+    const GlyphCache::Entry& FontManager::cacheGlyph(const FontID& fontID, const Unicode& codepoint)
+    {
+        const msdf_atlas::GlyphGeometry* glyph = fontDataArray[fontID].fontGeometry.getGlyph(codepoint);
         // Add glyph to atlas if necessary
         if (glyph == nullptr) {
-            if (fontDataArray[font.fontID].missingCharacters.find(codepoint) != fontDataArray[font.fontID].missingCharacters.end()) {
+            if (fontDataArray[fontID].missingCharacters.find(codepoint) != fontDataArray[fontID].missingCharacters.end()) {
                 // We tried to load this glyph before and it was not possible
-                glyph = fontDataArray[font.fontID].fontGeometry.getGlyph(fontDataArray[font.fontID].missingCharacterReplacement);
+                glyph = fontDataArray[fontID].fontGeometry.getGlyph(fontDataArray[fontID].missingCharacterReplacement);
             }
             // try to add the new codepoint
-            else if (addNewGlyph(codepoint, font.fontID)) {
+            else if (fontDataArray[fontID].pendingCharacters.contains(codepoint) || requestGlyph(codepoint, fontID)) {
+                // The glyph is generated in the background. Until it is ready, the missing character replacement
+                // is used. It is not cached under the codepoint, such that the glyph is picked up as soon as it 
+                // was added to the atlas
+                static const GlyphCache::Entry emptyEntry{};
+                const GlyphCache::Entry* replacement = getAdvanceEntry(fontID, fontDataArray[fontID].missingCharacterReplacement);
+                return replacement ? *replacement : emptyEntry;
+            }
+            else if (addNewGlyph(codepoint, fontID)) {
                 // glyph was added successfully, we need to load it again
-                glyph = fontDataArray[font.fontID].fontGeometry.getGlyph(codepoint);
+                glyph = fontDataArray[fontID].fontGeometry.getGlyph(codepoint);
             }
             else {
                 // glyph could not be loaded
                 // Use the missing character replacement symbol instead and print warning
-                glyph = fontDataArray[font.fontID].fontGeometry.getGlyph(fontDataArray[font.fontID].missingCharacterReplacement);
-                fontDataArray[font.fontID].missingCharacters.insert(codepoint);
-                warningLogger << LOGGER::BEGIN << "Could not load codepoint " << codepoint << " from font " << fontDataArray[font.fontID].path << "!" << LOGGER::ENDL;
+                glyph = fontDataArray[fontID].fontGeometry.getGlyph(fontDataArray[fontID].missingCharacterReplacement);
+                fontDataArray[fontID].missingCharacters.insert(codepoint);
+                warningLogger << LOGGER::BEGIN << "Could not load codepoint " << codepoint << " from font " << fontDataArray[fontID].path << "!" << LOGGER::ENDL;
             }
         }
         if (glyph == nullptr) {
-            return Glyph();
+            return fontDataArray[fontID].glyphCache.insert(codepoint, Glyph(), -1);
+        }
+        // Now we have loaded our glyph. Missing characters are cached as the replacement glyph,
+        // such that they don't have to be looked up in missingCharacters again
+        msdfgen::BitmapConstRef<msdfgen::byte, 3> bitmap = fontDataArray[fontID].dynamicAtlas.atlasGenerator().atlasStorage();
+        return fontDataArray[fontID].glyphCache.insert(codepoint, Glyph(*glyph, Vec2i(bitmap.width, bitmap.height)), glyph->getIndex());
+    }
+    //------------------------------------------------------------------------------------------------------
+    const GlyphCache::Entry* FontManager::getAdvanceEntry(const FontID& fontID, const Unicode& codepoint)
+    {
+        FontData& fontData = fontDataArray[fontID];
+        const GlyphCache::Entry* entry = fontData.glyphCache.find(codepoint);
+        if (entry) return entry;
+        if (fontData.fontGeometry.getGlyph(codepoint) != nullptr) return &cacheGlyph(fontID, codepoint);
+        // The glyph is not loaded (yet). Use the replacement, but don't cache it under the given codepoint,
+        // because this would prevent the glyph from being loaded by getGlyph() later
+        entry = fontData.glyphCache.find(fontData.missingCharacterReplacement);
+        if (entry) return entry;
+        if (fontData.fontGeometry.getGlyph(fontData.missingCharacterReplacement) != nullptr) return &cacheGlyph(fontID, fontData.missingCharacterReplacement);
+        return nullptr;
+    }
+    //------------------------------------------------------------------------------------------------------
+    bool FontManager::requestGlyph(const Unicode& codepoint, const FontID& fontID)
+    {
+        if (!asyncGlyphGeneration || glyphWorkerThreads.empty() || !fontHandles[fontID]) return false;
+        FontData& fontData = fontDataArray[fontID];
+        GlyphJob job{ fontID, fontData.loadIndex, codepoint };
+        if (!job.glyph.load(fontHandles[fontID], fontData.fontGeometry.getGeometryScale(), codepoint)) {
+            return false;
+        }
+        // Whitespaces have no bitmap, they can be added right away
+        if (job.glyph.isWhitespace()) return false;
+        // Apply MSDF edge coloring and finalize glyph box size. This is cheap compared to generating the bitmap
+        job.glyph.edgeColoring(&msdfgen::edgeColoringInkTrap, fontData.maxCornerAngle, 0);
+        job.glyph.wrapBox(fontData.glyphScale, fontData.pixelRange / fontData.glyphScale, fontData.miterLimit);
+        fontData.pendingCharacters.insert(codepoint);
+        {
+            std::lock_guard<std::mutex> lock(glyphJobsMutex);
+            glyphJobs.push_back(std::move(job));
+        }
+        glyphJobsConditionVariable.notify_one();
+        return true;
+    }
+    //------------------------------------------------------------------------------------------------------
+    void FontManager::runGlyphWorkerThread()
+    {
+        while (true) {
+            GlyphJob job;
+            {
+                std::unique_lock<std::mutex> lock(glyphJobsMutex);
+                glyphJobsConditionVariable.wait(lock, [] { return stopGlyphWorkerThreads || !glyphJobs.empty(); });
+                if (stopGlyphWorkerThreads) return;
+                job = std::move(glyphJobs.front());
+                glyphJobs.pop_front();
+            }
+            // Generate the bitmap. This only touches the job itself, so no lock is necessary
+            int left, bottom, width, height;
+            job.glyph.getBoxRect(left, bottom, width, height);
+            job.bitmap = msdfgen::Bitmap<float, 3>(width, height);
+            msdf_atlas::msdfGenerator(job.bitmap, job.glyph, msdf_atlas::GeneratorAttributes());
+            {
+                std::lock_guard<std::mutex> lock(finishedGlyphJobsMutex);
+                finishedGlyphJobs.push_back(std::move(job));
+            }
+        }
+    }
+    //------------------------------------------------------------------------------------------------------
+    void FontManager::update()
+    {
+        std::vector<GlyphJob> jobs;
+        {
+            std::lock_guard<std::mutex> lock(finishedGlyphJobsMutex);
+            if (finishedGlyphJobs.empty()) return;
+            jobs.swap(finishedGlyphJobs);
+        }
+        // Sort by font, such that every atlas is only updated once
+        std::sort(jobs.begin(), jobs.end(), [](const GlyphJob& a, const GlyphJob& b) { return a.fontID < b.fontID; });
+        auto groupBegin = jobs.begin();
+        while (groupBegin != jobs.end()) {
+            const FontID fontID = groupBegin->fontID;
+            auto groupEnd = std::find_if(groupBegin, jobs.end(), [fontID](const GlyphJob& job) { return job.fontID != fontID; });
+            FontData& fontData = fontDataArray[fontID];
+            // Discard glyphs of fonts that were deleted or reloaded in the meantime
+            std::vector<msdf_atlas::GlyphGeometry> glyphs;
+            std::vector<const msdfgen::Bitmap<float, 3>*> bitmaps;
+            for (auto it = groupBegin; it != groupEnd; ++it) {
+                if (!fontData.valid || fontData.loadIndex != it->fontLoadIndex) continue;
+                fontData.pendingCharacters.erase(it->codepoint);
+                glyphs.push_back(std::move(it->glyph));
+                bitmaps.push_back(&it->bitmap);
+            }
+            groupBegin = groupEnd;
+            if (glyphs.empty()) continue;
+            // Pack all glyphs at once. The bitmaps were already generated, so the atlas generator is not invoked
+            DynamicAtlas::ChangeFlags change = fontData.dynamicAtlas.add(glyphs.data(), static_cast<int>(glyphs.size()), false, false);
+            auto& storage = getMutableAtlasStorage(fontData);
+            Vec2i minCorner(INT_MAX, INT_MAX);
+            Vec2i maxCorner(0, 0);
+            for (std::size_t i = 0; i < glyphs.size(); ++i) {
+                int left, bottom, width, height;
+                glyphs[i].getBoxRect(left, bottom, width, height);
+                storage.put(left, bottom, msdfgen::BitmapConstRef<float, 3>(*bitmaps[i]));
+                minCorner = Vec2i(std::min(minCorner.x, left), std::min(minCorner.y, bottom));
+                maxCorner = Vec2i(std::max(maxCorner.x, left + width), std::max(maxCorner.y, bottom + height));
+                fontData.fontGeometry.addGlyph(glyphs[i]);
+            }
+            // Upload the changed part of the atlas in one go
+            setUnpackAlignment(1); // disable byte-alignment restriction
+            if (change & DynamicAtlas::RESIZED) {
+                // Atlas has been enlarged: create new texture
+                msdfgen::BitmapConstRef<msdf_atlas::byte, 3>& storageRef = (msdfgen::BitmapConstRef<msdf_atlas::byte, 3>&)fontData.dynamicAtlas.atlasGenerator().atlasStorage();
+                TextureManager::resize(fontData.msdfTexture, Vec2i(storageRef.width, storageRef.height));
+                TextureManager::fillTexture2D(fontData.msdfTexture, storageRef.pixels);
+                fontData.glyphCache.clearGlyphs();
+            }
+            else {
+                const Vec2i size = maxCorner - minCorner;
+                msdfgen::Bitmap<msdf_atlas::byte, 3> subBitmap(size.x, size.y);
+                storage.get(minCorner.x, minCorner.y, subBitmap);
+                TextureManager::fillTexture2D(fontData.msdfTexture, subBitmap, minCorner, size);
+            }
+            setUnpackAlignment(4); // enable byte-alignment restriction
+            appendGlyphsToFontCache(fontID, glyphs.data(), glyphs.size());
+            // Texts using this font can now be recomputed with the new glyphs
+            fontData.glyphVersion++;
+            glyphAtlasVersion++;
+        }
+    }
+    //------------------------------------------------------------------------------------------------------
+    bool FontManager::setupFontCache(const std::string& fullFontPath, const std::string& existingFontDataPath, const FontID& fontID)
+    {
+        std::ifstream fontFile(fullFontPath, std::ios::binary);
+        if (!fontFile) return false;
+        const std::vector<char> fontFileData((std::istreambuf_iterator<char>(fontFile)), std::istreambuf_iterator<char>());
+        // Hash everything that changes the generated glyphs
+        FontData& fontData = fontDataArray[fontID];
+        std::uint64_t key = fnv1aOffsetBasis;
+        hashFNV1a(key, &fontCacheVersion, sizeof(fontCacheVersion));
+        hashFNV1a(key, fontFileData.data(), fontFileData.size());
+        for (const double& parameter : { fontData.maxCornerAngle, fontData.glyphScale, fontData.pixelRange, fontData.miterLimit }) {
+            hashFNV1a(key, &parameter, sizeof(parameter));
+        }
+        for (const msdf_atlas::unicode_t& codepoint : msdf_atlas::Charset::ASCII) {
+            hashFNV1a(key, &codepoint, sizeof(codepoint));
+        }
+        std::stringstream cachePath;
+        cachePath << Engine::getDefaultResourcePath() << existingFontDataPath << "_" << std::hex << std::setw(16) << std::setfill('0') << key << ".sefc";
+        fontData.cacheKey = key;
+        fontData.cachePath = cachePath.str();
+        return true;
+    }
+    //------------------------------------------------------------------------------------------------------
+    bool FontManager::loadFontCache(const FontID& fontID)
+    {
+        FontData& fontData = fontDataArray[fontID];
+        if (fontData.cachePath.empty()) return false;
+        std::vector<FontCacheGlyph> cachedGlyphs;
+        FontCacheReadResult result = FontCacheReadResult::INVALID;
+        {
+            std::ifstream file(fontData.cachePath, std::ios::binary);
+            if (!file) return false;
+            result = readFontCache(file, fontData.cacheKey, cachedGlyphs);
+        }
+        if (result == FontCacheReadResult::INVALID) {
+            warningLogger << LOGGER::BEGIN << "Invalid font atlas cache " << fontData.cachePath << ". Regenerating the atlas." << LOGGER::ENDL;
+            return false;
+        }
+        fontData.fontGeometry.loadMetrics(fontHandles[fontID], 1.0);
+        // The bitmap of each glyph in fontData.glyphs
+        std::vector<const FontCacheGlyph*> bitmaps;
+        for (const FontCacheGlyph& cachedGlyph : cachedGlyphs) {
+            const FontCacheGlyphRecord& record = cachedGlyph.record;
+            if (fontData.fontGeometry.getGlyph(record.codepoint) != nullptr) continue;
+            msdf_atlas::GlyphGeometry glyph;
+            if (!glyph.load(fontHandles[fontID], fontData.fontGeometry.getGeometryScale(), record.codepoint)) {
+                warningLogger << LOGGER::BEGIN << "Could not load glyph with codepoint " << record.codepoint << " from font atlas cache" << LOGGER::ENDL;
+                return false;
+            }
+            // Finalize glyph box size based on the parameters. Edge coloring is not necessary, the bitmap exists already
+            glyph.wrapBox(fontData.glyphScale, fontData.pixelRange / fontData.glyphScale, fontData.miterLimit);
+            int width = 0, height = 0;
+            if (!glyph.isWhitespace()) glyph.getBoxSize(width, height);
+            if (width != record.width || height != record.height) {
+                warningLogger << LOGGER::BEGIN << "Glyph with codepoint " << record.codepoint << " does not match the font atlas cache" << LOGGER::ENDL;
+                return false;
+            }
+            fontData.fontGeometry.addGlyph(glyph);
+            bitmaps.push_back(&cachedGlyph);
+        }
+        if (fontData.glyphs.empty()) return false;
+        fontData.fontGeometry.loadKerning(fontHandles[fontID]);
+        // Pack the glyphs and put the cached bitmaps into the atlas
+        fontData.dynamicAtlas.add(fontData.glyphs.data(), static_cast<int>(fontData.glyphs.size()), false, false);
+        auto& storage = getMutableAtlasStorage(fontData);
+        for (std::size_t i = 0; i < fontData.glyphs.size(); ++i) {
+            if (fontData.glyphs[i].isWhitespace()) continue;
+            int left, bottom, width, height;
+            fontData.glyphs[i].getBoxRect(left, bottom, width, height);
+            storage.put(left, bottom, msdfgen::BitmapConstRef<msdf_atlas::byte, 3>(bitmaps[i]->pixels.data(), width, height));
+        }
+        msdfgen::BitmapConstRef<msdf_atlas::byte, 3>& storageRef = (msdfgen::BitmapConstRef<msdf_atlas::byte, 3>&)fontData.dynamicAtlas.atlasGenerator().atlasStorage();
+        fontData.msdfTexture = Texture::Create2D(Vec2i(storageRef.width, storageRef.height));
+        setUnpackAlignment(1); // disable byte-alignment restriction
+        TextureManager::fillTexture2D(fontData.msdfTexture, storageRef.pixels);
+        setUnpackAlignment(4); // enable byte-alignment restriction
+        fontData.glyphCache.setKerning(fontData.fontGeometry.getKerning());
+        if (result == FontCacheReadResult::TRUNCATED) {
+            // New glyphs would be appended after the incomplete record, so the file is written again
+            warningLogger << LOGGER::BEGIN << "Font atlas cache " << fontData.cachePath << " was truncated. Writing it again." << LOGGER::ENDL;
+            saveFontCache(fontID);
+        }
+        return true;
+    }
+    //------------------------------------------------------------------------------------------------------
+    bool FontManager::saveFontCache(const FontID& fontID)
+    {
+        FontData& fontData = fontDataArray[fontID];
+        if (fontData.cachePath.empty()) return false;
+        std::error_code errorCode;
+        std::filesystem::create_directories(std::filesystem::path(fontData.cachePath).parent_path(), errorCode);
+        std::ofstream file(fontData.cachePath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            warningLogger << LOGGER::BEGIN << "Could not write font atlas cache " << fontData.cachePath << LOGGER::ENDL;
+            return false;
+        }
+        writeFontCacheHeader(file, fontData.cacheKey);
+        for (const auto& glyph : fontData.glyphs) {
+            writeFontCacheGlyphRecord(file, fontData, glyph);
+        }
+        return static_cast<bool>(file);
+    }
+    //------------------------------------------------------------------------------------------------------
+    void FontManager::appendGlyphsToFontCache(const FontID& fontID, const msdf_atlas::GlyphGeometry* glyphs, const std::size_t& count)
+    {
+        FontData& fontData = fontDataArray[fontID];
+        if (fontData.cachePath.empty() || count == 0) return;
+        std::ofstream file(fontData.cachePath, std::ios::binary | std::ios::app);
+        if (!file) return;
+        for (std::size_t i = 0; i < count; ++i) {
+            writeFontCacheGlyphRecord(file, fontData, glyphs[i]);
         }
-        // Now we have loaded our glyph
-        msdfgen::BitmapConstRef<msdfgen::byte, 3> bitmap = fontDataArray[font.fontID].dynamicAtlas.atlasGenerator().atlasStorage();
-        return Glyph(*glyph, Vec2i(bitmap.width, bitmap.height));
     }
     //------------------------------------------------------------------------------------------------------
     bool FontManager::loadFontDataFromFile(const std::string& path, const FontID& fontID)
@@ -276,6 +616,7 @@ namespace SnackerEngine
             return false;
         }
         fontData.dynamicAtlas.add(fontData.glyphs.data(), static_cast<unsigned int>(fontData.glyphs.size()), false, false);
+        fontData.glyphCache.setKerning(fontData.fontGeometry.getKerning());
         // Load texture
         auto result = Texture::Load2D(path+".png");
         fontData.msdfTexture = result.first;
@@ -311,6 +652,15 @@ namespace SnackerEngine
         }
         loadedFontsCount = 0;
         loadFontsPersistently = false;
+        asyncGlyphGeneration = true;
+        // Start the glyph worker threads. One core is left for the main thread
+        const unsigned int hardwareThreads = std::max(std::thread::hardware_concurrency(), 2u);
+        const unsigned int workerThreadCount = std::min(hardwareThreads - 1, 4u);
+        atlasGeneratorThreadCount = static_cast<int>(hardwareThreads);
+        stopGlyphWorkerThreads = false;
+        for (unsigned int i = 0; i < workerThreadCount; ++i) {
+            glyphWorkerThreads.push_back(std::thread(&FontManager::runGlyphWorkerThread));
+        }
     }
     //------------------------------------------------------------------------------------------------------
     void FontManager::increaseReferenceCount(const Font& font)
@@ -367,6 +717,7 @@ namespace SnackerEngine
     //------------------------------------------------------------------------------------------------------
     void FontManager::unbindAll()
     {
+        if (Renderer::isHeadless()) return;
         GLCall(glBindTexture(0, 0));
     }
     //------------------------------------------------------------------------------------------------------
@@ -386,16 +737,20 @@ namespace SnackerEngine
             return 0;
         }
         if (existingFontDataPath != "") {
-            if (!loadFontDataFromFile(existingFontDataPath, fontID)) {
+            // Try to load the glyphs from the font atlas cache. If this is not possible, the default charset is
+            // generated and a new cache file is written, st. it can be loaded faster next time!
+            setupFontCache(fullPath.value(), existingFontDataPath, fontID);
+            if (!loadFontCache(fontID)) {
                 // Reset atlas
                 fontDataArray[fontID].glyphs.clear();
                 fontDataArray[fontID].fontGeometry = msdf_atlas::FontGeometry(&fontDataArray[fontID].glyphs);
                 fontDataArray[fontID].dynamicAtlas = DynamicAtlas();
+                fontDataArray[fontID].dynamicAtlas.atlasGenerator().setThreadCount(atlasGeneratorThreadCount);
+                fontDataArray[fontID].glyphCache.clear();
                 // Load default charset
                 loadDefaultCharset(fontID);
                 if (fontDataArray[fontID].valid) {
-                    // Save the font, st. it can be loaded faster next time!
-                    saveFontDataInFile(fontID, existingFontDataPath);
+                    saveFontCache(fontID);
                 }
             }
         }
@@ -416,6 +771,18 @@ namespace SnackerEngine
     //------------------------------------------------------------------------------------------------------
     void FontManager::terminate()
     {
+        // Stop the glyph worker threads. Glyphs that were not generated yet are discarded
+        {
+            std::lock_guard<std::mutex> lock(glyphJobsMutex);
+            stopGlyphWorkerThreads = true;
+            glyphJobs.clear();
+        }
+        glyphJobsConditionVariable.notify_all();
+        for (auto& thread : glyphWorkerThreads) {
+            if (thread.joinable()) thread.join();
+        }
+        glyphWorkerThreads.clear();
+        finishedGlyphJobs.clear();
         fontDataArray.clear();
         for (unsigned int i = 0; i < fontHandles.size(); ++i) {
             if (fontHandles[i]) {
@@ -436,4 +803,13 @@ namespace SnackerEngine
         return fontDataArray[font.fontID].fontGeometry.getGlyph(codepoint) != nullptr;
     }
     //------------------------------------------------------------------------------------------------------
+    double FontManager::getAdvance(const Font& font, const Unicode& first, const Unicode& second)
+    {
+        const GlyphCache::Entry* firstEntry = getAdvanceEntry(font.fontID, first);
+        if (!firstEntry) return 0.0;
+        const GlyphCache::Entry* secondEntry = getAdvanceEntry(font.fontID, second);
+        if (!secondEntry) return 0.0;
+        return firstEntry->glyph.advance + fontDataArray[font.fontID].glyphCache.getKerning(*firstEntry, *secondEntry);
+    }
+    //------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
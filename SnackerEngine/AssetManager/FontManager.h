@@ -3,6 +3,7 @@
 #include "Graphics/Texture.h"
 #include "GUI/Text/Font.h"
 #include "Gui/Text/Glyph.h"
+#include "Gui/Text/GlyphCache.h"
 
 #include <queue>
 #include <unordered_map>
@@ -13,6 +14,9 @@ namespace msdfgen {
 	class FreetypeHandle;
 	class FontHandle;
 }
+namespace msdf_atlas {
+	class GlyphGeometry;
+}
 
 namespace SnackerEngine
 {
@@ -40,6 +44,10 @@ namespace SnackerEngine
 		inline static std::unordered_map<std::string, FontID> stringToFontID;
 		/// If this is set to true, all fonts are loaded persistently, i.e. never unloaded
 		inline static bool loadFontsPersistently;
+		/// If this is set to true, new glyphs are generated by background threads instead of the calling thread
+		inline static bool asyncGlyphGeneration;
+		/// Is incremented whenever glyphs are added to the atlas of any font
+		inline static unsigned int glyphAtlasVersion = 0;
 
 		/// Helper function to setup the missing character codepoint for a 
 		/// newly loaded font
@@ -60,6 +68,31 @@ namespace SnackerEngine
 		/// Returns a glyph from the given font. If the glyph wasn't loaded yet it is loaded from the font file.
 		/// If the glyph can't be loaded, a missing character glyph is returned instead and a warning is printed.
 		static Glyph getGlyph(Font& font, const Unicode& codepoint);
+		/// Looks up the glyph with the given codepoint like getGlyph() (loading it if necessary) and
+		/// stores it in the glyph cache of the font. Is called when the glyph is not cached yet
+		static const GlyphCache::Entry& cacheGlyph(const FontID& fontID, const Unicode& codepoint);
+		/// Returns the cache entry used for computing advances: the glyph itself if it was already loaded,
+		/// the missing character replacement otherwise. Does not load new glyphs. Returns nullptr if
+		/// neither glyph is valid
+		static const GlyphCache::Entry* getAdvanceEntry(const FontID& fontID, const Unicode& codepoint);
+		/// Loads the geometry of the glyph with the given codepoint and hands it to the glyph worker threads,
+		/// which generate the MSDF bitmap. The glyph is added to the atlas in the next call to update().
+		/// Returns false if the glyph could not be loaded, if it is a whitespace (nothing to generate) or if
+		/// asynchronous glyph generation is disabled. In this case, addNewGlyph() should be used instead
+		static bool requestGlyph(const Unicode& codepoint, const FontID& fontID);
+		/// Main function of the glyph worker threads
+		static void runGlyphWorkerThread();
+		/// Computes the key and the full path of the atlas cache file of the given font. The key is computed 
+		/// from the font file, the msdf generation parameters and the default charset, such that the cache is 
+		/// never used with different parameters. The file name consists of existingFontDataPath and the key.
+		/// Returns false if the font file could not be read
+		static bool setupFontCache(const std::string& fullFontPath, const std::string& existingFontDataPath, const FontID& fontID);
+		/// Tries to load the glyphs and atlas from the cache file of the given font. Returns true on success
+		static bool loadFontCache(const FontID& fontID);
+		/// Writes all glyphs of the given font into its cache file, replacing the old cache file
+		static bool saveFontCache(const FontID& fontID);
+		/// Appends the given glyphs to the cache file of the given font. The glyphs have to be in the atlas already
+		static void appendGlyphsToFontCache(const FontID& fontID, const msdf_atlas::GlyphGeometry* glyphs, const std::size_t& count);
 		/// Tries to load a fontData object from a given file path
 		//bool loadFontDataFromFile(const std::string& path);
 		/// Tries to save a fontData object in the given file path
@@ -87,6 +120,8 @@ namespace SnackerEngine
 		static const FontData& getFontData(const Font& font);
 		/// Checks if the given codepoint was loaded already / corresponds to a valid glyph
 		static bool isValidGlyph(const Font& font, const Unicode& codepoint);
+		/// Returns the advance distance between two specific glyphs (kerning)
+		static double getAdvance(const Font& font, const Unicode& first, const Unicode& second);
 	public:
 		/// Deleted constructor: this is a purely virtual class!
 		FontManager() = delete;
@@ -94,6 +129,17 @@ namespace SnackerEngine
 		/// per default, i.e. they are only deleted when the engine terminates.
 		static void setLoadFontsPersistently(bool loadFontsPersistently) { FontManager::loadFontsPersistently = loadFontsPersistently; }
 		static bool isLoadFontsPersistently() { return loadFontsPersistently; }
+		/// Sets the asyncGlyphGeneration bool variable. If this is set to true (default), glyphs that are not
+		/// in the atlas yet are generated by background threads. Until they are ready, the missing character
+		/// glyph is returned instead.
+		static void setAsyncGlyphGeneration(bool asyncGlyphGeneration) { FontManager::asyncGlyphGeneration = asyncGlyphGeneration; }
+		static bool isAsyncGlyphGeneration() { return asyncGlyphGeneration; }
+		/// Adds all glyphs that were generated by the background threads since the last call to the atlases
+		/// of their fonts and uploads the changed part of each atlas once. Should be called once per frame
+		static void update();
+		/// Returns a counter that is incremented whenever glyphs are added to the atlas of any font. Can be
+		/// used to detect that texts showing placeholder glyphs may have to be recomputed
+		static unsigned int getGlyphAtlasVersion() { return glyphAtlasVersion; }
 
 		// DEBUG
 		/// Tries to load a fontData object from a given file path
@@ -3,10 +3,13 @@
 #include "Core/Log.h"
 #include "Graphics/Model.h"
 #include "AssetManager/MeshManager.h"
+#include "AssetManager/MeshOptimizer.h"
+#include "AssetManager/MeshSimplifier.h"
 
 #include <unordered_map>
 #include <fstream>
 #include <optional>
+#include <algorithm>
 
 struct two_indices
 {
@@ -207,7 +210,17 @@ namespace SnackerEngine
 		}
 	}
 
-	std::optional<Mesh> constructMeshOBJ(const VERTEX_TYPE& vertexType, std::vector<Vec3f>& vertices, std::vector<float>& vertexBuffer, std::vector<unsigned int>& indexBuffer)
+	/// A mesh of an obj file together with its simplified levels of detail
+	struct MeshOBJ
+	{
+		Mesh mesh;
+		std::vector<Mesh> lodMeshes{};
+		/// Absolute geometric error of each level of detail
+		std::vector<float> lodErrors{};
+	};
+
+	std::optional<MeshOBJ> constructMeshOBJ(const VERTEX_TYPE& vertexType, std::vector<Vec3f>& vertices, std::vector<float>& vertexBuffer, std::vector<unsigned int>& indexBuffer,
+		const std::string& name, const bool& printDebug)
 	{
 		if (vertexType == VERTEX_TYPE::NONE)
 		{
@@ -241,30 +254,94 @@ namespace SnackerEngine
 		}
 
 		VertexBufferLayout layout;
+		// Normals are uploaded as 16-bit normalized integers. Positions and texture coordinates keep
+		// full precision, since OBJ files can have large coordinates and tiling texture coordinates
+		std::vector<VertexQuantization> quantizationModes;
 
 		switch (vertexType)
 		{
 		case VERTEX_TYPE::POS:
 			layout.push<float>(3);
+			quantizationModes = { VertexQuantization::NONE };
 			break;
 		case VERTEX_TYPE::POS_TEX:
 			layout.push<float>(3);
 			layout.push<float>(2);
+			quantizationModes = { VertexQuantization::NONE, VertexQuantization::NONE };
 			break;
 		case VERTEX_TYPE::POS_NORM:
 			layout.push<float>(3);
 			layout.push<float>(3);
+			quantizationModes = { VertexQuantization::NONE, VertexQuantization::SNORM16 };
 			break;
 		case VERTEX_TYPE::POS_TEX_NORM:
 			layout.push<float>(3);
 			layout.push<float>(2);
 			layout.push<float>(3);
+			quantizationModes = { VertexQuantization::NONE, VertexQuantization::NONE, VertexQuantization::SNORM16 };
 			break;
 		default:
 			break;
 		}
 
-		return std::make_optional(MeshManager::createMesh(layout, vertexBuffer, indexBuffer));
+		// Optimize index and vertex order for the vertex cache, overdraw and vertex fetches
+		auto statistics = optimizeMesh(layout, vertexBuffer, indexBuffer);
+		if (printDebug) logVertexCacheStatistics(name, statistics.first, statistics.second);
+
+		// Generate simplified levels of detail. The simplifier works on the full precision vertices,
+		// quantization is only done when uploading the meshes
+		VertexBufferLayout quantizedLayout;
+		const std::vector<unsigned char> quantizedVertices = quantizeVertices(layout, vertexBuffer, quantizationModes, quantizedLayout);
+		MeshOBJ result{ MeshManager::createMesh(quantizedLayout, quantizedVertices, indexBuffer) };
+		for (auto& lod : generateLODChain(layout, vertexBuffer, indexBuffer)) {
+			if (printDebug) {
+				infoLogger << LOGGER::BEGIN << "Generated LOD " << result.lodMeshes.size() + 1 << " of mesh \"" << name << "\" with "
+					<< lod.indices.size() / 3 << " triangles and error " << lod.error << LOGGER::ENDL;
+			}
+			result.lodMeshes.push_back(MeshManager::createMesh(quantizedLayout, quantizeVertices(layout, lod.vertices, quantizationModes, quantizedLayout), lod.indices));
+			result.lodErrors.push_back(lod.error);
+		}
+		return std::make_optional(result);
+	}
+
+	/// Combines the levels of detail of all meshes of an obj file into a model. Meshes that have less
+	/// levels than others use their least detailed level for the remaining levels.
+	Model constructModelOBJ(const std::vector<MeshOBJ>& meshes, const std::vector<Vec3f>& vertices)
+	{
+		std::vector<Mesh> fullResolutionMeshes;
+		std::size_t lodCount = 0;
+		for (const auto& mesh : meshes) {
+			fullResolutionMeshes.push_back(mesh.mesh);
+			lodCount = std::max(lodCount, mesh.lodMeshes.size());
+		}
+		// Bounding sphere around the center of the bounding box of all positions
+		Vec3f center{};
+		float radius = 0.0f;
+		if (!vertices.empty()) {
+			Vec3f minimum = vertices[0], maximum = vertices[0];
+			for (const auto& vertex : vertices) {
+				minimum = Vec3f(std::min(minimum.x, vertex.x), std::min(minimum.y, vertex.y), std::min(minimum.z, vertex.z));
+				maximum = Vec3f(std::max(maximum.x, vertex.x), std::max(maximum.y, vertex.y), std::max(maximum.z, vertex.z));
+			}
+			center = (minimum + maximum) / 2.0f;
+			for (const auto& vertex : vertices) radius = std::max(radius, (vertex - center).magnitude());
+		}
+		if (lodCount == 0 || radius <= 0.0f) return Model(fullResolutionMeshes);
+		std::vector<ModelLOD> lods(lodCount);
+		for (std::size_t level = 0; level < lodCount; ++level) {
+			float error = 0.0f;
+			for (const auto& mesh : meshes) {
+				if (mesh.lodMeshes.empty()) {
+					lods[level].meshes.push_back(mesh.mesh);
+					continue;
+				}
+				const std::size_t meshLevel = std::min(level, mesh.lodMeshes.size() - 1);
+				lods[level].meshes.push_back(mesh.lodMeshes[meshLevel]);
+				error = std::max(error, mesh.lodErrors[meshLevel]);
+			}
+			lods[level].relativeError = error / radius;
+		}
+		return Model(fullResolutionMeshes, lods, center, radius);
 	}
 
 	void resetVectors(std::string& mtlib, std::vector<float>& vertexBuffer, unsigned int& vertexBufferCounter, std::vector<unsigned int>& indexBuffer, 
@@ -299,7 +376,7 @@ namespace SnackerEngine
 		std::string line{}; // Current line in the obj file
 		std::string mtlib{};
 		std::string name{}; // Name of the current mesh
-		std::vector<Mesh> meshes{};
+		std::vector<MeshOBJ> meshes{};
 		std::vector<Vec3f> vertices{};
 		std::vector<Vec2f> textureCoordinates{};
 		std::vector<Vec3f> normalCoordinates{};
@@ -376,7 +453,7 @@ namespace SnackerEngine
 					if (name != "")
 					{
 						// new mesh starts from here. Construct mesh, reset vectors!
-						auto mesh = constructMeshOBJ(vertexType, vertices, vertexBuffer, indexBuffer);
+						auto mesh = constructMeshOBJ(vertexType, vertices, vertexBuffer, indexBuffer, name, printDebug);
 						if (mesh) meshes.push_back(mesh.value());
 						resetVectors(mtlib, vertexBuffer, vertexBufferCounter, indexBuffer, indexBufferDictionary_two, indexBufferDictionary_three, vertexType);
 					}
@@ -388,9 +465,9 @@ namespace SnackerEngine
 			}
 		}
 		// Insert the final (last) mesh
-		auto mesh = constructMeshOBJ(vertexType, vertices, vertexBuffer, indexBuffer);
+		auto mesh = constructMeshOBJ(vertexType, vertices, vertexBuffer, indexBuffer, name, printDebug);
 		if (mesh) meshes.push_back(mesh.value());
-		return Model(meshes);
+		return constructModelOBJ(meshes, vertices);
 	}
 
 }
\ No newline at end of file
@@ -53,6 +53,10 @@ namespace SnackerEngine
 		}
 #endif // _DEBUG
 
+		// Remove mesh from the procedural mesh cache
+		if (meshDataArray[meshID].cached) {
+			proceduralMeshCache.erase(meshDataArray[meshID].cacheKey);
+		}
 		// Reset and unload mesh
 		meshDataArray[meshID] = std::move(MeshData());
 		loadedMeshesCount--;
@@ -80,6 +84,24 @@ namespace SnackerEngine
 		return id;
 	}
 	//------------------------------------------------------------------------------------------------------
+	void MeshManager::computeBoundingVolumes(MeshData& meshData, const VertexBufferLayout& layout, const void* vertices, const std::size_t& size)
+	{
+		meshData.boundingBox = AABB::Empty();
+		meshData.boundingSphere = BoundingSphere{};
+		const auto& elements = layout.GetElements();
+		const unsigned int stride = layout.GetStride();
+		if (elements.empty() || stride == 0 || elements[0].type != GL_FLOAT || elements[0].count < 2 || elements[0].count > 3) return;
+		const std::size_t vertexCount = size / stride;
+		std::vector<Vec3f> positions(vertexCount, Vec3f(0.0f));
+		const unsigned char* data = static_cast<const unsigned char*>(vertices);
+		for (std::size_t i = 0; i < vertexCount; ++i) {
+			const float* position = reinterpret_cast<const float*>(data + i * stride);
+			positions[i] = Vec3f(position[0], position[1], elements[0].count == 3 ? position[2] : 0.0f);
+		}
+		meshData.boundingBox = computeAABB(positions);
+		meshData.boundingSphere = computeBoundingSphere(positions);
+	}
+	//------------------------------------------------------------------------------------------------------
 	void MeshManager::initialize(const unsigned int& startingSize)
 	{
 		// Initializes queue with all possible meshIDs. meshID = 0 is reserved for invalid meshes.
@@ -154,6 +176,70 @@ namespace SnackerEngine
 	{
 		/// Clears the meshDataArray, deleting all meshes from the GPU!
 		meshDataArray.clear();
+		proceduralMeshCache.clear();
+	}
+	//------------------------------------------------------------------------------------------------------
+	Mesh MeshManager::createProceduralMesh(const ProceduralMeshParameters& parameters)
+	{
+		auto it = proceduralMeshCache.find(parameters);
+		if (it != proceduralMeshCache.end()) {
+			return Mesh(it->second);
+		}
+		MeshGeometry geometry = generateMeshGeometry(parameters);
+		Mesh mesh = createMesh(geometry.layout, geometry.vertices, geometry.indices);
+		if (mesh.meshID != 0) {
+			MeshData& meshData = meshDataArray[mesh.meshID];
+			meshData.cached = true;
+			meshData.cacheKey = parameters;
+			proceduralMeshCache[parameters] = mesh.meshID;
+		}
+		return Mesh(mesh.meshID);
+	}
+	//------------------------------------------------------------------------------------------------------
+	ProceduralMeshBatch MeshManager::createProceduralMeshBatch(const std::vector<ProceduralMeshParameters>& parameters)
+	{
+		ProceduralMeshBatch batch;
+		batch.ranges.resize(parameters.size());
+		if (parameters.empty()) return batch;
+		// Each distinct parameter set is only generated once
+		std::unordered_map<ProceduralMeshParameters, std::size_t, ProceduralMeshParameters::Hash> generatedRanges;
+		VertexBufferLayout layout;
+		std::vector<float> vertices;
+		std::vector<unsigned int> indices;
+		unsigned int vertexCount = 0;
+		for (std::size_t i = 0; i < parameters.size(); ++i) {
+			auto it = generatedRanges.find(parameters[i]);
+			if (it != generatedRanges.end()) {
+				batch.ranges[i] = batch.ranges[it->second];
+				continue;
+			}
+			MeshGeometry geometry = generateMeshGeometry(parameters[i]);
+			if (geometry.layout.GetStride() == 0) continue;
+			if (generatedRanges.empty()) {
+				layout = geometry.layout;
+			}
+			else if (!(geometry.layout == layout)) {
+				warningLogger << LOGGER::BEGIN << "Tried to add procedural mesh with a different vertex layout to a mesh batch!" << LOGGER::ENDL;
+				continue;
+			}
+			ProceduralMeshRange& range = batch.ranges[i];
+			range.firstIndex = static_cast<unsigned int>(indices.size());
+			range.indexCount = static_cast<unsigned int>(geometry.indices.size());
+			range.firstVertex = vertexCount;
+			range.vertexCount = static_cast<unsigned int>(geometry.vertices.size() * sizeof(float) / layout.GetStride());
+			// Append to the shared arena, rebasing the indices onto the first vertex of this variant
+			vertices.insert(vertices.end(), geometry.vertices.begin(), geometry.vertices.end());
+			indices.reserve(indices.size() + geometry.indices.size());
+			for (const unsigned int& index : geometry.indices) {
+				indices.push_back(index + vertexCount);
+			}
+			vertexCount += range.vertexCount;
+			generatedRanges[parameters[i]] = i;
+		}
+		if (!indices.empty()) {
+			batch.mesh = createMesh(layout, vertices, indices);
+		}
+		return batch;
 	}
 	//------------------------------------------------------------------------------------------------------
 	MeshManager::MeshData& MeshManager::getMeshData(const Mesh& mesh)
@@ -4,9 +4,12 @@
 #include "Graphics/VertexArray.h"
 #include "Graphics/VertexBuffer.h"
 #include "Graphics/IndexBuffer.h"
+#include "Graphics/Meshes/ProceduralMeshes.h"
+#include "Math/BoundingVolumes.h"
 
 #include <vector>
 #include <queue>
+#include <unordered_map>
 
 namespace SnackerEngine
 {
@@ -37,6 +40,12 @@ namespace SnackerEngine
 			bool persistent{};
 			// This is set to false by standard and is set to true if an actual mesh is stored!
 			bool valid{};
+			// This is set to true if this mesh is stored in the procedural mesh cache under cacheKey
+			bool cached{};
+			ProceduralMeshParameters cacheKey{};
+			/// Bounding volumes in model space, computed from the positions when the mesh is created
+			AABB boundingBox = AABB::Empty();
+			BoundingSphere boundingSphere{};
 			// Destructor. Deletes the mesh from the GPU if it was loaded.
 			~MeshData();
 
@@ -56,12 +65,19 @@ namespace SnackerEngine
 		inline static MeshID maxMeshes;
 		/// Current count of Meshes loaded
 		inline static MeshID loadedMeshesCount;
+		/// Cache of procedurally generated meshes. The cache does not hold a reference to the meshes,
+		/// entries are removed when the corresponding mesh is deleted
+		inline static std::unordered_map<ProceduralMeshParameters, MeshID, ProceduralMeshParameters::Hash> proceduralMeshCache;
 
 		/// Delete the given mesh. Is called by decreaseReferenceCount, if the reference count reaches zero
 		static void deleteMesh(const MeshID& meshID);
 		/// Returns a new meshID. The MeshData corresponding to this id can then be used to create a new mesh.
 		/// Potentially resizes the meshDataArray, in which case a warning will be printed
 		static MeshID getNewMeshID();
+		/// Computes the bounding volumes of the given mesh data from the positions stored in the first attribute
+		/// of the vertices. Only positions of type GL_FLOAT with two or three components are supported, for other
+		/// layouts (e.g. quantized positions) the bounding box stays empty
+		static void computeBoundingVolumes(MeshData& meshData, const VertexBufferLayout& layout, const void* vertices, const std::size_t& size);
 	protected:
 		friend class Mesh;
 		friend class AssetManager;
@@ -83,9 +99,20 @@ namespace SnackerEngine
 	public:
 		/// Deleted constructor: this is a purely virtual class!
 		MeshManager() = delete;
-		/// Create a mesh from vertices and indices vectors!
+		/// Create a mesh from vertices and indices vectors! The index buffer uses the smallest index type that
+		/// can store all indices (8, 16 or 32 bit), see IndexBuffer::setIndices()
 		template<typename T>
 		static Mesh createMesh(const VertexBufferLayout& layout, const std::vector<T>& vertices, const std::vector<unsigned int>& indices, const VertexBuffer::VertexBufferStorageType& storageType = VertexBuffer::VertexBufferStorageType::STATIC);
+		/// Returns the mesh generated by the procedural mesh generator with the given parameters. If a mesh
+		/// with the same parameters is still alive, it is shared (through reference counting) instead of
+		/// generating it again. The returned mesh should therefore not be modified.
+		static Mesh createProceduralMesh(const ProceduralMeshParameters& parameters);
+		/// Generates all given parameter variants into one shared vertex and index buffer. Duplicate parameters
+		/// share the same range. All variants need to have the same vertex layout, variants with a different
+		/// layout than the first variant are skipped (their range is empty) and a warning is printed.
+		static ProceduralMeshBatch createProceduralMeshBatch(const std::vector<ProceduralMeshParameters>& parameters);
+		/// Returns the number of meshes currently stored in the procedural mesh cache
+		static std::size_t getProceduralMeshCacheSize() { return proceduralMeshCache.size(); }
 	};
 	//------------------------------------------------------------------------------------------------------
 	template<typename T>
@@ -96,6 +123,7 @@ namespace SnackerEngine
 		meshData.vb.setStorageType(storageType);
 		meshData.vb.setDataAndFinalize<T>(vertices);
 		meshData.ib.setIndices(indices);
+		computeBoundingVolumes(meshData, layout, vertices.data(), vertices.size() * sizeof(T));
 		meshData.va = VertexArray(layout, meshData.vb);
 		meshData.finalize();
 		return Mesh(meshID);
@@ -0,0 +1,355 @@
+#include "AssetManager/MeshOptimizer.h"
+#include "Core/Log.h"
+
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	VertexCacheStatistics analyzeVertexCache(const std::vector<unsigned int>& indices, const unsigned int& cacheSize)
+	{
+		VertexCacheStatistics result{};
+		result.triangleCount = static_cast<unsigned int>(indices.size() / 3);
+		if (result.triangleCount == 0 || cacheSize == 0) return result;
+		unsigned int maxIndex = *std::max_element(indices.begin(), indices.end());
+		// For every vertex we store the time stamp at which it entered the cache. A vertex is still
+		// in the FIFO cache if less than cacheSize other vertices entered the cache since then.
+		std::vector<unsigned int> cacheTimeStamps(static_cast<std::size_t>(maxIndex) + 1, 0);
+		std::vector<bool> referenced(static_cast<std::size_t>(maxIndex) + 1, false);
+		unsigned int timeStamp = cacheSize + 1;
+		for (std::size_t i = 0; i < static_cast<std::size_t>(result.triangleCount) * 3; ++i) {
+			const unsigned int index = indices[i];
+			if (!referenced[index]) {
+				referenced[index] = true;
+				result.uniqueVertexCount++;
+			}
+			if (timeStamp - cacheTimeStamps[index] > cacheSize) {
+				cacheTimeStamps[index] = timeStamp++;
+				result.vertexTransforms++;
+			}
+		}
+		result.acmr = static_cast<float>(result.vertexTransforms) / static_cast<float>(result.triangleCount);
+		result.atvr = static_cast<float>(result.vertexTransforms) / static_cast<float>(result.uniqueVertexCount);
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+	void logVertexCacheStatistics(const std::string& meshName, const VertexCacheStatistics& before, const VertexCacheStatistics& after)
+	{
+		infoLogger << LOGGER::BEGIN << "Optimized mesh \"" << meshName << "\" (" << after.triangleCount << " triangles, "
+			<< after.uniqueVertexCount << " vertices): ACMR " << before.acmr << " -> " << after.acmr
+			<< ", ATVR " << before.atvr << " -> " << after.atvr << LOGGER::ENDL;
+	}
+	//------------------------------------------------------------------------------------------------------
+	/// Constants of the Forsyth algorithm, see https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+	static constexpr int forsythCacheSize = static_cast<int>(defaultVertexCacheSize);
+	static constexpr float forsythCacheDecayPower = 1.5f;
+	static constexpr float forsythLastTriangleScore = 0.75f;
+	static constexpr float forsythValenceBoostScale = 2.0f;
+	static constexpr float forsythValenceBoostPower = 0.5f;
+	//------------------------------------------------------------------------------------------------------
+	/// Helper function that computes the score of a vertex given its position in the simulated cache
+	/// (-1 if it is not in the cache) and the number of triangles that still use the vertex
+	static float computeForsythVertexScore(const int& cachePosition, const unsigned int& activeTriangleCount)
+	{
+		if (activeTriangleCount == 0) return -1.0f;
+		float score = 0.0f;
+		if (cachePosition >= 0) {
+			if (cachePosition < 3) {
+				// The vertex was used in the last triangle
+				score = forsythLastTriangleScore;
+			}
+			else {
+				const float scaler = 1.0f / static_cast<float>(forsythCacheSize - 3);
+				score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scaler, forsythCacheDecayPower);
+			}
+		}
+		// Boost vertices with few remaining triangles, such that they get finished off quickly
+		score += forsythValenceBoostScale * std::pow(static_cast<float>(activeTriangleCount), -forsythValenceBoostPower);
+		return score;
+	}
+	//------------------------------------------------------------------------------------------------------
+	void optimizeVertexCache(std::vector<unsigned int>& indices, const unsigned int& vertexCount)
+	{
+		const std::size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0) return;
+		// Build vertex to triangle adjacency
+		std::vector<unsigned int> activeTriangleCounts(vertexCount, 0);
+		for (std::size_t i = 0; i < triangleCount * 3; ++i) activeTriangleCounts[indices[i]]++;
+		std::vector<unsigned int> adjacencyOffsets(static_cast<std::size_t>(vertexCount) + 1, 0);
+		for (unsigned int v = 0; v < vertexCount; ++v) adjacencyOffsets[v + 1] = adjacencyOffsets[v] + activeTriangleCounts[v];
+		std::vector<unsigned int> adjacency(triangleCount * 3);
+		{
+			std::vector<unsigned int> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for (std::size_t i = 0; i < triangleCount * 3; ++i) adjacency[fill[indices[i]]++] = static_cast<unsigned int>(i / 3);
+		}
+		// Initial scores
+		std::vector<float> vertexScores(vertexCount);
+		std::vector<int> cachePositions(vertexCount, -1);
+		for (unsigned int v = 0; v < vertexCount; ++v) vertexScores[v] = computeForsythVertexScore(-1, activeTriangleCounts[v]);
+		std::vector<bool> triangleEmitted(triangleCount, false);
+		// The simulated cache. It can temporarily hold three more vertices than the cache size
+		std::vector<unsigned int> cache;
+		cache.reserve(forsythCacheSize + 3);
+		std::vector<unsigned int> newCache;
+		newCache.reserve(forsythCacheSize + 3);
+		std::vector<unsigned int> result;
+		result.reserve(triangleCount * 3);
+		// Index of the first triangle that may not have been emitted yet. Used when the cache runs dry.
+		// It only moves forward, so all dead ends together cost O(triangleCount)
+		std::size_t scanPosition = 0;
+		long long bestTriangle = -1;
+		for (std::size_t emitted = 0; emitted < triangleCount; ++emitted) {
+			if (bestTriangle < 0) {
+				// No candidate in the cache: continue with the next triangle that was not emitted yet.
+				// Searching all remaining triangles for the best score would be quadratic
+				while (triangleEmitted[scanPosition]) scanPosition++;
+				bestTriangle = static_cast<long long>(scanPosition);
+			}
+			const std::size_t triangle = static_cast<std::size_t>(bestTriangle);
+			triangleEmitted[triangle] = true;
+			// Emit the triangle and put its vertices at the front of the cache
+			newCache.clear();
+			for (unsigned int k = 0; k < 3; ++k) {
+				const unsigned int v = indices[triangle * 3 + k];
+				result.push_back(v);
+				newCache.push_back(v);
+				// Remove the triangle from the adjacency list of the vertex
+				auto begin = adjacency.begin() + adjacencyOffsets[v];
+				auto end = begin + activeTriangleCounts[v];
+				auto it = std::find(begin, end, static_cast<unsigned int>(triangle));
+				std::iter_swap(it, end - 1);
+				activeTriangleCounts[v]--;
+			}
+			for (const unsigned int& v : cache) {
+				if (v != newCache[0] && v != newCache[1] && v != newCache[2]) newCache.push_back(v);
+			}
+			// Update the cache positions and scores of all vertices that were in the cache
+			for (std::size_t i = 0; i < newCache.size(); ++i) {
+				const unsigned int v = newCache[i];
+				cachePositions[v] = i < forsythCacheSize ? static_cast<int>(i) : -1;
+				vertexScores[v] = computeForsythVertexScore(cachePositions[v], activeTriangleCounts[v]);
+			}
+			if (newCache.size() > forsythCacheSize) newCache.resize(forsythCacheSize);
+			std::swap(cache, newCache);
+			// Rescore all triangles touching the cache and find the best one
+			bestTriangle = -1;
+			float bestScore = -1.0f;
+			for (const unsigned int& v : cache) {
+				for (unsigned int i = adjacencyOffsets[v]; i < adjacencyOffsets[v] + activeTriangleCounts[v]; ++i) {
+					const unsigned int t = adjacency[i];
+					const float score = vertexScores[indices[static_cast<std::size_t>(t) * 3]] + vertexScores[indices[static_cast<std::size_t>(t) * 3 + 1]] + vertexScores[indices[static_cast<std::size_t>(t) * 3 + 2]];
+					if (score > bestScore) {
+						bestScore = score;
+						bestTriangle = t;
+					}
+				}
+			}
+		}
+		// Keep any trailing indices that do not form a full triangle
+		result.insert(result.end(), indices.begin() + triangleCount * 3, indices.end());
+		indices = std::move(result);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void optimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<Vec3f>& positions)
+	{
+		const std::size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0 || positions.empty()) return;
+		// Split into clusters at hard boundaries: triangles where all three vertices miss the cache.
+		// Reordering the clusters then does not change the amount of vertex transforms by much.
+		constexpr unsigned int cacheSize = defaultVertexCacheSize;
+		std::vector<unsigned int> cacheTimeStamps(positions.size(), 0);
+		unsigned int timeStamp = cacheSize + 1;
+		std::vector<std::size_t> clusterStarts;
+		for (std::size_t t = 0; t < triangleCount; ++t) {
+			unsigned int misses = 0;
+			for (unsigned int k = 0; k < 3; ++k) {
+				const unsigned int index = indices[t * 3 + k];
+				if (timeStamp - cacheTimeStamps[index] > cacheSize) {
+					cacheTimeStamps[index] = timeStamp++;
+					misses++;
+				}
+			}
+			if (t == 0 || misses == 3) clusterStarts.push_back(t);
+		}
+		if (clusterStarts.size() < 2) return;
+		clusterStarts.push_back(triangleCount);
+		// Compute mesh centroid
+		Vec3f meshCentroid(0.0f);
+		for (const auto& position : positions) meshCentroid += position;
+		meshCentroid /= static_cast<float>(positions.size());
+		// Sort clusters by how much they are facing away from the center of the mesh.
+		// Clusters on the outside of the mesh are drawn first and occlude the remaining clusters.
+		const std::size_t clusterCount = clusterStarts.size() - 1;
+		std::vector<float> clusterSortKeys(clusterCount);
+		for (std::size_t c = 0; c < clusterCount; ++c) {
+			Vec3f centroid(0.0f);
+			Vec3f normal(0.0f);
+			float area = 0.0f;
+			for (std::size_t t = clusterStarts[c]; t < clusterStarts[c + 1]; ++t) {
+				const Vec3f& p0 = positions[indices[t * 3]];
+				const Vec3f& p1 = positions[indices[t * 3 + 1]];
+				const Vec3f& p2 = positions[indices[t * 3 + 2]];
+				// The magnitude of the cross product is twice the area of the triangle
+				const Vec3f areaNormal = cross(p1 - p0, p2 - p0);
+				const float triangleArea = areaNormal.magnitude();
+				centroid += (p0 + p1 + p2) * (triangleArea / 3.0f);
+				normal += areaNormal;
+				area += triangleArea;
+			}
+			if (area > 0.0f) centroid /= area;
+			const float normalLength = normal.magnitude();
+			if (normalLength > 0.0f) normal /= normalLength;
+			clusterSortKeys[c] = (centroid - meshCentroid) * normal;
+		}
+		std::vector<std::size_t> clusterOrder(clusterCount);
+		for (std::size_t c = 0; c < clusterCount; ++c) clusterOrder[c] = c;
+		std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&clusterSortKeys](const std::size_t& a, const std::size_t& b) {
+			return clusterSortKeys[a] > clusterSortKeys[b];
+			});
+		std::vector<unsigned int> result;
+		result.reserve(indices.size());
+		for (const auto& c : clusterOrder) {
+			result.insert(result.end(), indices.begin() + clusterStarts[c] * 3, indices.begin() + clusterStarts[c + 1] * 3);
+		}
+		result.insert(result.end(), indices.begin() + triangleCount * 3, indices.end());
+		indices = std::move(result);
+	}
+	//------------------------------------------------------------------------------------------------------
+	unsigned int optimizeVertexFetch(void* vertices, const unsigned int& vertexCount, const unsigned int& vertexSize, std::vector<unsigned int>& indices)
+	{
+		constexpr unsigned int unassigned = std::numeric_limits<unsigned int>::max();
+		std::vector<unsigned int> remap(vertexCount, unassigned);
+		unsigned int newVertexCount = 0;
+		for (auto& index : indices) {
+			if (remap[index] == unassigned) remap[index] = newVertexCount++;
+			index = remap[index];
+		}
+		unsigned char* data = static_cast<unsigned char*>(vertices);
+		std::vector<unsigned char> copy(data, data + static_cast<std::size_t>(vertexCount) * vertexSize);
+		for (unsigned int v = 0; v < vertexCount; ++v) {
+			if (remap[v] == unassigned) continue;
+			std::memcpy(data + static_cast<std::size_t>(remap[v]) * vertexSize, copy.data() + static_cast<std::size_t>(v) * vertexSize, vertexSize);
+		}
+		return newVertexCount;
+	}
+	//------------------------------------------------------------------------------------------------------
+	std::vector<Vec3f> extractPositions(const std::vector<float>& vertices, const VertexBufferLayout& layout)
+	{
+		const auto& elements = layout.GetElements();
+		if (elements.empty() || elements[0].type != GL_FLOAT || elements[0].count < 2 || elements[0].count > 3) return {};
+		if (layout.GetStride() % sizeof(float) != 0) return {};
+		const std::size_t strideInFloats = layout.GetStride() / sizeof(float);
+		const std::size_t vertexCount = vertices.size() / strideInFloats;
+		std::vector<Vec3f> positions(vertexCount);
+		for (std::size_t v = 0; v < vertexCount; ++v) {
+			const float* vertex = &vertices[v * strideInFloats];
+			positions[v] = Vec3f(vertex[0], vertex[1], elements[0].count == 3 ? vertex[2] : 0.0f);
+		}
+		return positions;
+	}
+	//------------------------------------------------------------------------------------------------------
+	std::pair<VertexCacheStatistics, VertexCacheStatistics> optimizeMesh(const VertexBufferLayout& layout, std::vector<float>& vertices, std::vector<unsigned int>& indices)
+	{
+		VertexCacheStatistics before = analyzeVertexCache(indices);
+		if (layout.GetStride() == 0 || indices.empty()) return { before, before };
+		const unsigned int vertexCount = static_cast<unsigned int>(vertices.size() * sizeof(float) / layout.GetStride());
+		// Indices that point outside of the vertex data can not be handled
+		if (*std::max_element(indices.begin(), indices.end()) >= vertexCount) return { before, before };
+		optimizeVertexCache(indices, vertexCount);
+		optimizeOverdraw(indices, extractPositions(vertices, layout));
+		optimizeVertexFetch(vertices, indices, layout);
+		return { before, analyzeVertexCache(indices) };
+	}
+	//------------------------------------------------------------------------------------------------------
+	HalfFloat floatToHalfFloat(const float& value)
+	{
+		unsigned int bits;
+		std::memcpy(&bits, &value, sizeof(float));
+		const unsigned short sign = static_cast<unsigned short>((bits >> 16) & 0x8000u);
+		const unsigned int absBits = bits & 0x7fffffffu;
+		if (absBits >= 0x7f800000u) {
+			// Infinity or NaN
+			return { static_cast<unsigned short>(sign | 0x7c00u | (absBits > 0x7f800000u ? 0x200u : 0u)) };
+		}
+		if (absBits >= 0x477ff000u) {
+			// Too large: round to infinity
+			return { static_cast<unsigned short>(sign | 0x7c00u) };
+		}
+		if (absBits < 0x38800000u) {
+			// Denormalized half float (or zero)
+			const float absValue = std::fabs(value);
+			return { static_cast<unsigned short>(sign | static_cast<unsigned short>(std::lround(absValue * 16777216.0f))) };
+		}
+		// Normalized half float: rebias exponent and round the mantissa
+		const unsigned int rounded = absBits + 0x00001000u - 0x38000000u;
+		return { static_cast<unsigned short>(sign | (rounded >> 13)) };
+	}
+	//------------------------------------------------------------------------------------------------------
+	/// Helper function that appends a value to a byte vector
+	template<typename T>
+	static void appendBytes(std::vector<unsigned char>& bytes, const T& value)
+	{
+		const unsigned char* begin = reinterpret_cast<const unsigned char*>(&value);
+		bytes.insert(bytes.end(), begin, begin + sizeof(T));
+	}
+	//------------------------------------------------------------------------------------------------------
+	std::vector<unsigned char> quantizeVertices(const VertexBufferLayout& layout, const std::vector<float>& vertices, const std::vector<VertexQuantization>& quantizationModes, VertexBufferLayout& quantizedLayout)
+	{
+		const auto& elements = layout.GetElements();
+		quantizedLayout = VertexBufferLayout();
+		if (quantizationModes.size() != elements.size()) {
+			warningLogger << LOGGER::BEGIN << "Tried to quantize vertices with wrong number of quantization modes!" << LOGGER::ENDL;
+			return {};
+		}
+		for (const auto& element : elements) {
+			if (element.type != GL_FLOAT) {
+				warningLogger << LOGGER::BEGIN << "Tried to quantize vertices with non-float attributes!" << LOGGER::ENDL;
+				return {};
+			}
+		}
+		// Build the quantized layout. Three component 16-bit attributes are padded to four components (w = 1)
+		std::vector<unsigned int> quantizedCounts(elements.size());
+		for (std::size_t i = 0; i < elements.size(); ++i) {
+			const unsigned int count = elements[i].count;
+			quantizedCounts[i] = (quantizationModes[i] != VertexQuantization::NONE && count == 3) ? 4 : count;
+			switch (quantizationModes[i])
+			{
+			case VertexQuantization::NONE: quantizedLayout.push<float>(quantizedCounts[i]); break;
+			case VertexQuantization::HALF_FLOAT: quantizedLayout.push<HalfFloat>(quantizedCounts[i]); break;
+			case VertexQuantization::SNORM16: quantizedLayout.push<short>(quantizedCounts[i]); break;
+			case VertexQuantization::UNORM16: quantizedLayout.push<unsigned short>(quantizedCounts[i]); break;
+			default: break;
+			}
+		}
+		const std::size_t strideInFloats = layout.GetStride() / sizeof(float);
+		if (strideInFloats == 0) return {};
+		const std::size_t vertexCount = vertices.size() / strideInFloats;
+		std::vector<unsigned char> result;
+		result.reserve(vertexCount * quantizedLayout.GetStride());
+		for (std::size_t v = 0; v < vertexCount; ++v) {
+			const float* attribute = &vertices[v * strideInFloats];
+			for (std::size_t i = 0; i < elements.size(); ++i) {
+				for (unsigned int c = 0; c < quantizedCounts[i]; ++c) {
+					// Padded components are set to one, which is also the default w component of a vertex attribute
+					const float value = c < elements[i].count ? attribute[c] : 1.0f;
+					switch (quantizationModes[i])
+					{
+					case VertexQuantization::NONE: appendBytes(result, value); break;
+					case VertexQuantization::HALF_FLOAT: appendBytes(result, floatToHalfFloat(value)); break;
+					case VertexQuantization::SNORM16: appendBytes(result, static_cast<short>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f))); break;
+					case VertexQuantization::UNORM16: appendBytes(result, static_cast<unsigned short>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f))); break;
+					default: break;
+					}
+				}
+				attribute += elements[i].count;
+			}
+		}
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Graphics/VertexBufferLayout.h"
+#include "Math/Vec.h"
+
+#include <vector>
+#include <string>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	/// Result of simulating a FIFO post-transform vertex cache on an index buffer.
+	/// Can be used to check the gains of the optimization functions below without a GPU.
+	struct VertexCacheStatistics
+	{
+		/// Number of triangles in the index buffer
+		unsigned int triangleCount{};
+		/// Number of vertices that are referenced at least once
+		unsigned int uniqueVertexCount{};
+		/// Number of times the vertex shader has to run (cache misses)
+		unsigned int vertexTransforms{};
+		/// Average cache miss ratio: vertexTransforms / triangleCount.
+		/// Between 0.5 (very good) and 3.0 (no vertex reuse at all)
+		float acmr{};
+		/// Average transform to vertex ratio: vertexTransforms / uniqueVertexCount. 1.0 is optimal
+		float atvr{};
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// Size of the post-transform vertex cache that the optimization functions below assume
+	constexpr unsigned int defaultVertexCacheSize = 32;
+	/// Simulates a FIFO post-transform vertex cache with the given size on the index buffer
+	/// (interpreted as a triangle list) and returns the resulting statistics
+	VertexCacheStatistics analyzeVertexCache(const std::vector<unsigned int>& indices, const unsigned int& cacheSize = defaultVertexCacheSize);
+	/// Prints the statistics before and after optimizing a mesh using the infoLogger
+	void logVertexCacheStatistics(const std::string& meshName, const VertexCacheStatistics& before, const VertexCacheStatistics& after);
+	//------------------------------------------------------------------------------------------------------
+	/// Reorders the triangles of the given index buffer for post-transform vertex cache locality.
+	/// Uses Tom Forsyth's "Linear-Speed Vertex Cache Optimisation" algorithm, which runs in linear time.
+	/// vertexCount:	number of vertices in the vertex buffer the indices point into
+	void optimizeVertexCache(std::vector<unsigned int>& indices, const unsigned int& vertexCount);
+	/// Reorders clusters of triangles such that triangles facing away from the mesh center are drawn first,
+	/// which reduces overdraw. Clusters are only split where the vertex cache would be flushed anyway, such
+	/// that the result of optimizeVertexCache() is kept. Should be called after optimizeVertexCache().
+	/// positions:	one position per vertex
+	void optimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<Vec3f>& positions);
+	/// Reorders the vertices in the order they are first referenced by the index buffer, improving the
+	/// locality of vertex fetches. The indices are remapped accordingly and vertices that are not referenced
+	/// are removed. Returns the new vertex count.
+	/// vertices:		pointer to the vertex data, will be overwritten
+	/// vertexCount:	the number of vertices
+	/// vertexSize:		size of a single vertex in bytes
+	unsigned int optimizeVertexFetch(void* vertices, const unsigned int& vertexCount, const unsigned int& vertexSize, std::vector<unsigned int>& indices);
+	/// Reorders the vertices in the order they are first referenced by the index buffer, see above.
+	/// The stride of the layout is used as the vertex size. The vertex vector is shrunk if vertices are removed.
+	template<typename T>
+	void optimizeVertexFetch(std::vector<T>& vertices, std::vector<unsigned int>& indices, const VertexBufferLayout& layout);
+	//------------------------------------------------------------------------------------------------------
+	/// Returns the positions stored in the first attribute of the given vertex data. The first attribute
+	/// has to be of type GL_FLOAT with two or three components (this is the case for all meshes of the engine).
+	/// If the layout does not satisfy this condition, an empty vector is returned.
+	std::vector<Vec3f> extractPositions(const std::vector<float>& vertices, const VertexBufferLayout& layout);
+	/// Runs the full optimization pipeline (vertex cache, overdraw and vertex fetch) on the given mesh.
+	/// This is the "online" version that is used by the loaders and mesh generators, but it can also be
+	/// used to optimize mesh data offline before saving it.
+	/// Returns the statistics of the vertex cache before and after optimizing.
+	std::pair<VertexCacheStatistics, VertexCacheStatistics> optimizeMesh(const VertexBufferLayout& layout, std::vector<float>& vertices, std::vector<unsigned int>& indices);
+	//------------------------------------------------------------------------------------------------------
+	/// Formats an attribute can be quantized into
+	enum class VertexQuantization
+	{
+		NONE,		/// Keep the 32-bit float
+		HALF_FLOAT,	/// 16-bit float, good for positions and texture coordinates
+		SNORM16,	/// 16-bit signed normalized integer in [-1, 1], good for normals and tangents
+		UNORM16,	/// 16-bit unsigned normalized integer in [0, 1], good for texture coordinates in [0, 1]
+	};
+	/// Quantizes the attributes of the given vertex data. All attributes of the layout have to be of type GL_FLOAT,
+	/// quantizationModes stores one mode per attribute. Quantized attributes with three components are padded to
+	/// four components (with w = 1) to keep all attributes 4-byte aligned. The returned data can be passed directly to
+	/// MeshManager::createMesh() together with quantizedLayout. Because the GPU converts the values back to floats,
+	/// no shader changes are necessary.
+	std::vector<unsigned char> quantizeVertices(const VertexBufferLayout& layout, const std::vector<float>& vertices, const std::vector<VertexQuantization>& quantizationModes, VertexBufferLayout& quantizedLayout);
+	/// Converts a float to a half float (round to nearest)
+	HalfFloat floatToHalfFloat(const float& value);
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void optimizeVertexFetch(std::vector<T>& vertices, std::vector<unsigned int>& indices, const VertexBufferLayout& layout)
+	{
+		const unsigned int vertexSize = layout.GetStride();
+		if (vertexSize == 0 || vertexSize % sizeof(T) != 0) return;
+		const unsigned int vertexCount = static_cast<unsigned int>(vertices.size() * sizeof(T) / vertexSize);
+		const unsigned int newVertexCount = optimizeVertexFetch(static_cast<void*>(vertices.data()), vertexCount, vertexSize, indices);
+		vertices.resize(static_cast<std::size_t>(newVertexCount) * vertexSize / sizeof(T));
+	}
+	//------------------------------------------------------------------------------------------------------
+}
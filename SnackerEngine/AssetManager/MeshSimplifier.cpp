@@ -0,0 +1,238 @@
+#include "AssetManager/MeshSimplifier.h"
+#include "AssetManager/MeshOptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	/// Symmetric 4x4 matrix storing the sum of squared distances to a set of planes.
+	/// The weight is the total area of the triangles the planes came from.
+	struct Quadric
+	{
+		/// a2, ab, ac, ad, b2, bc, bd, c2, cd, d2
+		std::array<double, 10> data{};
+		double weight{};
+		/// Constructs the quadric of the plane n * x + d = 0, weighted by the given area
+		static Quadric fromPlane(const Vec3f& n, const double& d, const double& area)
+		{
+			Quadric q;
+			const double a = n.x, b = n.y, c = n.z;
+			q.data = { a * a * area, a * b * area, a * c * area, a * d * area, b * b * area, b * c * area, b * d * area, c * c * area, c * d * area, d * d * area };
+			q.weight = area;
+			return q;
+		}
+		void operator+=(const Quadric& other)
+		{
+			for (std::size_t i = 0; i < data.size(); ++i) data[i] += other.data[i];
+			weight += other.weight;
+		}
+		Quadric operator+(const Quadric& other) const
+		{
+			Quadric result = *this;
+			result += other;
+			return result;
+		}
+		/// Returns the mean squared distance of the point p to the planes of this quadric
+		double evaluate(const Vec3f& p) const
+		{
+			const double x = p.x, y = p.y, z = p.z;
+			const double error = data[0] * x * x + 2.0 * data[1] * x * y + 2.0 * data[2] * x * z + 2.0 * data[3] * x
+				+ data[4] * y * y + 2.0 * data[5] * y * z + 2.0 * data[6] * y
+				+ data[7] * z * z + 2.0 * data[8] * z
+				+ data[9];
+			return weight > 0.0 ? std::fabs(error) / weight : 0.0;
+		}
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// Hash for positions, used to find vertices that share a position (attribute seams)
+	struct PositionHash
+	{
+		std::size_t operator()(const Vec3f& p) const
+		{
+			return std::hash<float>()(p.x) ^ (std::hash<float>()(p.y) << 1) ^ (std::hash<float>()(p.z) << 2);
+		}
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// Helper function that determines which vertices may not be moved by the simplification
+	static std::vector<bool> computeLockedVertices(const std::vector<Vec3f>& positions, const std::vector<unsigned int>& indices)
+	{
+		std::vector<bool> locked(positions.size(), false);
+		// Vertices on attribute seams: more than one vertex at the same position
+		std::unordered_map<Vec3f, unsigned int, PositionHash> firstVertexAtPosition;
+		firstVertexAtPosition.reserve(positions.size());
+		for (unsigned int v = 0; v < positions.size(); ++v) {
+			auto result = firstVertexAtPosition.insert({ positions[v], v });
+			if (!result.second) {
+				locked[v] = true;
+				locked[result.first->second] = true;
+			}
+		}
+		// Vertices on open borders: edges that are used by a single triangle only
+		std::vector<std::pair<unsigned int, unsigned int>> edges;
+		edges.reserve(indices.size());
+		for (std::size_t t = 0; t + 2 < indices.size(); t += 3) {
+			for (unsigned int k = 0; k < 3; ++k) {
+				unsigned int a = indices[t + k];
+				unsigned int b = indices[t + (k + 1) % 3];
+				edges.push_back({ std::min(a, b), std::max(a, b) });
+			}
+		}
+		std::sort(edges.begin(), edges.end());
+		for (std::size_t i = 0; i < edges.size();) {
+			std::size_t j = i + 1;
+			while (j < edges.size() && edges[j] == edges[i]) ++j;
+			if (j - i == 1) {
+				locked[edges[i].first] = true;
+				locked[edges[i].second] = true;
+			}
+			i = j;
+		}
+		return locked;
+	}
+	//------------------------------------------------------------------------------------------------------
+	/// Helper function that checks if moving the vertex source onto target would flip any triangle
+	/// adjacent to source (or make it degenerate)
+	static bool collapseFlipsTriangle(const unsigned int& source, const unsigned int& target, const std::vector<Vec3f>& positions,
+		const std::vector<unsigned int>& indices, const std::vector<unsigned int>& remap,
+		const std::vector<unsigned int>& adjacencyOffsets, const std::vector<unsigned int>& adjacency)
+	{
+		for (unsigned int i = adjacencyOffsets[source]; i < adjacencyOffsets[source + 1]; ++i) {
+			const std::size_t t = static_cast<std::size_t>(adjacency[i]) * 3;
+			std::array<unsigned int, 3> triangle = { remap[indices[t]], remap[indices[t + 1]], remap[indices[t + 2]] };
+			// Triangles containing both vertices are removed by the collapse
+			if (triangle[0] == target || triangle[1] == target || triangle[2] == target) continue;
+			const Vec3f normalBefore = cross(positions[triangle[1]] - positions[triangle[0]], positions[triangle[2]] - positions[triangle[0]]);
+			for (auto& v : triangle) if (v == source) v = target;
+			const Vec3f normalAfter = cross(positions[triangle[1]] - positions[triangle[0]], positions[triangle[2]] - positions[triangle[0]]);
+			if (normalBefore * normalAfter <= 0.0f) return true;
+		}
+		return false;
+	}
+	//------------------------------------------------------------------------------------------------------
+	std::vector<unsigned int> simplifyMesh(const std::vector<Vec3f>& positions, const std::vector<unsigned int>& indices, const std::size_t& targetIndexCount, const float& maxError, float* resultError)
+	{
+		std::vector<unsigned int> result(indices.begin(), indices.begin() + (indices.size() / 3) * 3);
+		const unsigned int vertexCount = static_cast<unsigned int>(positions.size());
+		double maxCollapseError = 0.0;
+		const double maxSquaredError = static_cast<double>(maxError) * static_cast<double>(maxError);
+		std::vector<bool> locked = computeLockedVertices(positions, result);
+		// Compute quadrics of the original surface
+		std::vector<Quadric> quadrics(vertexCount);
+		for (std::size_t t = 0; t < result.size(); t += 3) {
+			const Vec3f& p0 = positions[result[t]];
+			Vec3f normal = cross(positions[result[t + 1]] - p0, positions[result[t + 2]] - p0);
+			const float doubleArea = normal.magnitude();
+			if (doubleArea <= 0.0f) continue;
+			normal /= doubleArea;
+			const Quadric q = Quadric::fromPlane(normal, -static_cast<double>(normal * p0), 0.5 * doubleArea);
+			for (unsigned int k = 0; k < 3; ++k) quadrics[result[t + k]] += q;
+		}
+		struct Collapse
+		{
+			unsigned int source;
+			unsigned int target;
+			double error;
+		};
+		std::vector<Collapse> collapses;
+		std::vector<unsigned int> remap(vertexCount);
+		std::vector<bool> collapseLocked(vertexCount);
+		std::vector<unsigned int> adjacencyOffsets(static_cast<std::size_t>(vertexCount) + 1);
+		std::vector<unsigned int> adjacency;
+		// Each pass collapses a set of independent edges, cheapest first
+		while (result.size() > targetIndexCount) {
+			// Vertex to triangle adjacency of the current mesh
+			std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+			for (const auto& index : result) adjacencyOffsets[index + 1]++;
+			for (unsigned int v = 0; v < vertexCount; ++v) adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+			adjacency.resize(result.size());
+			{
+				std::vector<unsigned int> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+				for (std::size_t i = 0; i < result.size(); ++i) adjacency[fill[result[i]]++] = static_cast<unsigned int>(i / 3);
+			}
+			// Collect collapse candidates for all edges
+			collapses.clear();
+			for (std::size_t t = 0; t < result.size(); t += 3) {
+				for (unsigned int k = 0; k < 3; ++k) {
+					const unsigned int a = result[t + k];
+					const unsigned int b = result[t + (k + 1) % 3];
+					// Every interior edge appears twice, only consider it once
+					if (a > b) continue;
+					const Quadric q = quadrics[a] + quadrics[b];
+					const double errorAtoB = locked[a] ? std::numeric_limits<double>::max() : q.evaluate(positions[b]);
+					const double errorBtoA = locked[b] ? std::numeric_limits<double>::max() : q.evaluate(positions[a]);
+					if (errorAtoB == std::numeric_limits<double>::max() && errorBtoA == std::numeric_limits<double>::max()) continue;
+					if (errorAtoB <= errorBtoA) collapses.push_back({ a, b, errorAtoB });
+					else collapses.push_back({ b, a, errorBtoA });
+				}
+			}
+			std::sort(collapses.begin(), collapses.end(), [](const Collapse& c1, const Collapse& c2) { return c1.error < c2.error; });
+			// Apply collapses until enough triangles are removed
+			for (unsigned int v = 0; v < vertexCount; ++v) remap[v] = v;
+			std::fill(collapseLocked.begin(), collapseLocked.end(), false);
+			const std::size_t trianglesToRemove = (result.size() - targetIndexCount + 2) / 3;
+			std::size_t trianglesRemoved = 0;
+			std::size_t collapseCount = 0;
+			for (const auto& collapse : collapses) {
+				if (collapse.error > maxSquaredError) break;
+				if (collapseLocked[collapse.source] || collapseLocked[collapse.target]) continue;
+				if (collapseFlipsTriangle(collapse.source, collapse.target, positions, result, remap, adjacencyOffsets, adjacency)) continue;
+				remap[collapse.source] = collapse.target;
+				quadrics[collapse.target] += quadrics[collapse.source];
+				collapseLocked[collapse.source] = true;
+				collapseLocked[collapse.target] = true;
+				maxCollapseError = std::max(maxCollapseError, collapse.error);
+				collapseCount++;
+				// Count the triangles that share the collapsed edge, they become degenerate
+				for (unsigned int i = adjacencyOffsets[collapse.source]; i < adjacencyOffsets[collapse.source + 1]; ++i) {
+					const std::size_t t = static_cast<std::size_t>(adjacency[i]) * 3;
+					if (result[t] == collapse.target || result[t + 1] == collapse.target || result[t + 2] == collapse.target) trianglesRemoved++;
+				}
+				if (trianglesRemoved >= trianglesToRemove) break;
+			}
+			if (collapseCount == 0) break;
+			// Remap indices and remove degenerate triangles
+			std::size_t writePosition = 0;
+			for (std::size_t t = 0; t < result.size(); t += 3) {
+				const unsigned int a = remap[result[t]], b = remap[result[t + 1]], c = remap[result[t + 2]];
+				if (a == b || b == c || a == c) continue;
+				result[writePosition++] = a;
+				result[writePosition++] = b;
+				result[writePosition++] = c;
+			}
+			result.resize(writePosition);
+		}
+		if (resultError) *resultError = static_cast<float>(std::sqrt(maxCollapseError));
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+	std::vector<MeshLODData> generateLODChain(const VertexBufferLayout& layout, const std::vector<float>& vertices, const std::vector<unsigned int>& indices, const unsigned int& maxLevels, const float& reductionFactor)
+	{
+		std::vector<MeshLODData> result;
+		const std::vector<Vec3f> positions = extractPositions(vertices, layout);
+		if (positions.empty() || indices.size() < 3) return result;
+		if (*std::max_element(indices.begin(), indices.end()) >= positions.size()) return result;
+		std::size_t previousIndexCount = indices.size();
+		float targetRatio = 1.0f;
+		for (unsigned int level = 1; level <= maxLevels; ++level) {
+			targetRatio *= reductionFactor;
+			const std::size_t targetIndexCount = static_cast<std::size_t>(static_cast<float>(indices.size() / 3) * targetRatio) * 3;
+			MeshLODData lod;
+			// Always simplify from the original mesh, such that errors do not accumulate between levels
+			lod.indices = simplifyMesh(positions, indices, targetIndexCount, std::numeric_limits<float>::max(), &lod.error);
+			// Stop if the mesh can not be simplified any further (eg. because all vertices are locked)
+			if (lod.indices.empty() || static_cast<float>(lod.indices.size()) > static_cast<float>(previousIndexCount) * 0.9f) break;
+			previousIndexCount = lod.indices.size();
+			lod.vertices = vertices;
+			optimizeVertexCache(lod.indices, static_cast<unsigned int>(positions.size()));
+			optimizeVertexFetch(lod.vertices, lod.indices, layout);
+			result.push_back(std::move(lod));
+		}
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+}
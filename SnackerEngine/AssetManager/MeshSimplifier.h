@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Graphics/VertexBufferLayout.h"
+#include "Math/Vec.h"
+
+#include <vector>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	/// Simplifies a triangle mesh by collapsing edges, using quadric error metrics (Garland and Heckbert)
+	/// to choose the collapses that change the surface the least. Vertices are only moved onto other
+	/// existing vertices, such that only a new index buffer is produced and all vertex attributes stay valid.
+	/// Vertices on open borders and on attribute seams (several vertices with the same position) are locked.
+	/// positions:			one position per vertex
+	/// indices:			the index buffer (triangle list) of the mesh that is simplified
+	/// targetIndexCount:	the simplification stops when the index count is at or below this number
+	/// maxError:			the simplification stops when the next collapse would cause a larger error. The error
+	///						is the distance to the original surface, in the same units as the positions
+	/// resultError:		if not nullptr, the (approximate) error of the simplified mesh is written here
+	/// Returns the simplified index buffer.
+	std::vector<unsigned int> simplifyMesh(const std::vector<Vec3f>& positions, const std::vector<unsigned int>& indices, const std::size_t& targetIndexCount, const float& maxError, float* resultError = nullptr);
+	//------------------------------------------------------------------------------------------------------
+	/// A single simplified level of detail of a mesh
+	struct MeshLODData
+	{
+		/// The vertex data (only the vertices used by the indices are kept)
+		std::vector<float> vertices{};
+		/// The index buffer
+		std::vector<unsigned int> indices{};
+		/// Geometric error of this level, in the same units as the positions of the mesh
+		float error{};
+	};
+	/// Generates a chain of simplified meshes from the given mesh data. Level i targets
+	/// reductionFactor^i of the original index count. The mesh data itself is not included in the result.
+	/// The chain stops early if a level could not be simplified further.
+	/// The first attribute of the layout has to be the position (see extractPositions() in MeshOptimizer.h).
+	std::vector<MeshLODData> generateLODChain(const VertexBufferLayout& layout, const std::vector<float>& vertices, const std::vector<unsigned int>& indices, const unsigned int& maxLevels = 4, const float& reductionFactor = 0.5f);
+	//------------------------------------------------------------------------------------------------------
+}
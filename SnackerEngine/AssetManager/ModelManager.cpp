@@ -2,6 +2,8 @@
 #include "Core/Log.h"
 #include "AssetManager/LoaderOBJ.h"
 
+#include <algorithm>
+
 namespace SnackerEngine
 {
 	//------------------------------------------------------------------------------------------------------
@@ -10,6 +12,21 @@ namespace SnackerEngine
 	void ModelManager::ModelData::insertMesh(const Mesh& mesh)
 	{
 		meshes.push_back(mesh);
+		computeBoundingVolumes();
+	}
+	//------------------------------------------------------------------------------------------------------
+	void ModelManager::ModelData::computeBoundingVolumes()
+	{
+		boundingBox = AABB::Empty();
+		for (const auto& mesh : meshes) {
+			boundingBox.extend(mesh.getBoundingBox());
+		}
+		// Enclose the bounding spheres of all meshes in a sphere around the center of the bounding box
+		boundingSphere = BoundingSphere{ boundingBox.isValid() ? boundingBox.getCenter() : Vec3f(0.0f), 0.0f };
+		for (const auto& mesh : meshes) {
+			const BoundingSphere& meshSphere = mesh.getBoundingSphere();
+			boundingSphere.radius = std::max(boundingSphere.radius, (meshSphere.center - boundingSphere.center).magnitude() + meshSphere.radius);
+		}
 	}
 	//------------------------------------------------------------------------------------------------------
 	void ModelManager::deleteModel(const ModelID& modelID)
@@ -130,6 +147,7 @@ namespace SnackerEngine
 		modelData.persistent = false;
 		modelData.valid = meshes.size() > 0 ? true : false;
 		modelData.meshes = meshes;
+		modelData.computeBoundingVolumes();
 		return Model(modelID);
 	}
 	//------------------------------------------------------------------------------------------------------
@@ -145,4 +163,19 @@ namespace SnackerEngine
 		return Model(modelID);
 	}
 	//------------------------------------------------------------------------------------------------------
+	Model ModelManager::createModel(const std::vector<Mesh>& meshes, const std::vector<ModelLOD>& lods, const Vec3f& boundingSphereCenter, const float& boundingSphereRadius)
+	{
+		ModelID modelID = getNewModelID();
+		ModelData& modelData = modelDataArray[modelID];
+		modelData.referenceCount = 0;
+		modelData.persistent = false;
+		modelData.valid = meshes.size() > 0 ? true : false;
+		modelData.meshes = meshes;
+		modelData.lods = lods;
+		modelData.computeBoundingVolumes();
+		// The given sphere was computed from all positions and is usually tighter than the combined mesh spheres
+		modelData.boundingSphere = BoundingSphere{ boundingSphereCenter, boundingSphereRadius };
+		return Model(modelID);
+	}
+	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
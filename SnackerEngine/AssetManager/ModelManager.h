@@ -31,11 +31,18 @@ namespace SnackerEngine
 			bool valid{};
 			/// Vector of meshes
 			std::vector<Mesh> meshes{};
+			/// Simplified levels of detail, ordered from the most to the least detailed level
+			std::vector<ModelLOD> lods{};
+			/// Bounding volumes of all meshes in model space, used for culling and selecting the level of detail
+			AABB boundingBox = AABB::Empty();
+			BoundingSphere boundingSphere{};
 			/// Destructor. Deletes the model from the GPU if it was loaded.
 			~ModelData();
 
 			/// Inserts a new mesh into the mesh vector
 			void insertMesh(const Mesh& mesh);
+			/// Computes the bounding box and bounding sphere from the bounding volumes of the meshes
+			void computeBoundingVolumes();
 		};
 		/// We just use unsigned ints as modelIDs. The IDs are also indices into the modelDataArray!
 		using ModelID = unsigned int;
@@ -73,6 +80,8 @@ namespace SnackerEngine
 		static Model createModel(const std::vector<Mesh>& meshes);
 		/// Creates model from a single mesh
 		static Model createModel(const Mesh& mesh);
+		/// Creates model from array of meshes with simplified levels of detail
+		static Model createModel(const std::vector<Mesh>& meshes, const std::vector<ModelLOD>& lods, const Vec3f& boundingSphereCenter, const float& boundingSphereRadius);
 	public:
 		/// Deleted constructor: this is a purely virtual class!
 		ModelManager() = delete;
@@ -3,10 +3,14 @@
 #include "Core/Log.h"
 #include "Core/Engine.h"
 #include "Graphics/Color.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/GLState.h"
+#include "Graphics/CommandLog.h"
 
 #include <fstream>
 #include <optional>
 #include <sstream>
+#include <cstring>
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
@@ -17,21 +21,22 @@ namespace SnackerEngine
 	//======================================================================================================
 	ShaderManager::ShaderData::~ShaderData()
 	{
-		if (valid) {
-			GLCall(glDeleteProgram(GPU_ID));
+		if (valid && GPU_ID != 0) {
+			if (!Renderer::isHeadless()) GLCall(glDeleteProgram(GPU_ID));
+			GLState::onDeleteProgram(GPU_ID);
 		}
 	}
 	//------------------------------------------------------------------------------------------------------
 	void ShaderManager::ShaderData::bind() const
 	{
 		if (valid) {
-			GLCall(glUseProgram(GPU_ID));
+			GLState::useProgram(GPU_ID);
 		}
 	}
 	//------------------------------------------------------------------------------------------------------
 	void ShaderManager::unbindAll()
 	{
-		GLCall(glUseProgram(0));
+		GLState::useProgram(0);
 	}
 	//======================================================================================================
 	// Helper function to load and compile shaders
@@ -111,6 +116,8 @@ namespace SnackerEngine
 	/// of the new shader. Returns an empty optional if something went wrong
 	std::optional<unsigned int> createShader(const std::string& vertexShader, const std::string& fragmentShader)
 	{
+		// Without an OpenGL context nothing can be compiled, the program only gets a name
+		if (Renderer::isHeadless()) return CommandLog::generateObjectName();
 		// Create a shader, save the ID in program.
 		GLCall(unsigned int program = glCreateProgram());
 		// Compile both the fragment and the vertex shader!
@@ -210,16 +217,78 @@ namespace SnackerEngine
 		return createShader(source.value().vertexSource, source.value().fragmentSource);
 	}
 	//------------------------------------------------------------------------------------------------------
-	int ShaderManager::ShaderData::getUniformLocation(const std::string& name) const
+	template<typename T>
+	bool ShaderManager::UniformData::updateValue(const T& data)
+	{
+		static_assert(sizeof(T) <= sizeof(value), "Uniform type is too large for the shadow copy");
+		if (valueSize == sizeof(T) && std::memcmp(value.data(), &data, sizeof(T)) == 0) return false;
+		std::memcpy(value.data(), &data, sizeof(T));
+		valueSize = sizeof(T);
+		return true;
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	bool ShaderManager::UniformData::prepareUpload(const T& data)
+	{
+		if (location == -1) return false;
+		if (!updateValue(data)) {
+			CommandLog::recordElidedUniform();
+			return false;
+		}
+		CommandLog::recordUniform(location, sizeof(T));
+		return !Renderer::isHeadless();
+	}
+	//------------------------------------------------------------------------------------------------------
+	void ShaderManager::ShaderData::reflectUniforms()
 	{
-		GLCall(int location = glGetUniformLocation(GPU_ID, name.c_str()));
+		uniforms.clear();
+		// In headless mode the uniforms are added when they are first used
+		if (Renderer::isHeadless()) return;
+		int uniformCount = 0;
+		int maxNameLength = 0;
+		GLCall(glGetProgramiv(GPU_ID, GL_ACTIVE_UNIFORMS, &uniformCount));
+		GLCall(glGetProgramiv(GPU_ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength));
+		std::string name(static_cast<std::size_t>(maxNameLength), '\0');
+		for (int i = 0; i < uniformCount; ++i) {
+			int length = 0;
+			int size = 0;
+			unsigned int type = 0;
+			GLCall(glGetActiveUniform(GPU_ID, static_cast<unsigned int>(i), maxNameLength, &length, &size, &type, name.data()));
+			std::string_view uniformName(name.data(), static_cast<std::size_t>(length));
+			// Arrays are reported as "name[0]", but are usually set using just "name"
+			if (uniformName.ends_with("[0]")) uniformName.remove_suffix(3);
+			UniformData uniform;
+			uniform.hash = UniformName(uniformName).getHash();
+			uniform.name = std::string(uniformName);
+			GLCall(uniform.location = glGetUniformLocation(GPU_ID, uniform.name.c_str()));
+			uniforms.push_back(std::move(uniform));
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	ShaderManager::UniformData& ShaderManager::ShaderData::getUniform(const UniformName& name)
+	{
+		for (UniformData& uniform : uniforms) {
+			if (uniform.hash == name.getHash() && uniform.name == name.getName()) return uniform;
+		}
+		// Not an active uniform: ask OpenGL once and remember the result
+		UniformData uniform;
+		uniform.hash = name.getHash();
+		uniform.name = std::string(name.getName());
+		if (Renderer::isHeadless()) {
+			// Every uniform exists, the location is the index into the table
+			uniform.location = static_cast<int>(uniforms.size());
+		}
+		else {
+			GLCall(uniform.location = glGetUniformLocation(GPU_ID, uniform.name.c_str()));
+		}
 #ifdef _DEBUG
-		if (location == -1)
+		if (uniform.location == -1)
 		{
-			warningLogger << LOGGER::BEGIN << "Uniform \"" << name << "\" doesn't exist!" << LOGGER::ENDL;
+			warningLogger << LOGGER::BEGIN << "Uniform \"" << uniform.name << "\" doesn't exist!" << LOGGER::ENDL;
 		}
 #endif // _DEBUG
-		return location;
+		uniforms.push_back(std::move(uniform));
+		return uniforms.back();
 	}
 	//======================================================================================================
 	// ShaderManager implementation
@@ -288,6 +357,7 @@ namespace SnackerEngine
 			shaderData.persistent = true;
 			shaderData.valid = false;
 			shaderData.path = "";
+			shaderData.reflectUniforms();
 		}
 	}
 	//------------------------------------------------------------------------------------------------------
@@ -363,6 +433,7 @@ namespace SnackerEngine
 		shaderData.persistent = false;
 		shaderData.valid = true;
 		shaderData.path = path;
+		shaderData.reflectUniforms();
 		stringToShaderID.insert({ path, shaderID });
 		return shaderID;
 	}
@@ -374,82 +445,109 @@ namespace SnackerEngine
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<float>(const Shader& shader, const std::string& name, const float& data)
+	void SnackerEngine::ShaderManager::setUniform<float>(const Shader& shader, const UniformName& name, const float& data)
 	{
-		GLCall(glUniform1f(shaderDataArray[shader.shaderID].getUniformLocation(name), data));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniform1f(uniform.location, data));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<Vec2f>(const Shader& shader, const std::string& name, const Vec2f& data)
+	void SnackerEngine::ShaderManager::setUniform<Vec2f>(const Shader& shader, const UniformName& name, const Vec2f& data)
 	{
-		GLCall(glUniform2f(shaderDataArray[shader.shaderID].getUniformLocation(name), data.x, data.y));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniform2f(uniform.location, data.x, data.y));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<Vec3f>(const Shader& shader, const std::string& name, const Vec3f& data)
+	void SnackerEngine::ShaderManager::setUniform<Vec3f>(const Shader& shader, const UniformName& name, const Vec3f& data)
 	{
-		GLCall(glUniform3f(shaderDataArray[shader.shaderID].getUniformLocation(name), data.x, data.y, data.z));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniform3f(uniform.location, data.x, data.y, data.z));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<Vec4f>(const Shader& shader, const std::string& name, const Vec4f& data)
+	void SnackerEngine::ShaderManager::setUniform<Vec4f>(const Shader& shader, const UniformName& name, const Vec4f& data)
 	{
-		GLCall(glUniform4f(shaderDataArray[shader.shaderID].getUniformLocation(name), data.x, data.y, data.z, data.w));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniform4f(uniform.location, data.x, data.y, data.z, data.w));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<int>(const Shader& shader, const std::string& name, const int& data)
+	void SnackerEngine::ShaderManager::setUniform<int>(const Shader& shader, const UniformName& name, const int& data)
 	{
-		GLCall(glUniform1i(shaderDataArray[shader.shaderID].getUniformLocation(name), data));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniform1i(uniform.location, data));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<Mat3f>(const Shader& shader, const std::string& name, const Mat3f& data)
+	void SnackerEngine::ShaderManager::setUniform<Mat3f>(const Shader& shader, const UniformName& name, const Mat3f& data)
 	{
-		GLCall(glUniformMatrix3fv(shaderDataArray[shader.shaderID].getUniformLocation(name), 1, GL_TRUE, &(data.data[0])));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniformMatrix3fv(uniform.location, 1, GL_TRUE, &(data.data[0])));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<Mat4f>(const Shader& shader, const std::string& name, const Mat4f& data)
+	void SnackerEngine::ShaderManager::setUniform<Mat4f>(const Shader& shader, const UniformName& name, const Mat4f& data)
 	{
-		GLCall(glUniformMatrix4fv(shaderDataArray[shader.shaderID].getUniformLocation(name), 1, GL_TRUE, &(data.data[0])));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniformMatrix4fv(uniform.location, 1, GL_TRUE, &(data.data[0])));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<Color3f>(const Shader& shader, const std::string& name, const Color3f& data)
+	void SnackerEngine::ShaderManager::setUniform<Color3f>(const Shader& shader, const UniformName& name, const Color3f& data)
 	{
-		GLCall(glUniform3f(shaderDataArray[shader.shaderID].getUniformLocation(name), data.r, data.g, data.b));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniform3f(uniform.location, data.r, data.g, data.b));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<Color4f>(const Shader& shader, const std::string& name, const Color4f& data)
+	void SnackerEngine::ShaderManager::setUniform<Color4f>(const Shader& shader, const UniformName& name, const Color4f& data)
 	{
-		GLCall(glUniform4f(shaderDataArray[shader.shaderID].getUniformLocation(name), data.r, data.g, data.b, data.alpha));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniform4f(uniform.location, data.r, data.g, data.b, data.alpha));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<Vec2i>(const Shader& shader, const std::string& name, const Vec2i& data)
+	void SnackerEngine::ShaderManager::setUniform<Vec2i>(const Shader& shader, const UniformName& name, const Vec2i& data)
 	{
-		GLCall(glUniform2i(shaderDataArray[shader.shaderID].getUniformLocation(name), data.x, data.y));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniform2i(uniform.location, data.x, data.y));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<Vec3i>(const Shader& shader, const std::string& name, const Vec3i& data)
+	void SnackerEngine::ShaderManager::setUniform<Vec3i>(const Shader& shader, const UniformName& name, const Vec3i& data)
 	{
-		GLCall(glUniform3i(shaderDataArray[shader.shaderID].getUniformLocation(name), data.x, data.y, data.z));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniform3i(uniform.location, data.x, data.y, data.z));
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::ShaderManager::setUniform<Vec4i>(const Shader& shader, const std::string& name, const Vec4i& data)
+	void SnackerEngine::ShaderManager::setUniform<Vec4i>(const Shader& shader, const UniformName& name, const Vec4i& data)
 	{
-		GLCall(glUniform4i(shaderDataArray[shader.shaderID].getUniformLocation(name), data.x, data.y, data.z, data.w));
+		UniformData& uniform = shaderDataArray[shader.shaderID].getUniform(name);
+		if (!uniform.prepareUpload(data)) return;
+		GLCall(glUniform4i(uniform.location, data.x, data.y, data.z, data.w));
 	}
 	//------------------------------------------------------------------------------------------------------
 	void ShaderManager::setModelViewProjection(const Shader& shader, const Mat4f& model, const Mat4f& view, const Mat4f& projection)
 	{
-		setUniform<Mat4f>(shader, "u_model", model);
-		setUniform<Mat4f>(shader, "u_view", view);
-		setUniform<Mat4f>(shader, "u_projection", projection);
+		static constexpr UniformName modelUniform{ "u_model" };
+		static constexpr UniformName viewUniform{ "u_view" };
+		static constexpr UniformName projectionUniform{ "u_projection" };
+		setUniform<Mat4f>(shader, modelUniform, model);
+		setUniform<Mat4f>(shader, viewUniform, view);
+		setUniform<Mat4f>(shader, projectionUniform, projection);
 	}
 	//------------------------------------------------------------------------------------------------------
 	const ShaderManager::ShaderData& ShaderManager::getShaderData(const Shader& shader)
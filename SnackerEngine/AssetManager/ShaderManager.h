@@ -6,6 +6,7 @@
 #include "Math/Mat.h"
 
 #include <vector>
+#include <array>
 #include <queue>
 #include <unordered_map>
 #include <string_view>
@@ -15,6 +16,27 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	class ShaderManager
 	{
+		/// This struct stores the location of a single uniform of a shader
+		struct UniformData
+		{
+			// Hash of the name, see UniformName
+			std::uint32_t hash{};
+			// Location of the uniform. -1 if the uniform does not exist
+			int location = -1;
+			// Name of the uniform. Used to resolve hash collisions
+			std::string name{};
+			// Shadow copy of the value that was uploaded last, used to skip uploading the same value again
+			std::array<std::uint32_t, 16> value{};
+			// Size of the shadow copy in bytes. Zero if no value was uploaded yet
+			unsigned int valueSize = 0;
+			/// Returns true if the given value differs from the shadow copy and updates the shadow copy
+			template<typename T>
+			bool updateValue(const T& data);
+			/// Updates the shadow copy and records the upload in the CommandLog. Returns true if the
+			/// value actually has to be sent to OpenGL
+			template<typename T>
+			bool prepareUpload(const T& data);
+		};
 		/// This struct stores all the data that is necessary to store for each shader
 		struct ShaderData
 		{
@@ -28,13 +50,18 @@ namespace SnackerEngine
 			bool valid = false;
 			// File path of the shader. If the shader was not loaded from a file this should be an empty string.
 			std::string path{};
+			// Flat table of all uniforms. Filled with the active uniforms when the shader is linked,
+			// other uniforms (eg. single array elements) are added when they are first used
+			std::vector<UniformData> uniforms{};
 			// Destructor. Deletes the shader from the GPU if it was loaded.
 			~ShaderData();
 
 			/// Binds this shader
 			void bind() const;
-			/// Returns the location of an uniform (location identifier is just an integer)
-			int getUniformLocation(const std::string& name) const;
+			/// Fills the uniforms table with all active uniforms of the linked shader program
+			void reflectUniforms();
+			/// Returns the entry of the given uniform in the uniforms table, adds it if necessary
+			UniformData& getUniform(const UniformName& name);
 		};
 		/// We just use unsigned ints as shaderIDs. The IDs are also indices into the shaderDataArray!
 		using ShaderID = unsigned int;
@@ -77,7 +104,7 @@ namespace SnackerEngine
 		static void terminate();
 		/// Setting uniforms
 		template<typename T>
-		static void setUniform(const Shader& shader, const std::string& name, const T& data);
+		static void setUniform(const Shader& shader, const UniformName& name, const T& data);
 		/// Set model, view and projection matrix uniforms all at once
 		static void setModelViewProjection(const Shader& shader, const Mat4f& model, const Mat4f& view, const Mat4f& projection);
 		/// Returns a const refrence to the corresponding ShaderData object
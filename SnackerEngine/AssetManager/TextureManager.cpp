@@ -3,6 +3,9 @@
 #include "Core/Log.h"
 #include "Core/Engine.h"
 #include "Graphics/FrameBuffer.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/GLState.h"
+#include "Graphics/CommandLog.h"
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
@@ -18,8 +21,9 @@ namespace SnackerEngine
 	//======================================================================================================
 	TextureManager::TextureData::~TextureData()
 	{
-		if (valid) {
-			GLCall(glDeleteTextures(1, &GPU_ID));
+		if (valid && GPU_ID != 0) {
+			if (!Renderer::isHeadless()) GLCall(glDeleteTextures(1, &GPU_ID));
+			GLState::onDeleteTexture(GPU_ID);
 		}
 	}
 	//------------------------------------------------------------------------------------------------------
@@ -35,8 +39,9 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	TextureManager::TextureData& TextureManager::TextureData::operator=(TextureData&& other) noexcept
 	{
-		if (valid) {
-			GLCall(glDeleteTextures(1, &GPU_ID));
+		if (valid && GPU_ID != 0) {
+			if (!Renderer::isHeadless()) GLCall(glDeleteTextures(1, &GPU_ID));
+			GLState::onDeleteTexture(GPU_ID);
 		}
 		GPU_ID = other.GPU_ID;
 		referenceCount = other.referenceCount;
@@ -57,13 +62,12 @@ namespace SnackerEngine
 	void TextureManager::TextureData::bind(const unsigned int& slot) const
 	{
 		if (valid) {
-			GLCall(glActiveTexture(GL_TEXTURE0 + slot));
 			switch (textureType)
 			{
 			case SnackerEngine::Texture::TextureType::TEXTURE2D:
-				GLCall(glBindTexture(GL_TEXTURE_2D, GPU_ID)); break;
+				GLState::bindTexture(GL_TEXTURE_2D, GPU_ID, slot); break;
 			case SnackerEngine::Texture::TextureType::CUBEMAP:
-				GLCall(glBindTexture(GL_TEXTURE_CUBE_MAP, GPU_ID));  break;
+				GLState::bindTexture(GL_TEXTURE_CUBE_MAP, GPU_ID, slot);  break;
 			default:
 				break;
 			}
@@ -117,6 +121,12 @@ namespace SnackerEngine
 		}
 	}
 	//------------------------------------------------------------------------------------------------------
+	std::size_t TextureManager::TextureData::computeSizeInBytes(const Vec2i& size) const
+	{
+		const std::size_t bytesPerComponent = textureDataType == Texture::TextureDataType::FLOAT ? sizeof(float) : sizeof(unsigned char);
+		return static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * determineNumberComponents() * bytesPerComponent;
+	}
+	//------------------------------------------------------------------------------------------------------
 	//======================================================================================================
 	// Helper functions for extracting GLenums
 	//======================================================================================================
@@ -273,24 +283,31 @@ namespace SnackerEngine
 	bool setUpTextureData(SnackerEngine::TextureManager::TextureData& textureData, int nrComponents, int width, int height, void* data, const std::string& fullPath)
 	{
 		textureData.determineTextureDataFormat(nrComponents);
-		GLCall(glGenTextures(1, &textureData.GPU_ID));
-		GLCall(glBindTexture(GL_TEXTURE_2D, textureData.GPU_ID));
-		GLenum internalFormat = getInternalFormatGL(textureData.textureDataPrecision, textureData.textureDataFormat, textureData.textureDataType);
-		GLCall(glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, getFormatGL(textureData.textureDataFormat), getTypeGL(textureData.textureDataType), data));
-		if (textureData.textureDataType == Texture::TextureDataType::FLOAT) {
-			GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
-			GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
-			GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-			GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+		// Only the meta data is kept in headless mode
+		if (Renderer::isHeadless()) {
+			textureData.GPU_ID = CommandLog::generateObjectName();
 		}
 		else {
-			// Only generate mipmap for non hdr textures (TODO: Why?)
-			GLCall(glGenerateMipmap(GL_TEXTURE_2D));
-			GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
-			GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
-			GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR));
-			GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+			GLCall(glGenTextures(1, &textureData.GPU_ID));
+			GLState::bindTexture(GL_TEXTURE_2D, textureData.GPU_ID, 0);
+			GLenum internalFormat = getInternalFormatGL(textureData.textureDataPrecision, textureData.textureDataFormat, textureData.textureDataType);
+			GLCall(glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, getFormatGL(textureData.textureDataFormat), getTypeGL(textureData.textureDataType), data));
+			if (textureData.textureDataType == Texture::TextureDataType::FLOAT) {
+				GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+				GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+				GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+				GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+			}
+			else {
+				// Only generate mipmap for non hdr textures (TODO: Why?)
+				GLCall(glGenerateMipmap(GL_TEXTURE_2D));
+				GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+				GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+				GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR));
+				GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+			}
 		}
+		CommandLog::recordTextureUpload(GL_TEXTURE_2D, textureData.GPU_ID, textureData.computeSizeInBytes(Vec2i(width, height)));
 		// Set remaining parameters
 		textureData.size = Vec2i(width, height);
 		textureData.path = fullPath;
@@ -345,8 +362,14 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	static void createTexture2D(TextureManager::TextureData& textureData, const bool& mip)
 	{
+		// Only the meta data is kept in headless mode
+		if (Renderer::isHeadless()) {
+			textureData.GPU_ID = CommandLog::generateObjectName();
+			textureData.valid = true;
+			return;
+		}
 		GLCall(glGenTextures(1, &textureData.GPU_ID));
-		GLCall(glBindTexture(GL_TEXTURE_2D, textureData.GPU_ID));
+		GLState::bindTexture(GL_TEXTURE_2D, textureData.GPU_ID, 0);
 		GLenum internalFormat = getInternalFormatGL(textureData.textureDataPrecision, textureData.textureDataFormat, textureData.textureDataType);
 		GLCall(glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, textureData.size.x, textureData.size.y, 0, getFormatGL(textureData.textureDataFormat), getTypeGL(textureData.textureDataType), NULL));
 		GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
@@ -366,8 +389,14 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	static void createTextureCubemap(TextureManager::TextureData& textureData, const bool& mip)
 	{
+		// Only the meta data is kept in headless mode
+		if (Renderer::isHeadless()) {
+			textureData.GPU_ID = CommandLog::generateObjectName();
+			textureData.valid = true;
+			return;
+		}
 		GLCall(glGenTextures(1, &textureData.GPU_ID));
-		GLCall(glBindTexture(GL_TEXTURE_CUBE_MAP, textureData.GPU_ID));
+		GLState::bindTexture(GL_TEXTURE_CUBE_MAP, textureData.GPU_ID, 0);
 		GLenum internalFormatGL = getInternalFormatGL(textureData.textureDataPrecision, textureData.textureDataFormat, textureData.textureDataType);
 		GLenum formatGL = getFormatGL(textureData.textureDataFormat);
 		GLenum typeGL = getTypeGL(textureData.textureDataType);
@@ -437,6 +466,8 @@ namespace SnackerEngine
 	void TextureManager::fillTexture2D(Texture& texture, const void* data, const bool& mip)
 	{
 		const TextureData& textureData = textureDataArray[texture.textureID];
+		CommandLog::recordTextureUpload(GL_TEXTURE_2D, textureData.GPU_ID, textureData.computeSizeInBytes(textureData.size));
+		if (Renderer::isHeadless()) return;
 		textureData.bind();
 		GLCall(glTextureSubImage2D(textureData.GPU_ID, 0, 0, 0, textureData.size.x, textureData.size.y, getFormatGL(textureData.textureDataFormat), getTypeGL(textureData.textureDataType), data));
 		if (mip) {
@@ -447,6 +478,8 @@ namespace SnackerEngine
 	void TextureManager::fillTexture2D(Texture& texture, const void* data, const Vec2i& offset, const Vec2i& size, const bool& mip)
 	{
 		const TextureData& textureData = textureDataArray[texture.textureID];
+		CommandLog::recordTextureUpload(GL_TEXTURE_2D, textureData.GPU_ID, textureData.computeSizeInBytes(size));
+		if (Renderer::isHeadless()) return;
 		textureData.bind();
 		GLCall(glTextureSubImage2D(textureData.GPU_ID, 0, offset.x, offset.y, size.x, size.y, getFormatGL(textureData.textureDataFormat), getTypeGL(textureData.textureDataType), data));
 		if (mip) {
@@ -457,8 +490,9 @@ namespace SnackerEngine
 	void TextureManager::resize(Texture& texture, const Vec2i& size, const bool& mip)
 	{
 		TextureData& textureData = textureDataArray[texture.textureID];
-		if (textureData.valid) {
-			GLCall(glDeleteTextures(1, &textureData.GPU_ID));
+		if (textureData.valid && textureData.GPU_ID != 0) {
+			if (!Renderer::isHeadless()) GLCall(glDeleteTextures(1, &textureData.GPU_ID));
+			GLState::onDeleteTexture(textureData.GPU_ID);
 		}
 		textureData.size = size;
 		if (textureData.textureType == Texture::TextureType::CUBEMAP) {
@@ -543,8 +577,8 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	void TextureManager::unbindAll()
 	{
-		GLCall(glBindTexture(GL_TEXTURE_2D, 0));
-		GLCall(glBindTexture(GL_TEXTURE_CUBE_MAP, 0));
+		GLState::bindTexture(GL_TEXTURE_2D, 0, 0);
+		GLState::bindTexture(GL_TEXTURE_CUBE_MAP, 0, 0);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void TextureManager::terminate()
@@ -599,6 +633,8 @@ namespace SnackerEngine
 	TextureDataBuffer TextureManager::getTextureDataFromGPU(Texture& texture, const int& mipLevel)
 	{
 		TextureDataBuffer buffer(texture);
+		// In headless mode, no data is stored and the buffer is returned as is
+		if (Renderer::isHeadless()) return buffer;
 		texture.bind();
 		GLCall(glGetTexImage(GL_TEXTURE_2D, mipLevel, getFormatGL(buffer.textureDataFormat), getTypeGL(buffer.textureDataType), (void*)buffer.getDataPtr()));
 		return buffer;
@@ -741,6 +777,7 @@ namespace SnackerEngine
 			warningLogger << LOGGER::BEGIN << "tried to copy 2D texture into texture that was too small" << LOGGER::ENDL;
 			return;
 		}
+		if (Renderer::isHeadless()) return;
 		FrameBuffer framebuffer(sourceSize, false, false);
 		framebuffer.attachTexture(source);
 		framebuffer.finalize();
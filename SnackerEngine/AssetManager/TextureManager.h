@@ -50,6 +50,8 @@ namespace SnackerEngine
 			void determineTextureDataFormat(const int& nrComponents);
 			/// Computes the number of components (channels)
 			int determineNumberComponents() const;
+			/// Computes the number of bytes of a region of the given size in pixels
+			std::size_t computeSizeInBytes(const Vec2i& size) const;
 		};
 		/// We just use unsigned ints as TextureIDs. The IDs are also indices into the textureDataArray!
 		using TextureID = unsigned int;
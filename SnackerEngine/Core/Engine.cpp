@@ -1,5 +1,8 @@
 #include "Engine.h"
 #include "AssetManager/AssetManager.h"
+#include "AssetManager/FontManager.h"
+#include "Gui/Text/TextLayoutCache.h"
+#include "Gui/Text/InstancedTextMesh.h"
 #include "Graphics/Renderer.h"
 #include "Core/Log.h"
 #include "Utility\Timer.h"
@@ -163,12 +166,33 @@ namespace SnackerEngine
 		return true;
 	}
 	//------------------------------------------------------------------------------------------------------
+	bool Engine::initializeHeadless(const std::string& resourceFolderPath, const Vec2i& screenDimensions)
+	{
+		// Seed RNG
+		initializeRNG();
+		// No window is created, all GPU resources and commands are recorded on the CPU instead
+		Renderer::headless = true;
+		Renderer::screenDims = screenDimensions;
+		Renderer::currentViewPort = screenDimensions;
+		// Search for resource path
+		if (!determineResourcePath(resourceFolderPath))
+			return false;
+		// Initialize AssetManager class
+		AssetManager::initialize();
+		/// Initialize GuiManager
+		GuiManager::initialize();
+		return true;
+	}
+	//------------------------------------------------------------------------------------------------------
 	void Engine::terminate()
 	{
 		GuiManager::terminate();
+		// The text layout cache holds references to models and fonts
+		TextLayoutCache::clear();
+		InstancedTextMesh::terminate();
 		AssetManager::terminate();
 		//NetworkManager::cleanup();
-		Renderer::terminate();
+		if (!Renderer::isHeadless()) Renderer::terminate();
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Engine::setActiveScene(Scene& scene)
@@ -191,6 +215,10 @@ namespace SnackerEngine
 			long long microseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(now - lastUpdateTime).count();
 			double dt = (double(microseconds) / 1'000'000'000.0f);
 			
+			// Add glyphs that were generated in the background to the font atlases, such that
+			// texts waiting for them are recomputed in the update step
+			FontManager::update();
+
 			// Update active scene
 			activeScene->update(dt);
 			
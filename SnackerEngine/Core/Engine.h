@@ -48,6 +48,12 @@ namespace SnackerEngine
 	public:
 		/// Initializes the engine and creates a window
 		static bool initialize(const int& windowWidth, const int& windowHeight, const std::string& windowName, const std::string& resourceFolderPath = "");
+		/// Initializes the engine without creating a window or an OpenGL context. Meshes and textures are
+		/// only recorded on the CPU, fonts still load their glyph metrics and MSDF bitmaps. Nothing is
+		/// drawn in this mode, but all draw calls, uploads and state changes are recorded by the CommandLog,
+		/// such that text layout, GUI drawing and other CPU side work can be tested and benchmarked.
+		/// screenDimensions are used as the size of the (non existent) window
+		static bool initializeHeadless(const std::string& resourceFolderPath = "", const Vec2i& screenDimensions = Vec2i(1920, 1080));
 		/// Terminates the engine
 		static void terminate();
 		/// Sets the active scene
@@ -21,7 +21,7 @@ namespace SnackerEngine
 		computePitchAndYawFromDirectionAndTarget();
 		computeProjection();
 		computeView();
-		viewProjMatrix = viewMatrix * projectionMatrix;
+		viewProjMatrix = projectionMatrix * viewMatrix;
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Camera::computeDirectionAndTargetFromPitchAndYaw()
@@ -61,13 +61,13 @@ namespace SnackerEngine
 		default:
 			break;
 		}
-		viewProjMatrix = viewMatrix * projectionMatrix;
+		viewProjMatrix = projectionMatrix * viewMatrix;
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Camera::computeProjection()
 	{
 		projectionMatrix = Mat4f::PerspectiveProjection(fovy, aspect, near, far);
-		viewProjMatrix = viewMatrix * projectionMatrix;
+		viewProjMatrix = projectionMatrix * viewMatrix;
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Camera::setTargetVector(const Vec3f& target)
@@ -173,11 +173,21 @@ namespace SnackerEngine
 		return viewProjMatrix;
 	}
 	//------------------------------------------------------------------------------------------------------
+	Frustum Camera::getFrustum() const
+	{
+		return Frustum::FromViewProjection(viewProjMatrix);
+	}
+	//------------------------------------------------------------------------------------------------------
 	Vec3f Camera::getPosition() const
 	{
 		return position;
 	}
 	//------------------------------------------------------------------------------------------------------
+	float Camera::getFov() const
+	{
+		return fovy;
+	}
+	//------------------------------------------------------------------------------------------------------
 	float Camera::getNearPlane() const
 	{
 		return near;
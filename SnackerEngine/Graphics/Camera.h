@@ -2,6 +2,7 @@
 
 #include "Math/Vec.h"
 #include "Math/Mat.h"
+#include "Math/BoundingVolumes.h"
 
 namespace SnackerEngine
 {
@@ -20,7 +21,7 @@ namespace SnackerEngine
 		Mat4f viewMatrix;
 		/// Projection matrix
 		Mat4f projectionMatrix;
-		/// View Matrix * Projection Matrix
+		/// Projection Matrix * View Matrix
 		Mat4f viewProjMatrix;
 		/// Position of the camera
 		Vec3f position;
@@ -55,7 +56,7 @@ namespace SnackerEngine
 		~Camera();
 		/// Computes the view matrix
 		void computeView();
-		/// Computes the view matrix and multiplies it with the projection matrix
+		/// Computes the projection matrix and multiplies it with the view matrix
 		void computeProjection();
 		/// Getters and Setters
 		virtual void setTargetVector(const Vec3f& target); /// Sets mode to TARGET
@@ -73,7 +74,10 @@ namespace SnackerEngine
 		Mat4f getViewMatrix() const;
 		Mat4f getProjectionMatrix() const;
 		Mat4f getViewProjectionMatrix() const;
+		/// Returns the view frustum of the camera in world space, extracted from the view projection matrix
+		Frustum getFrustum() const;
 		Vec3f getPosition() const;
+		float getFov() const;
 		float getNearPlane() const;
 		float getFarPlane() const;
 
@@ -0,0 +1,85 @@
+#include "Graphics/CommandLog.h"
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	CommandLog::FrameStatistics CommandLog::currentFrameStatistics{};
+	CommandLog::FrameStatistics CommandLog::lastFrameStatistics{};
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::push(const Command& command)
+	{
+		if (recording) commands.push_back(command);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::setRecording(bool recording)
+	{
+		CommandLog::recording = recording;
+	}
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::clear()
+	{
+		commands.clear();
+		currentFrameStatistics = FrameStatistics{};
+	}
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::recordDraw(unsigned int vertexArray, unsigned int indexCount, unsigned int instanceCount)
+	{
+		currentFrameStatistics.drawCalls++;
+		currentFrameStatistics.instances += instanceCount == 0 ? 1 : instanceCount;
+		currentFrameStatistics.indices += indexCount;
+		push(Command{ instanceCount == 0 ? CommandType::DRAW : CommandType::DRAW_INSTANCED, 0, vertexArray, 0, indexCount, instanceCount });
+	}
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::recordBufferUpload(unsigned int target, unsigned int buffer, std::size_t byteCount)
+	{
+		currentFrameStatistics.bufferUploads++;
+		currentFrameStatistics.bufferBytesUploaded += byteCount;
+		push(Command{ CommandType::BUFFER_UPLOAD, target, buffer, byteCount });
+	}
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::recordTextureUpload(unsigned int target, unsigned int texture, std::size_t byteCount)
+	{
+		currentFrameStatistics.textureUploads++;
+		currentFrameStatistics.textureBytesUploaded += byteCount;
+		push(Command{ CommandType::TEXTURE_UPLOAD, target, texture, byteCount });
+	}
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::recordUniform(int location, std::size_t byteCount)
+	{
+		currentFrameStatistics.uniformUploads++;
+		currentFrameStatistics.uniformBytesUploaded += byteCount;
+		push(Command{ CommandType::UNIFORM, 0, static_cast<unsigned int>(location), byteCount });
+	}
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::recordElidedUniform()
+	{
+		currentFrameStatistics.uniformUploadsElided++;
+	}
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::recordStateChange(unsigned int target, unsigned int object, bool elided)
+	{
+		if (elided) {
+			currentFrameStatistics.stateChangesElided++;
+			return;
+		}
+		currentFrameStatistics.stateChanges++;
+		push(Command{ CommandType::STATE_CHANGE, target, object });
+	}
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::recordClear()
+	{
+		push(Command{ CommandType::CLEAR });
+	}
+	//------------------------------------------------------------------------------------------------------
+	void CommandLog::endFrame()
+	{
+		lastFrameStatistics = currentFrameStatistics;
+		currentFrameStatistics = FrameStatistics{};
+	}
+	//------------------------------------------------------------------------------------------------------
+	unsigned int CommandLog::generateObjectName()
+	{
+		return ++lastObjectName;
+	}
+	//------------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	/// Records the commands that the engine sends to the GPU: draw calls, buffer and texture uploads,
+	/// uniform uploads and state changes, together with the number of bytes that were moved.
+	/// Per frame statistics are always gathered. The full command list is only kept while recording is
+	/// enabled (see setRecording()).
+	/// In headless mode (see Renderer::isHeadless()) nothing is sent to the GPU and this class acts as
+	/// the backend: objects get names from generateObjectName() and every command ends up here instead.
+	/// Note that it is a fully static class that cannot be constructed
+	class CommandLog
+	{
+	public:
+		/// Enum for the different types of commands
+		enum class CommandType : unsigned char
+		{
+			DRAW,				/// glDrawElements()
+			DRAW_INSTANCED,		/// glDrawElementsInstanced()
+			BUFFER_UPLOAD,		/// glBufferData() or glBufferSubData()
+			TEXTURE_UPLOAD,		/// glTexImage*() or glTexSubImage*()
+			UNIFORM,			/// glUniform*()
+			STATE_CHANGE,		/// Bind calls, glEnable(), glDisable(), glBlendFunc(), glScissor()
+			CLEAR,				/// glClear()
+		};
+		/// A single recorded command
+		struct Command
+		{
+			CommandType type;
+			/// OpenGL enum describing the target of the command (eg. GL_ARRAY_BUFFER, GL_TEXTURE_2D, GL_BLEND),
+			/// or 0 if there is none
+			unsigned int target = 0;
+			/// Name of the object the command refers to (buffer, texture, vertex array, program), or the
+			/// uniform location for UNIFORM commands
+			unsigned int object = 0;
+			/// Number of bytes that were sent to the GPU
+			std::size_t byteCount = 0;
+			/// Number of indices for draw calls
+			unsigned int count = 0;
+			/// Number of instances for draw calls
+			unsigned int instanceCount = 0;
+		};
+		/// Statistics of a single frame
+		struct FrameStatistics
+		{
+			unsigned int drawCalls = 0;
+			unsigned int instances = 0;
+			std::size_t indices = 0;
+			unsigned int bufferUploads = 0;
+			std::size_t bufferBytesUploaded = 0;
+			unsigned int textureUploads = 0;
+			std::size_t textureBytesUploaded = 0;
+			unsigned int uniformUploads = 0;
+			std::size_t uniformBytesUploaded = 0;
+			/// Number of uniform uploads that were skipped because the value did not change
+			unsigned int uniformUploadsElided = 0;
+			/// Number of state changes that were issued and that were skipped because they were
+			/// redundant (see GLState)
+			unsigned int stateChanges = 0;
+			unsigned int stateChangesElided = 0;
+			/// Returns the total number of bytes uploaded to the GPU
+			std::size_t getBytesUploaded() const { return bufferBytesUploaded + textureBytesUploaded + uniformBytesUploaded; }
+		};
+	private:
+		/// If this is set to true, every command is appended to commands
+		inline static bool recording = false;
+		/// The recorded commands
+		inline static std::vector<Command> commands{};
+		/// Statistics of the current and the last frame. Defined in the source file, since FrameStatistics
+		/// is not complete yet
+		static FrameStatistics currentFrameStatistics;
+		static FrameStatistics lastFrameStatistics;
+		/// The last object name that was handed out in headless mode
+		inline static unsigned int lastObjectName = 0;
+		/// Appends the command if recording is enabled
+		static void push(const Command& command);
+	public:
+		/// Enables or disables recording of the full command list. Statistics are gathered in any case
+		static void setRecording(bool recording);
+		/// Returns true if the full command list is recorded
+		static bool isRecording() { return recording; }
+		/// Returns all commands that were recorded since the last call to clear()
+		static const std::vector<Command>& getCommands() { return commands; }
+		/// Clears the recorded commands and the statistics of the current frame
+		static void clear();
+		/// Records a draw call. instanceCount is 0 for non-instanced draw calls
+		static void recordDraw(unsigned int vertexArray, unsigned int indexCount, unsigned int instanceCount = 0);
+		/// Records an upload of byteCount bytes to the buffer bound to the given target
+		static void recordBufferUpload(unsigned int target, unsigned int buffer, std::size_t byteCount);
+		/// Records an upload of byteCount bytes to the texture bound to the given target
+		static void recordTextureUpload(unsigned int target, unsigned int texture, std::size_t byteCount);
+		/// Records an upload of a uniform value of byteCount bytes
+		static void recordUniform(int location, std::size_t byteCount);
+		/// Records a uniform upload that was skipped because the value did not change
+		static void recordElidedUniform();
+		/// Records a state change of the given target. elided is true if the change was skipped because
+		/// it was redundant
+		static void recordStateChange(unsigned int target, unsigned int object, bool elided);
+		/// Records a call to glClear()
+		static void recordClear();
+		/// Ends the current frame. Is called by Renderer::swapBuffers()
+		static void endFrame();
+		/// Returns the statistics of the current frame
+		static const FrameStatistics& getCurrentFrameStatistics() { return currentFrameStatistics; }
+		/// Returns the statistics of the last finished frame
+		static const FrameStatistics& getLastFrameStatistics() { return lastFrameStatistics; }
+		/// Returns a new unique object name. Is used in headless mode instead of glGen*() and glCreate*()
+		static unsigned int generateObjectName();
+		/// Deleted constructor: this is a static class!
+		CommandLog() = delete;
+	};
+	//------------------------------------------------------------------------------------------------------
+}
@@ -2,6 +2,8 @@
 #include "Core/Log.h"
 #include "Core/Assert.h"
 #include "AssetManager/TextureManager.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/CommandLog.h"
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
@@ -77,6 +79,12 @@ namespace SnackerEngine
 			warningLogger << LOGGER::BEGIN << "textures have to be initialized before using with a framebuffer!" << LOGGER::ENDL;
 			return;
 		}
+		if (Renderer::isHeadless())
+		{
+			GPU_ID = CommandLog::generateObjectName();
+			valid = true;
+			return;
+		}
 		// First, generate the frame buffer
 		GLCall(glGenFramebuffers(1, &GPU_ID));
 		// bind it
@@ -133,7 +141,7 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	FrameBuffer::~FrameBuffer()
 	{
-		if (valid)
+		if (valid && !Renderer::isHeadless())
 		{
 			if (doDepthTesting || doStencilTesting)
 			{
@@ -152,12 +160,16 @@ namespace SnackerEngine
 			return;
 		}
 #endif // _DEBUG
+		CommandLog::recordStateChange(GL_FRAMEBUFFER, GPU_ID, false);
+		if (Renderer::isHeadless()) return;
 		GLCall(glBindFramebuffer(GL_FRAMEBUFFER, GPU_ID));
 		GLCall(glBindRenderbuffer(GL_RENDERBUFFER, renderBufferID));
 	}
 	//--------------------------------------------------------------------------------------------------
 	void FrameBuffer::unbindAllTargets()
 	{
+		CommandLog::recordStateChange(GL_FRAMEBUFFER, 0, false);
+		if (Renderer::isHeadless()) return;
 		GLCall(glBindFramebuffer(GL_FRAMEBUFFER, 0));
 	}
 	//--------------------------------------------------------------------------------------------------
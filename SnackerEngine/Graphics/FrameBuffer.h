@@ -43,6 +43,8 @@ namespace SnackerEngine
 		void bindTexture(const unsigned int& slot = 0);
 		/// Returns the FrameBuffer texture
 		const Texture& getTexture() { return texture; }
+		/// Returns true if the FrameBuffer was finalized successfully
+		bool isValid() const { return valid; }
 		/// Resizes the FrameBuffer
 		void resize(const Vec2i& dimensions);
 	};
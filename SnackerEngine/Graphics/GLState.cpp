@@ -0,0 +1,189 @@
+#include "Graphics/GLState.h"
+#include "Graphics/CommandLog.h"
+#include "Graphics/Renderer.h"
+#include "Core/Assert.h"
+
+#include <GL/glew.h>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	void GLState::setCapability(CapabilityState& state, unsigned int capability, bool enable)
+	{
+		const CapabilityState newState = enable ? CapabilityState::ENABLED : CapabilityState::DISABLED;
+		if (state == newState) {
+			CommandLog::recordStateChange(capability, enable, true);
+			return;
+		}
+		if (!Renderer::isHeadless()) {
+			if (enable) {
+				GLCall(glEnable(capability));
+			}
+			else {
+				GLCall(glDisable(capability));
+			}
+		}
+		state = newState;
+		CommandLog::recordStateChange(capability, enable, false);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::setActiveTextureUnit(unsigned int slot)
+	{
+		if (activeTextureUnit == slot) {
+			CommandLog::recordStateChange(GL_ACTIVE_TEXTURE, slot, true);
+			return;
+		}
+		if (!Renderer::isHeadless()) GLCall(glActiveTexture(GL_TEXTURE0 + slot));
+		activeTextureUnit = slot;
+		CommandLog::recordStateChange(GL_ACTIVE_TEXTURE, slot, false);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::invalidate()
+	{
+		program = unknown;
+		vertexArray = unknown;
+		arrayBuffer = unknown;
+		elementArrayBuffer = unknown;
+		activeTextureUnit = unknown;
+		textures2D.fill(unknown);
+		texturesCubeMap.fill(unknown);
+		depthTest = CapabilityState::UNKNOWN;
+		blending = CapabilityState::UNKNOWN;
+		scissorTest = CapabilityState::UNKNOWN;
+		blendSourceFactor = unknown;
+		blendDestinationFactor = unknown;
+		scissorBoxKnown = false;
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::useProgram(unsigned int program)
+	{
+		if (GLState::program == program) {
+			CommandLog::recordStateChange(GL_CURRENT_PROGRAM, program, true);
+			return;
+		}
+		if (!Renderer::isHeadless()) GLCall(glUseProgram(program));
+		GLState::program = program;
+		CommandLog::recordStateChange(GL_CURRENT_PROGRAM, program, false);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::bindVertexArray(unsigned int vertexArray)
+	{
+		if (GLState::vertexArray == vertexArray) {
+			CommandLog::recordStateChange(GL_VERTEX_ARRAY_BINDING, vertexArray, true);
+			return;
+		}
+		if (!Renderer::isHeadless()) GLCall(glBindVertexArray(vertexArray));
+		GLState::vertexArray = vertexArray;
+		elementArrayBuffer = unknown;
+		CommandLog::recordStateChange(GL_VERTEX_ARRAY_BINDING, vertexArray, false);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::bindArrayBuffer(unsigned int buffer)
+	{
+		if (arrayBuffer == buffer) {
+			CommandLog::recordStateChange(GL_ARRAY_BUFFER, buffer, true);
+			return;
+		}
+		if (!Renderer::isHeadless()) GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+		arrayBuffer = buffer;
+		CommandLog::recordStateChange(GL_ARRAY_BUFFER, buffer, false);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::bindElementArrayBuffer(unsigned int buffer)
+	{
+		if (elementArrayBuffer == buffer && vertexArray != unknown) {
+			CommandLog::recordStateChange(GL_ELEMENT_ARRAY_BUFFER, buffer, true);
+			return;
+		}
+		if (!Renderer::isHeadless()) GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer));
+		elementArrayBuffer = buffer;
+		CommandLog::recordStateChange(GL_ELEMENT_ARRAY_BUFFER, buffer, false);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::bindTexture(unsigned int target, unsigned int texture, unsigned int slot)
+	{
+		// The active texture unit is always set, because callers may modify the bound texture afterwards
+		setActiveTextureUnit(slot);
+		unsigned int* boundTexture = nullptr;
+		if (slot < trackedTextureUnits) {
+			if (target == GL_TEXTURE_2D) boundTexture = &textures2D[slot];
+			else if (target == GL_TEXTURE_CUBE_MAP) boundTexture = &texturesCubeMap[slot];
+		}
+		if (boundTexture && *boundTexture == texture) {
+			CommandLog::recordStateChange(target, texture, true);
+			return;
+		}
+		if (!Renderer::isHeadless()) GLCall(glBindTexture(target, texture));
+		if (boundTexture) *boundTexture = texture;
+		CommandLog::recordStateChange(target, texture, false);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::setDepthTest(bool enable)
+	{
+		setCapability(depthTest, GL_DEPTH_TEST, enable);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::setBlending(bool enable)
+	{
+		setCapability(blending, GL_BLEND, enable);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::setScissorTest(bool enable)
+	{
+		setCapability(scissorTest, GL_SCISSOR_TEST, enable);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::setBlendFunction(unsigned int sourceFactor, unsigned int destinationFactor)
+	{
+		if (blendSourceFactor == sourceFactor && blendDestinationFactor == destinationFactor) {
+			CommandLog::recordStateChange(GL_BLEND_SRC, sourceFactor, true);
+			return;
+		}
+		if (!Renderer::isHeadless()) GLCall(glBlendFunc(sourceFactor, destinationFactor));
+		blendSourceFactor = sourceFactor;
+		blendDestinationFactor = destinationFactor;
+		CommandLog::recordStateChange(GL_BLEND_SRC, sourceFactor, false);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::setScissorBox(const Vec4i& scissorBox)
+	{
+		if (scissorBoxKnown && GLState::scissorBox == scissorBox) {
+			CommandLog::recordStateChange(GL_SCISSOR_BOX, 0, true);
+			return;
+		}
+		if (!Renderer::isHeadless()) GLCall(glScissor(scissorBox.x, scissorBox.y, scissorBox.z, scissorBox.w));
+		GLState::scissorBox = scissorBox;
+		scissorBoxKnown = true;
+		CommandLog::recordStateChange(GL_SCISSOR_BOX, 0, false);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::onDeleteProgram(unsigned int program)
+	{
+		if (GLState::program == program) GLState::program = unknown;
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::onDeleteVertexArray(unsigned int vertexArray)
+	{
+		if (GLState::vertexArray == vertexArray) {
+			GLState::vertexArray = 0;
+			elementArrayBuffer = unknown;
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::onDeleteBuffer(unsigned int buffer)
+	{
+		if (arrayBuffer == buffer) arrayBuffer = 0;
+		if (elementArrayBuffer == buffer) elementArrayBuffer = unknown;
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GLState::onDeleteTexture(unsigned int texture)
+	{
+		for (unsigned int& boundTexture : textures2D) {
+			if (boundTexture == texture) boundTexture = 0;
+		}
+		for (unsigned int& boundTexture : texturesCubeMap) {
+			if (boundTexture == texture) boundTexture = 0;
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Math/Vec.h"
+
+#include <array>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	/// Central tracker of the OpenGL state. The Renderer, the asset managers and the buffer classes route
+	/// state changes (bound program, vertex array, buffers, textures per unit, blending, depth test and
+	/// scissor test) through this class, which skips calls that would not change the state.
+	/// Issued and skipped calls are counted by the CommandLog. In headless mode (see Renderer::isHeadless())
+	/// the state is tracked as usual, but no OpenGL calls are made.
+	/// Code that changes the OpenGL state directly has to call invalidate() afterwards.
+	/// Note that it is a fully static class that cannot be constructed
+	class GLState
+	{
+	private:
+		/// Value used for bindings that are not known
+		static constexpr unsigned int unknown = 0xFFFFFFFF;
+		/// Number of texture units that are tracked. Binds to higher units are always issued
+		static constexpr unsigned int trackedTextureUnits = 32;
+		/// Enum for capabilities that can be enabled or disabled
+		enum class CapabilityState : unsigned char
+		{
+			UNKNOWN,
+			ENABLED,
+			DISABLED,
+		};
+		/// Bound objects
+		inline static unsigned int program = unknown;
+		inline static unsigned int vertexArray = unknown;
+		inline static unsigned int arrayBuffer = unknown;
+		/// The element array buffer binding is part of the vertex array state. It is only known
+		/// after it was set while the current vertex array was bound
+		inline static unsigned int elementArrayBuffer = unknown;
+		inline static unsigned int activeTextureUnit = unknown;
+		inline static std::array<unsigned int, trackedTextureUnits> textures2D{};
+		inline static std::array<unsigned int, trackedTextureUnits> texturesCubeMap{};
+		/// Capabilities
+		inline static CapabilityState depthTest = CapabilityState::UNKNOWN;
+		inline static CapabilityState blending = CapabilityState::UNKNOWN;
+		inline static CapabilityState scissorTest = CapabilityState::UNKNOWN;
+		inline static unsigned int blendSourceFactor = unknown;
+		inline static unsigned int blendDestinationFactor = unknown;
+		inline static Vec4i scissorBox{};
+		inline static bool scissorBoxKnown = false;
+		/// Enables or disables the given capability if necessary
+		static void setCapability(CapabilityState& state, unsigned int capability, bool enable);
+		/// Makes the given texture unit active if necessary
+		static void setActiveTextureUnit(unsigned int slot);
+	public:
+		/// Forgets all tracked state, such that the next call of every function is issued
+		static void invalidate();
+		/// Binds the given shader program
+		static void useProgram(unsigned int program);
+		/// Binds the given vertex array object
+		static void bindVertexArray(unsigned int vertexArray);
+		/// Binds the given buffer to GL_ARRAY_BUFFER
+		static void bindArrayBuffer(unsigned int buffer);
+		/// Binds the given buffer to GL_ELEMENT_ARRAY_BUFFER of the current vertex array object
+		static void bindElementArrayBuffer(unsigned int buffer);
+		/// Makes the given texture unit active and binds the given texture to the given target
+		/// (GL_TEXTURE_2D or GL_TEXTURE_CUBE_MAP) of that unit
+		static void bindTexture(unsigned int target, unsigned int texture, unsigned int slot);
+		/// Enables or disables depth testing, blending and the scissor test
+		static void setDepthTest(bool enable);
+		static void setBlending(bool enable);
+		static void setScissorTest(bool enable);
+		/// Sets the blend function
+		static void setBlendFunction(unsigned int sourceFactor, unsigned int destinationFactor);
+		/// Sets the scissor box (x, y, width, height)
+		static void setScissorBox(const Vec4i& scissorBox);
+		/// Have to be called when the corresponding objects are deleted, because OpenGL resets
+		/// bindings of deleted objects and reuses their names
+		static void onDeleteProgram(unsigned int program);
+		static void onDeleteVertexArray(unsigned int vertexArray);
+		static void onDeleteBuffer(unsigned int buffer);
+		static void onDeleteTexture(unsigned int texture);
+		/// Deleted constructor: this is a static class!
+		GLState() = delete;
+	};
+	//------------------------------------------------------------------------------------------------------
+}
@@ -1,15 +1,21 @@
 #include "Graphics/IndexBuffer.h"
 #include "Core/Assert.h"
 #include "Core/Log.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/GLState.h"
+#include "Graphics/CommandLog.h"
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
+#include <cstring>
+#include <type_traits>
+
 namespace SnackerEngine
 {
 	//------------------------------------------------------------------------------------------------------
 	IndexBuffer::IndexBuffer()
-		: valid(false), GPU_ID(0), indexCount(0) {}
+		: valid(false), GPU_ID(0), indexCount(0), indexType(GL_UNSIGNED_INT) {}
 	//------------------------------------------------------------------------------------------------------
 	IndexBuffer::IndexBuffer(const std::vector<unsigned int>& indices)
 		: IndexBuffer()
@@ -18,7 +24,8 @@ namespace SnackerEngine
 	}
 	//------------------------------------------------------------------------------------------------------
 	IndexBuffer::IndexBuffer(IndexBuffer&& ib) noexcept
-		: valid(ib.valid), GPU_ID(ib.GPU_ID), indexCount(ib.indexCount)
+		: valid(ib.valid), GPU_ID(ib.GPU_ID), indexCount(ib.indexCount), indexType(ib.indexType),
+		recordedData(std::move(ib.recordedData))
 	{
 		// Reset other ib
 		ib.valid = false;
@@ -32,6 +39,8 @@ namespace SnackerEngine
 		valid = ib.valid;
 		GPU_ID = ib.GPU_ID;
 		indexCount = ib.indexCount;
+		indexType = ib.indexType;
+		recordedData = std::move(ib.recordedData);
 		// Reset other ib
 		ib.valid = false;
 		ib.GPU_ID = 0;
@@ -42,15 +51,16 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	IndexBuffer::~IndexBuffer()
 	{
-		if (valid) {
-			GLCall(glDeleteBuffers(1, &GPU_ID));
+		if (valid && GPU_ID != 0) {
+			if (!Renderer::isHeadless()) GLCall(glDeleteBuffers(1, &GPU_ID));
+			GLState::onDeleteBuffer(GPU_ID);
 		}
 	}
 	//------------------------------------------------------------------------------------------------------
 	void IndexBuffer::bind() const
 	{
 		if (valid) {
-			GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, GPU_ID));
+			GLState::bindElementArrayBuffer(GPU_ID);
 		}
 		else {
 			warningLogger << LOGGER::BEGIN << "Tried to bind indexBuffer which was not initialized!" << LOGGER::ENDL;
@@ -59,7 +69,7 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	void IndexBuffer::unBind()
 	{
-		GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+		GLState::bindElementArrayBuffer(0);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void IndexBuffer::setIndices(const std::vector<unsigned int>& indices)
@@ -68,15 +78,68 @@ namespace SnackerEngine
 			warningLogger << LOGGER::BEGIN << "tried to set indices of already valid indexBuffer!" << LOGGER::ENDL;
 			return;
 		}
-#ifdef _DEBUG
-		ASSERT(sizeof(unsigned int) == sizeof(GLuint));
-#endif // _DEBUG
-
+		switch (selectIndexType(indices))
+		{
+		case GL_UNSIGNED_BYTE: uploadIndices<GLubyte>(indices); break;
+		case GL_UNSIGNED_SHORT: uploadIndices<GLushort>(indices); break;
+		default: uploadIndices<GLuint>(indices); break;
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	unsigned int IndexBuffer::selectIndexType(const std::vector<unsigned int>& indices)
+	{
+		unsigned int maxIndex = 0;
+		for (const unsigned int& index : indices) {
+			if (index > maxIndex) maxIndex = index;
+		}
+		if (maxIndex <= 0xFF) return GL_UNSIGNED_BYTE;
+		if (maxIndex <= 0xFFFF) return GL_UNSIGNED_SHORT;
+		return GL_UNSIGNED_INT;
+	}
+	//------------------------------------------------------------------------------------------------------
+	unsigned int IndexBuffer::getSizeOfIndexType(const unsigned int& indexType)
+	{
+		switch (indexType)
+		{
+		case GL_UNSIGNED_BYTE: return 1;
+		case GL_UNSIGNED_SHORT: return 2;
+		case GL_UNSIGNED_INT: return 4;
+		default: return 0;
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	void IndexBuffer::uploadIndices(const std::vector<unsigned int>& indices)
+	{
+		if (Renderer::isHeadless()) {
+			// Record the narrowed indices instead of moving them to the GPU
+			recordedData.resize(indices.size() * sizeof(T));
+			for (std::size_t i = 0; i < indices.size(); ++i) {
+				const T index = static_cast<T>(indices[i]);
+				std::memcpy(recordedData.data() + i * sizeof(T), &index, sizeof(T));
+			}
+			indexType = std::is_same_v<T, GLuint> ? GL_UNSIGNED_INT : std::is_same_v<T, GLushort> ? GL_UNSIGNED_SHORT : GL_UNSIGNED_BYTE;
+			GPU_ID = CommandLog::generateObjectName();
+			CommandLog::recordBufferUpload(GL_ELEMENT_ARRAY_BUFFER, GPU_ID, recordedData.size());
+			valid = true;
+			indexCount = static_cast<unsigned int>(indices.size());
+			return;
+		}
 		GLCall(glGenBuffers(1, &GPU_ID));
-		GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, GPU_ID));
+		GLState::bindElementArrayBuffer(GPU_ID);
 		// GL_ELEMENT_ARRAY_BUFFER for indices. STATIC_DRAW: see vertexBuffer header!
 		// TODO: maybe add more allowed modes (like DYNAMIC_DRAW)
-		GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW));
+		if constexpr (std::is_same_v<T, GLuint>) {
+			GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW));
+			indexType = GL_UNSIGNED_INT;
+		}
+		else {
+			// Narrow the indices. selectIndexType() made sure that no index is truncated
+			std::vector<T> narrowedIndices(indices.begin(), indices.end());
+			GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, narrowedIndices.size() * sizeof(T), narrowedIndices.data(), GL_STATIC_DRAW));
+			indexType = std::is_same_v<T, GLubyte> ? GL_UNSIGNED_BYTE : GL_UNSIGNED_SHORT;
+		}
+		CommandLog::recordBufferUpload(GL_ELEMENT_ARRAY_BUFFER, GPU_ID, indices.size() * sizeof(T));
 		valid = true;
 		indexCount = static_cast<unsigned int>(indices.size());
 	}
@@ -11,6 +11,15 @@ namespace SnackerEngine {
 		unsigned int GPU_ID;
 		/// Counts how many indices are stored
 		unsigned int indexCount;
+		/// The OpenGL type of the indices stored on the GPU. Can be GL_UNSIGNED_BYTE,
+		/// GL_UNSIGNED_SHORT or GL_UNSIGNED_INT, see setIndices()
+		unsigned int indexType;
+		/// Copy of the (narrowed) index data. Only used in headless mode, where there is no GPU
+		/// (see Renderer::isHeadless())
+		std::vector<unsigned char> recordedData;
+		/// Uploads the given index data to the GPU
+		template<typename T>
+		void uploadIndices(const std::vector<unsigned int>& indices);
 	public:
 		/// Standard constructor
 		IndexBuffer();
@@ -30,12 +39,25 @@ namespace SnackerEngine {
 		void bind() const;
 		/// Unbinds all IndexBuffer objects
 		static void unBind();
-		/// Sets the indices of this buffer
+		/// Sets the indices of this buffer. The smallest index type that can store the largest index is
+		/// chosen automatically: 8-bit indices for at most 256 vertices, 16-bit indices for at most 65536
+		/// vertices and 32-bit indices otherwise.
 		void setIndices(const std::vector<unsigned int>& indices);
+		/// Returns the smallest OpenGL index type (GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT or GL_UNSIGNED_INT)
+		/// that can store all of the given indices
+		static unsigned int selectIndexType(const std::vector<unsigned int>& indices);
+		/// Returns the size of the given OpenGL index type in bytes
+		static unsigned int getSizeOfIndexType(const unsigned int& indexType);
 		/// Checks if this IndexBuffer object is valid and corresponds to data on the GPU
 		bool isValid() { return valid; };
 		/// Returns the number of indices stored in this IndexBuffer object
 		unsigned int getCount() const { return indexCount; };
+		/// Returns the OpenGL type of the stored indices. Has to be passed to glDrawElements()
+		unsigned int getIndexType() const { return indexType; };
+		/// Returns the size of the index data stored on the GPU in bytes
+		unsigned int getSizeInBytes() const { return indexCount * getSizeOfIndexType(indexType); };
+		/// Returns the index data recorded on the CPU. Is empty if the engine is not running in headless mode
+		const std::vector<unsigned char>& getRecordedData() const { return recordedData; };
 	};
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -47,6 +47,16 @@ namespace SnackerEngine
 		return MeshManager::getMeshData(*this).vb;
 	}
 	//------------------------------------------------------------------------------------------------------
+	const AABB& Mesh::getBoundingBox() const
+	{
+		return MeshManager::getMeshData(*this).boundingBox;
+	}
+	//------------------------------------------------------------------------------------------------------
+	const BoundingSphere& Mesh::getBoundingSphere() const
+	{
+		return MeshManager::getMeshData(*this).boundingSphere;
+	}
+	//------------------------------------------------------------------------------------------------------
 	Mesh::~Mesh()
 	{
 		MeshManager::decreaseReferenceCount(*this);
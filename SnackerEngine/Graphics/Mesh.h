@@ -2,6 +2,7 @@
 
 #include "Graphics/VertexArray.h"
 #include "Graphics/IndexBuffer.h"
+#include "Math/BoundingVolumes.h"
 
 namespace SnackerEngine
 {
@@ -26,6 +27,10 @@ namespace SnackerEngine
 		const IndexBuffer& getIndexBuffer() const;
 		/// Returns the VertexBuffer object of this mesh
 		VertexBuffer& getVertexBuffer() const;
+		/// Returns the axis aligned bounding box of this mesh in model space
+		const AABB& getBoundingBox() const;
+		/// Returns the bounding sphere of this mesh in model space
+		const BoundingSphere& getBoundingSphere() const;
 		// Destructor
 		~Mesh();
 	};
@@ -8,12 +8,18 @@
 
 namespace SnackerEngine
 {
-	Mesh SnackerEngine::createMeshCircle(unsigned int subdivisions)
+	Mesh createMeshCircle(unsigned int subdivisions)
+	{
+		return MeshManager::createProceduralMesh(ProceduralMeshParameters::Circle(subdivisions));
+	}
+	//------------------------------------------------------------------------------------------------------
+	MeshGeometry createMeshGeometryCircle(unsigned int subdivisions)
 	{
 		if (subdivisions < 3) subdivisions = 3;
-		std::vector<float> vertices;
+		MeshGeometry geometry;
+		std::vector<float>& vertices = geometry.vertices;
 		vertices.reserve((static_cast<std::size_t>(subdivisions) + 1) * 2);
-		std::vector<unsigned int> indices;
+		std::vector<unsigned int>& indices = geometry.indices;
 		indices.reserve(subdivisions * 3);
 		vertices.push_back(0.5f); vertices.push_back(0.5f);
 		for (unsigned int i = 0; i < subdivisions; ++i) {
@@ -24,9 +30,8 @@ namespace SnackerEngine
 			indices.push_back(1 + i);
 			indices.push_back(1 + (i + 1) % subdivisions);
 		}
-		VertexBufferLayout layout;
-		layout.push<float>(2); // positions and texCoords
-		return MeshManager::createMesh(layout, vertices, indices);
+		geometry.layout.push<float>(2); // positions and texCoords
+		return geometry;
 	}
 
 }
@@ -1,12 +1,15 @@
 #pragma once
 
 #include "Graphics/Mesh.h"
+#include "Graphics/Meshes/ProceduralMeshes.h"
 
 namespace SnackerEngine
 {
 	//------------------------------------------------------------------------------------------------------
-	/// Helper function that creates a circle mesh. Should be called only by the meshManager.
+	/// Helper function that creates a circle mesh. Meshes with the same parameters are shared (see MeshManager::createProceduralMesh()).
 	/// Subdivisions should be at least 3.
 	Mesh createMeshCircle(unsigned int subdivisions = 10);
+	/// Generates the vertex and index data of a circle on the CPU
+	MeshGeometry createMeshGeometryCircle(unsigned int subdivisions = 10);
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -198,14 +198,22 @@ namespace SnackerEngine
 	};
 	//------------------------------------------------------------------------------------------------------
 	Mesh createMeshCube(const bool& TexCoords, const bool& Normals, const bool& Tangents)
+	{
+		return MeshManager::createProceduralMesh(ProceduralMeshParameters::Cube(TexCoords, Normals, Tangents));
+	}
+	//------------------------------------------------------------------------------------------------------
+	MeshGeometry createMeshGeometryCube(const bool& TexCoords, const bool& Normals, const bool& Tangents)
 	{
 		if (!TexCoords && !Normals && !Tangents) {
 			// only positions!
-			VertexBufferLayout layout;
-			layout.push<float>(3); // positions
-			return MeshManager::createMesh(layout, positionsCubeSmall, indicesCubeSmall);
+			MeshGeometry geometry;
+			geometry.layout.push<float>(3); // positions
+			geometry.vertices = positionsCubeSmall;
+			geometry.indices = indicesCubeSmall;
+			return geometry;
 		}
-		VertexBufferLayout layout;
+		MeshGeometry geometry;
+		VertexBufferLayout& layout = geometry.layout;
 		unsigned int totalVertexDataSize = static_cast<unsigned int>(positionsCubeLarge.size());
 		layout.push<float>(3); // positions
 		if (TexCoords) {
@@ -220,7 +228,7 @@ namespace SnackerEngine
 			totalVertexDataSize += static_cast<unsigned int>(tangentsCubeLarge.size());
 			layout.push<float>(3); // tangents
 		}
-		std::vector<float> vertices;
+		std::vector<float>& vertices = geometry.vertices;
 		vertices.reserve(totalVertexDataSize);
 		unsigned int index = 0;
 		for (unsigned int i = 0; i < 24; ++i) {
@@ -242,7 +250,8 @@ namespace SnackerEngine
 				vertices.push_back(tangentsCubeLarge[i * 3 + 2]);
 			}
 		}
-		return MeshManager::createMesh(layout, vertices, indicesCubeLarge);
+		geometry.indices = indicesCubeLarge;
+		return geometry;
 	}
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
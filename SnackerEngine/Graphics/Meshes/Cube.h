@@ -1,11 +1,14 @@
 #pragma once
 
 #include "Graphics/Mesh.h"
+#include "Graphics/Meshes/ProceduralMeshes.h"
 
 namespace SnackerEngine
 {
 	//------------------------------------------------------------------------------------------------------
-	/// Helper function that creates a cube mesh. Should be called only by the meshManager
+	/// Helper function that creates a cube mesh. Meshes with the same parameters are shared (see MeshManager::createProceduralMesh())
 	Mesh createMeshCube(const bool& TexCoords = false, const bool& Normals = false, const bool& Tangents = false);
+	/// Generates the vertex and index data of a cube on the CPU
+	MeshGeometry createMeshGeometryCube(const bool& TexCoords = false, const bool& Normals = false, const bool& Tangents = false);
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -44,7 +44,13 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	Mesh createMeshPlane(const bool& TexCoords, const bool& Normals, const bool& Tangents)
 	{
-		VertexBufferLayout layout;
+		return MeshManager::createProceduralMesh(ProceduralMeshParameters::Plane(TexCoords, Normals, Tangents));
+	}
+	//------------------------------------------------------------------------------------------------------
+	MeshGeometry createMeshGeometryPlane(const bool& TexCoords, const bool& Normals, const bool& Tangents)
+	{
+		MeshGeometry geometry;
+		VertexBufferLayout& layout = geometry.layout;
 		unsigned int totalVertexDataSize = static_cast<unsigned int>(positions.size());
 		layout.push<float>(3); // positions
 		if (TexCoords) {
@@ -59,7 +65,7 @@ namespace SnackerEngine
 			totalVertexDataSize += static_cast<unsigned int>(tangents.size());
 			layout.push<float>(3); // tangents
 		}
-		std::vector<float> vertices;
+		std::vector<float>& vertices = geometry.vertices;
 		vertices.reserve(totalVertexDataSize);
 		unsigned int index = 0;
 		for (unsigned int i = 0; i < 4; ++i) {
@@ -81,7 +87,8 @@ namespace SnackerEngine
 				vertices.push_back(tangents[i * 3 + 2]);
 			}
 		}
-		return MeshManager::createMesh(layout, vertices, indices);
+		geometry.indices = indices;
+		return geometry;
 	}
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
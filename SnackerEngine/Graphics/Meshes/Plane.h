@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Graphics/Mesh.h"
+#include "Graphics/Meshes/ProceduralMeshes.h"
 
 namespace SnackerEngine
 {
 	//------------------------------------------------------------------------------------------------------
 	Mesh createMeshPlane(const bool& TexCoords = false, const bool& Normals = false, const bool& Tangents = false);
+	/// Generates the vertex and index data of a plane on the CPU
+	MeshGeometry createMeshGeometryPlane(const bool& TexCoords = false, const bool& Normals = false, const bool& Tangents = false);
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
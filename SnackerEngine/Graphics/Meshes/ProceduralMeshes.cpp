@@ -0,0 +1,100 @@
+#include "Graphics/Meshes/ProceduralMeshes.h"
+#include "Graphics/Meshes/Sphere.h"
+#include "Graphics/Meshes/Cube.h"
+#include "Graphics/Meshes/Plane.h"
+#include "Graphics/Meshes/Circle.h"
+#include "Graphics/Meshes/Square.h"
+#include "Graphics/Meshes/Triangle.h"
+#include "Graphics/Meshes/ScreenQuad.h"
+
+#include <functional>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	ProceduralMeshParameters ProceduralMeshParameters::UVSphere(const unsigned int& numLatitudeLines, const unsigned int& numLongitudeLines)
+	{
+		ProceduralMeshParameters result{};
+		result.type = ProceduralMeshType::UV_SPHERE;
+		result.subdivisionsX = numLatitudeLines < 1 ? 1 : numLatitudeLines;
+		result.subdivisionsY = numLongitudeLines < 3 ? 3 : numLongitudeLines;
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+	ProceduralMeshParameters ProceduralMeshParameters::Cube(const bool& texCoords, const bool& normals, const bool& tangents)
+	{
+		ProceduralMeshParameters result{};
+		result.type = ProceduralMeshType::CUBE;
+		result.texCoords = texCoords;
+		result.normals = normals;
+		result.tangents = tangents;
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+	ProceduralMeshParameters ProceduralMeshParameters::Plane(const bool& texCoords, const bool& normals, const bool& tangents)
+	{
+		ProceduralMeshParameters result{};
+		result.type = ProceduralMeshType::PLANE;
+		result.texCoords = texCoords;
+		result.normals = normals;
+		result.tangents = tangents;
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+	ProceduralMeshParameters ProceduralMeshParameters::Circle(const unsigned int& subdivisions)
+	{
+		ProceduralMeshParameters result{};
+		result.type = ProceduralMeshType::CIRCLE;
+		result.subdivisionsX = subdivisions < 3 ? 3 : subdivisions;
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+	ProceduralMeshParameters ProceduralMeshParameters::Square()
+	{
+		ProceduralMeshParameters result{};
+		result.type = ProceduralMeshType::SQUARE;
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+	ProceduralMeshParameters ProceduralMeshParameters::Triangle()
+	{
+		ProceduralMeshParameters result{};
+		result.type = ProceduralMeshType::TRIANGLE;
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+	ProceduralMeshParameters ProceduralMeshParameters::ScreenQuad()
+	{
+		ProceduralMeshParameters result{};
+		result.type = ProceduralMeshType::SCREEN_QUAD;
+		return result;
+	}
+	//------------------------------------------------------------------------------------------------------
+	std::size_t ProceduralMeshParameters::Hash::operator()(const ProceduralMeshParameters& parameters) const
+	{
+		std::size_t hash = std::hash<unsigned int>()(static_cast<unsigned int>(parameters.type));
+		const auto combine = [&hash](const std::size_t& value) {
+			hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+		};
+		combine(std::hash<unsigned int>()(parameters.subdivisionsX));
+		combine(std::hash<unsigned int>()(parameters.subdivisionsY));
+		combine(static_cast<std::size_t>(parameters.texCoords) | static_cast<std::size_t>(parameters.normals) << 1 | static_cast<std::size_t>(parameters.tangents) << 2);
+		return hash;
+	}
+	//------------------------------------------------------------------------------------------------------
+	MeshGeometry generateMeshGeometry(const ProceduralMeshParameters& parameters)
+	{
+		switch (parameters.type)
+		{
+		case ProceduralMeshType::UV_SPHERE: return createMeshGeometryUVSphere(parameters.subdivisionsX, parameters.subdivisionsY);
+		case ProceduralMeshType::CUBE: return createMeshGeometryCube(parameters.texCoords, parameters.normals, parameters.tangents);
+		case ProceduralMeshType::PLANE: return createMeshGeometryPlane(parameters.texCoords, parameters.normals, parameters.tangents);
+		case ProceduralMeshType::CIRCLE: return createMeshGeometryCircle(parameters.subdivisionsX);
+		case ProceduralMeshType::SQUARE: return createMeshGeometrySquare();
+		case ProceduralMeshType::TRIANGLE: return createMeshGeometryTriangle();
+		case ProceduralMeshType::SCREEN_QUAD: return createMeshGeometryScreenQuad();
+		default: return MeshGeometry{};
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Graphics/Mesh.h"
+#include "Graphics/VertexBufferLayout.h"
+
+#include <vector>
+#include <cstddef>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	/// The procedural mesh generators of the engine (see the other headers in Graphics/Meshes)
+	enum class ProceduralMeshType
+	{
+		UV_SPHERE,
+		CUBE,
+		PLANE,
+		CIRCLE,
+		SQUARE,
+		TRIANGLE,
+		SCREEN_QUAD,
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// A procedural mesh generator together with its parameters. Two meshes generated with the same
+	/// parameters are identical, which is why this struct is used as the key of the procedural mesh cache
+	/// of the MeshManager. Should be constructed using the static factory functions, which also normalize
+	/// the parameters (e.g. clamp the number of subdivisions).
+	struct ProceduralMeshParameters
+	{
+		/// The generator that is used
+		ProceduralMeshType type{};
+		/// Generator specific parameters: number of latitude lines (UV_SPHERE) or subdivisions (CIRCLE)
+		unsigned int subdivisionsX{};
+		/// Generator specific parameters: number of longitude lines (UV_SPHERE)
+		unsigned int subdivisionsY{};
+		/// Vertex attributes of the CUBE and PLANE generators
+		bool texCoords{};
+		bool normals{};
+		bool tangents{};
+		/// Factory functions
+		static ProceduralMeshParameters UVSphere(const unsigned int& numLatitudeLines, const unsigned int& numLongitudeLines);
+		static ProceduralMeshParameters Cube(const bool& texCoords = false, const bool& normals = false, const bool& tangents = false);
+		static ProceduralMeshParameters Plane(const bool& texCoords = false, const bool& normals = false, const bool& tangents = false);
+		static ProceduralMeshParameters Circle(const unsigned int& subdivisions = 10);
+		static ProceduralMeshParameters Square();
+		static ProceduralMeshParameters Triangle();
+		static ProceduralMeshParameters ScreenQuad();
+		/// Comparison operator
+		bool operator==(const ProceduralMeshParameters& other) const = default;
+		/// Hash function object, such that this struct can be used as a key in std::unordered_map
+		struct Hash
+		{
+			std::size_t operator()(const ProceduralMeshParameters& parameters) const;
+		};
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// CPU side data of a mesh as it is produced by the procedural mesh generators. Can be passed to
+	/// MeshManager::createMesh()
+	struct MeshGeometry
+	{
+		VertexBufferLayout layout{};
+		std::vector<float> vertices{};
+		std::vector<unsigned int> indices{};
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// Runs the generator described by the given parameters on the CPU, without creating a mesh on the GPU
+	MeshGeometry generateMeshGeometry(const ProceduralMeshParameters& parameters);
+	//------------------------------------------------------------------------------------------------------
+	/// Range of indices of a single parameter variant inside the shared mesh of a ProceduralMeshBatch
+	struct ProceduralMeshRange
+	{
+		/// Index of the first index of this variant inside the index buffer
+		unsigned int firstIndex{};
+		/// Number of indices of this variant
+		unsigned int indexCount{};
+		/// Index of the first vertex of this variant inside the vertex buffer
+		unsigned int firstVertex{};
+		/// Number of vertices of this variant
+		unsigned int vertexCount{};
+	};
+	//------------------------------------------------------------------------------------------------------
+	/// Many variants of procedural meshes stored in a single mesh (one vertex and one index buffer).
+	/// Each variant can be drawn by drawing its index range (see Renderer::draw(mesh, firstIndex, indexCount)),
+	/// without rebinding any buffers in between. Created by MeshManager::createProceduralMeshBatch()
+	struct ProceduralMeshBatch
+	{
+		/// The shared mesh
+		Mesh mesh{};
+		/// One range per requested parameter set, in the order they were requested
+		std::vector<ProceduralMeshRange> ranges{};
+	};
+	//------------------------------------------------------------------------------------------------------
+}
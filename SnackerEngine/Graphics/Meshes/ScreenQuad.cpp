@@ -19,10 +19,17 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	Mesh createMeshScreenQuad()
 	{
-		VertexBufferLayout layout;
-		layout.push<float>(2); // positions
-		layout.push<float>(2); // texCoords
-		return MeshManager::createMesh(layout, vertices, indices);
+		return MeshManager::createProceduralMesh(ProceduralMeshParameters::ScreenQuad());
+	}
+	//------------------------------------------------------------------------------------------------------
+	MeshGeometry createMeshGeometryScreenQuad()
+	{
+		MeshGeometry geometry;
+		geometry.layout.push<float>(2); // positions
+		geometry.layout.push<float>(2); // texCoords
+		geometry.vertices = vertices;
+		geometry.indices = indices;
+		return geometry;
 	}
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
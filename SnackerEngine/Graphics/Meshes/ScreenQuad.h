@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Graphics/Mesh.h"
+#include "Graphics/Meshes/ProceduralMeshes.h"
 
 namespace SnackerEngine
 {
 	//------------------------------------------------------------------------------------------------------
 	Mesh createMeshScreenQuad();
+	/// Generates the vertex and index data of a screen quad on the CPU
+	MeshGeometry createMeshGeometryScreenQuad();
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
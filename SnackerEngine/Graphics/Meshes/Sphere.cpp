@@ -1,6 +1,7 @@
 #include "Graphics/Meshes/Sphere.h"
 #include "Math/Vec.h"
 #include "AssetManager/MeshManager.h"
+#include "AssetManager/MeshOptimizer.h"
 #include "Math/VectorAlgorithms.h"
 
 #define _USE_MATH_DEFINES
@@ -11,6 +12,13 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	Mesh createMeshUVSphere(const unsigned int& numLatitudeLines, const unsigned int& numLongitudeLines)
 	{
+		return MeshManager::createProceduralMesh(ProceduralMeshParameters::UVSphere(numLatitudeLines, numLongitudeLines));
+	}
+	//------------------------------------------------------------------------------------------------------
+	MeshGeometry createMeshGeometryUVSphere(unsigned int numLatitudeLines, unsigned int numLongitudeLines)
+	{
+		if (numLatitudeLines < 1) numLatitudeLines = 1;
+		if (numLongitudeLines < 3) numLongitudeLines = 3;
 		// Snacked from https://gamedev.stackexchange.com/questions/150191/opengl-calculate-uv-sphere-vertices
 
 		// One vertex at every latitude-longitude intersection,
@@ -118,13 +126,17 @@ namespace SnackerEngine
 			verticesFinal[i * (3 + 3 + 2 + 3) + 10] =tangentBitangent.first[i].z;
 		}
 
-		// Create model
-		VertexBufferLayout layout;
-		layout.push<float>(3); // position
-		layout.push<float>(2); // texCoords
-		layout.push<float>(3); // normals
-		layout.push<float>(3); // tangent
-		return MeshManager::createMesh(layout, verticesFinal, indices);
+		// Create geometry
+		MeshGeometry geometry;
+		geometry.layout.push<float>(3); // position
+		geometry.layout.push<float>(2); // texCoords
+		geometry.layout.push<float>(3); // normals
+		geometry.layout.push<float>(3); // tangent
+		// Reorder indices and vertices, the generated order is not cache friendly for large spheres
+		optimizeMesh(geometry.layout, verticesFinal, indices);
+		geometry.vertices = std::move(verticesFinal);
+		geometry.indices = std::move(indices);
+		return geometry;
 	}
 	//------------------------------------------------------------------------------------------------------
 }
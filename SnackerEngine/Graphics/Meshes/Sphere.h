@@ -1,10 +1,15 @@
 #pragma once
 
 #include "Graphics/Mesh.h"
+#include "Graphics/Meshes/ProceduralMeshes.h"
 
 namespace SnackerEngine 
 {
 	//------------------------------------------------------------------------------------------------------
+	/// Creates a UV sphere mesh with radius one. Meshes with the same parameters are shared (see MeshManager::createProceduralMesh())
 	Mesh createMeshUVSphere(const unsigned int& numLatitudeLines, const unsigned int& numLongitudeLines);
+	/// Generates the vertex and index data of a UV sphere on the CPU. At least one latitude line and
+	/// three longitude lines are used
+	MeshGeometry createMeshGeometryUVSphere(unsigned int numLatitudeLines, unsigned int numLongitudeLines);
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
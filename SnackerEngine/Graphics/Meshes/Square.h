@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Graphics/Mesh.h"
+#include "Graphics/Meshes/ProceduralMeshes.h"
 
 namespace SnackerEngine
 {
 	//------------------------------------------------------------------------------------------------------
 	Mesh createMeshSquare();
+	/// Generates the vertex and index data of a square on the CPU
+	MeshGeometry createMeshGeometrySquare();
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -17,9 +17,16 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	Mesh createMeshTriangle()
 	{
-		VertexBufferLayout layout;
-		layout.push<float>(2); // positions and texCoords
-		return MeshManager::createMesh(layout, vertices, indices);
+		return MeshManager::createProceduralMesh(ProceduralMeshParameters::Triangle());
+	}
+	//------------------------------------------------------------------------------------------------------
+	MeshGeometry createMeshGeometryTriangle()
+	{
+		MeshGeometry geometry;
+		geometry.layout.push<float>(2); // positions and texCoords
+		geometry.vertices = vertices;
+		geometry.indices = indices;
+		return geometry;
 	}
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Graphics/Mesh.h"
+#include "Graphics/Meshes/ProceduralMeshes.h"
 
 namespace SnackerEngine
 {	
 	//------------------------------------------------------------------------------------------------------
 	Mesh createMeshTriangle();
+	/// Generates the vertex and index data of a triangle on the CPU
+	MeshGeometry createMeshGeometryTriangle();
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -1,5 +1,10 @@
 #include "Graphics/Model.h"
 #include "AssetManager/ModelManager.h"
+#include "Graphics/Camera.h"
+#include "Graphics/Renderer.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace SnackerEngine
 {
@@ -22,6 +27,9 @@ namespace SnackerEngine
     Model::Model(const Mesh& mesh)
         : Model(ModelManager::createModel(mesh)) {}
     //------------------------------------------------------------------------------------------------------
+    Model::Model(const std::vector<Mesh>& meshes, const std::vector<ModelLOD>& lods, const Vec3f& boundingSphereCenter, const float& boundingSphereRadius)
+        : Model(ModelManager::createModel(meshes, lods, boundingSphereCenter, boundingSphereRadius)) {}
+    //------------------------------------------------------------------------------------------------------
     Model& Model::operator=(const Model& other) noexcept
     {
         ModelManager::decreaseReferenceCount(*this);
@@ -46,6 +54,64 @@ namespace SnackerEngine
         return ModelManager::getModelData(*this).meshes;
     }
     //------------------------------------------------------------------------------------------------------
+    unsigned int Model::getLODCount() const
+    {
+        return static_cast<unsigned int>(ModelManager::getModelData(*this).lods.size()) + 1;
+    }
+    //------------------------------------------------------------------------------------------------------
+    const std::vector<Mesh>& Model::getMeshes(const unsigned int& lod) const
+    {
+        const auto& modelData = ModelManager::getModelData(*this);
+        if (lod == 0 || modelData.lods.empty()) return modelData.meshes;
+        return modelData.lods[std::min(static_cast<std::size_t>(lod), modelData.lods.size()) - 1].meshes;
+    }
+    //------------------------------------------------------------------------------------------------------
+    const AABB& Model::getBoundingBox() const
+    {
+        return ModelManager::getModelData(*this).boundingBox;
+    }
+    //------------------------------------------------------------------------------------------------------
+    const BoundingSphere& Model::getBoundingSphere() const
+    {
+        return ModelManager::getModelData(*this).boundingSphere;
+    }
+    //------------------------------------------------------------------------------------------------------
+    bool Model::isInFrustum(const Frustum& frustum, const Mat4f& modelMatrix) const
+    {
+        const auto& modelData = ModelManager::getModelData(*this);
+        // Models without positions that could be bounded are never culled
+        if (!modelData.boundingBox.isValid()) return true;
+        // The sphere test is cheaper, only test the box if the sphere intersects the frustum
+        if (!frustum.intersects(modelData.boundingSphere.transform(modelMatrix))) return false;
+        return frustum.intersects(modelData.boundingBox.transform(modelMatrix));
+    }
+    //------------------------------------------------------------------------------------------------------
+    float Model::computeScreenSize(const Camera& camera, const Mat4f& modelMatrix) const
+    {
+        const auto& modelData = ModelManager::getModelData(*this);
+        // Transform the bounding sphere to world space. The radius is scaled by the largest axis scale
+        const BoundingSphere sphere = modelData.boundingSphere.transform(modelMatrix);
+        const float radius = sphere.radius;
+        const float distance = (sphere.center - camera.getPosition()).magnitude();
+        // The camera is inside the bounding sphere: the model covers the whole screen
+        if (distance <= radius) return 1.0f;
+        return radius / (distance * std::tan(camera.getFov() / 2.0f));
+    }
+    //------------------------------------------------------------------------------------------------------
+    unsigned int Model::selectLOD(const Camera& camera, const Mat4f& modelMatrix, const float& maxPixelError) const
+    {
+        const auto& modelData = ModelManager::getModelData(*this);
+        if (modelData.lods.empty()) return 0;
+        // Radius of the bounding sphere in pixels. The screen size is relative to half the screen height
+        const float radiusInPixels = computeScreenSize(camera, modelMatrix) * static_cast<float>(Renderer::getScreenDimensions().y) / 2.0f;
+        unsigned int lod = 0;
+        for (unsigned int i = 0; i < modelData.lods.size(); ++i) {
+            if (modelData.lods[i].relativeError * radiusInPixels > maxPixelError) break;
+            lod = i + 1;
+        }
+        return lod;
+    }
+    //------------------------------------------------------------------------------------------------------
     Model::~Model()
     {
         ModelManager::decreaseReferenceCount(*this);
@@ -1,12 +1,26 @@
 #pragma once
 
 #include "Graphics/Mesh.h"
+#include "Math/Mat.h"
+#include "Math/BoundingVolumes.h"
 
 #include <string>
 #include <vector>
 
 namespace SnackerEngine
 {
+	//------------------------------------------------------------------------------------------------------
+	/// Forward declaration of Camera
+	class Camera;
+	//------------------------------------------------------------------------------------------------------
+	/// A simplified level of detail (LOD) of a model
+	struct ModelLOD
+	{
+		/// One simplified mesh for each mesh of the model
+		std::vector<Mesh> meshes{};
+		/// Geometric error of this level relative to the radius of the bounding sphere of the model
+		float relativeError{};
+	};
 	//------------------------------------------------------------------------------------------------------
 	class Model
 	{
@@ -24,6 +38,9 @@ namespace SnackerEngine
 		Model(const std::vector<Mesh>& meshes);
 		/// Creates model from a single mesh
 		Model(const Mesh& mesh);
+		/// Creates model from array of meshes and a chain of simplified levels of detail, ordered from
+		/// the most to the least detailed level. The bounding sphere is given in model space
+		Model(const std::vector<Mesh>& meshes, const std::vector<ModelLOD>& lods, const Vec3f& boundingSphereCenter, const float& boundingSphereRadius);
 		/// Copy constructor and assignment operator
 		Model& operator=(const Model& other) noexcept;
 		Model(const Model& other) noexcept;
@@ -31,6 +48,27 @@ namespace SnackerEngine
 		bool isValid() const;
 		/// Returns the vector of meshes that this model contains
 		const std::vector<Mesh>& getMeshes() const;
+		/// Returns the number of levels of detail, including the full resolution level 0
+		unsigned int getLODCount() const;
+		/// Returns the vector of meshes of the given level of detail. Level 0 is the full resolution model.
+		/// If the level does not exist, the least detailed level is returned
+		const std::vector<Mesh>& getMeshes(const unsigned int& lod) const;
+		/// Returns the axis aligned bounding box of all meshes of this model in model space
+		const AABB& getBoundingBox() const;
+		/// Returns the bounding sphere of all meshes of this model in model space
+		const BoundingSphere& getBoundingSphere() const;
+		/// Returns false if this model is completely outside of the given frustum (see Camera::getFrustum()).
+		/// modelMatrix transforms from model space to world space
+		bool isInFrustum(const Frustum& frustum, const Mat4f& modelMatrix) const;
+		/// Returns the radius of the bounding sphere of this model when projected onto the screen, 
+		/// as a fraction of the screen height. modelMatrix transforms from model space to world space
+		float computeScreenSize(const Camera& camera, const Mat4f& modelMatrix) const;
+		/// Selects the least detailed level of detail whose error, projected onto the screen, is at most 
+		/// maxPixelError pixels. The projected error shrinks with the distance to the camera, so distant
+		/// models get coarser levels. modelMatrix transforms from model space to world space. Used by 
+		/// Renderer::draw(model, material, camera, modelMatrix), the other draw functions don't select 
+		/// a level on their own
+		unsigned int selectLOD(const Camera& camera, const Mat4f& modelMatrix, const float& maxPixelError = 1.0f) const;
 		// Destructor
 		~Model();
 	};
@@ -1,6 +1,8 @@
 #include "Renderer.h"
 #include "Core/Log.h"
 #include "Core/Assert.h"
+#include "Graphics/GLState.h"
+#include "Graphics/CommandLog.h"
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
@@ -48,8 +50,11 @@ namespace SnackerEngine
 		// Print out version
 		infoLogger << LOGGER::BEGIN << "Running on GL version " << glGetString(GL_VERSION) << LOGGER::ENDL;
 
+		// Nothing is known about the state of the new context
+		GLState::invalidate();
+
 		// Enable depth testing
-		GLCall(glEnable(GL_DEPTH_TEST));
+		GLState::setDepthTest(true);
 
 		// Make cubemaps seemless
 		GLCall(glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS));
@@ -88,25 +93,38 @@ namespace SnackerEngine
 	void Renderer::changeViewPort(const Vec2i& viewPort)
 	{
 		currentViewPort = viewPort;
+		if (headless) return;
 		GLCall(glViewport(GLint(0), GLint(0), static_cast<GLint>(viewPort.x), static_cast<GLint>(viewPort.y)));
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::hideCursor()
 	{
+		if (headless) return;
 		GLCall(glfwSetInputMode(activeWindow, GLFW_CURSOR, GLFW_CURSOR_DISABLED));
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::unhideCursor()
 	{
+		if (headless) return;
 		glfwSetInputMode(activeWindow, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::clear()
 	{
+		CommandLog::recordClear();
+		if (headless) return;
 		GLCall(glClearColor(static_cast<GLclampf>(clearColor.r), static_cast<GLclampf>(clearColor.g), static_cast<GLclampf>(clearColor.b), 1.0f));
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); //  | GL_STENCIL_BUFFER_BIT); // TODO: Stencil buffer
 	}
 	//------------------------------------------------------------------------------------------------------
+	void Renderer::clear(const Color4f& color)
+	{
+		CommandLog::recordClear();
+		if (headless) return;
+		GLCall(glClearColor(static_cast<GLclampf>(color.r), static_cast<GLclampf>(color.g), static_cast<GLclampf>(color.b), static_cast<GLclampf>(color.alpha)));
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	}
+	//------------------------------------------------------------------------------------------------------
 	void Renderer::setClearColor(const Color3f& clearColor)
 	{
 		Renderer::clearColor = clearColor;
@@ -114,72 +132,109 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::swapBuffers()
 	{
-		GLCall(glfwSwapBuffers(activeWindow));
+		if (!headless) GLCall(glfwSwapBuffers(activeWindow));
+		CommandLog::endFrame();
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::enableDepthTesting()
 	{
-		GLCall(glEnable(GL_DEPTH_TEST));
+		GLState::setDepthTest(true);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::disableDepthTesting()
 	{
-		GLCall(glDisable(GL_DEPTH_TEST));
+		GLState::setDepthTest(false);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::enableBlending()
 	{
-		GLCall(glEnable(GL_BLEND));
-		GLCall(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA)); // TODO: Make this variable!
+		GLState::setBlending(true);
+		GLState::setBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); // TODO: Make this variable!
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::disableBlending()
 	{
-		GLCall(glDisable(GL_BLEND));
+		GLState::setBlending(false);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::enableScissorTest(const Vec2i& position, const Vec2i& size)
 	{
-		GLCall(glEnable(GL_SCISSOR_TEST));
-		GLCall(glScissor(position.x, position.y, size.x, size.y));
+		GLState::setScissorTest(true);
+		GLState::setScissorBox(Vec4i(position.x, position.y, size.x, size.y));
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::enableScissorTest(const Vec4i& clippingBox)
 	{
-		GLCall(glEnable(GL_SCISSOR_TEST));
-		GLCall(glScissor(clippingBox.x, clippingBox.y, clippingBox.z, clippingBox.w));
+		GLState::setScissorTest(true);
+		GLState::setScissorBox(clippingBox);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::disableScissorTest()
 	{
-		GLCall(glDisable(GL_SCISSOR_TEST));
+		GLState::setScissorTest(false);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::draw(const Model& model, const Material& material)
 	{
 		material.bind();
-		for (const auto& mesh : model.getMeshes()) {
-			mesh.getVertexArray().bind();
-			const IndexBuffer& ib = mesh.getIndexBuffer();
-			ib.bind();
-			// TODO: maybe add other draw modes than Triangles!
-			GLCall(glDrawElements(GL_TRIANGLES, ib.getCount(), GL_UNSIGNED_INT, 0));
-		}
+		draw(model);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::draw(const Model& model)
 	{
 		for (const auto& mesh : model.getMeshes()) {
-			mesh.getVertexArray().bind();
-			const IndexBuffer& ib = mesh.getIndexBuffer();
-			ib.bind();
-			// TODO: maybe add other draw modes than Triangles!
-			GLCall(glDrawElements(GL_TRIANGLES, ib.getCount(), GL_UNSIGNED_INT, 0));
+			drawElements(mesh.getVertexArray(), mesh.getIndexBuffer(), mesh.getIndexBuffer().getCount(), 0, 0);
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	void Renderer::draw(const Model& model, const Material& material, const unsigned int& lod)
+	{
+		material.bind();
+		draw(model, lod);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void Renderer::draw(const Model& model, const Material& material, const Camera& camera, const Mat4f& modelMatrix, const float& maxPixelError)
+	{
+		draw(model, material, model.selectLOD(camera, modelMatrix, maxPixelError));
+	}
+	//------------------------------------------------------------------------------------------------------
+	void Renderer::draw(const Model& model, const unsigned int& lod)
+	{
+		for (const auto& mesh : model.getMeshes(lod)) {
+			drawElements(mesh.getVertexArray(), mesh.getIndexBuffer(), mesh.getIndexBuffer().getCount(), 0, 0);
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	void Renderer::draw(const Mesh& mesh, const unsigned int& firstIndex, const unsigned int& indexCount)
+	{
+		drawElements(mesh.getVertexArray(), mesh.getIndexBuffer(), indexCount, firstIndex, 0);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void Renderer::drawInstanced(const VertexArray& vertexArray, const IndexBuffer& indexBuffer, const unsigned int& instanceCount)
+	{
+		if (instanceCount == 0) return;
+		drawElements(vertexArray, indexBuffer, indexBuffer.getCount(), 0, instanceCount);
+	}
+	//------------------------------------------------------------------------------------------------------
+	void Renderer::drawElements(const VertexArray& vertexArray, const IndexBuffer& indexBuffer, const unsigned int& indexCount, const unsigned int& firstIndex, const unsigned int& instanceCount)
+	{
+		vertexArray.bind();
+		indexBuffer.bind();
+		CommandLog::recordDraw(vertexArray.getGPU_ID(), indexCount, instanceCount);
+		if (headless) return;
+		const std::size_t offset = static_cast<std::size_t>(firstIndex) * IndexBuffer::getSizeOfIndexType(indexBuffer.getIndexType());
+		// TODO: maybe add other draw modes than Triangles!
+		if (instanceCount == 0) {
+			GLCall(glDrawElements(GL_TRIANGLES, indexCount, indexBuffer.getIndexType(), reinterpret_cast<const void*>(offset)));
+		}
+		else {
+			GLCall(glDrawElementsInstanced(GL_TRIANGLES, indexCount, indexBuffer.getIndexType(), reinterpret_cast<const void*>(offset), instanceCount));
 		}
 	}
 	//------------------------------------------------------------------------------------------------------
 	void Renderer::setCursorShape(const CursorShape& cursorShape)
 	{
+		if (headless) return;
 		switch (cursorShape)
 		{
 		case CursorShape::DEFAULT:
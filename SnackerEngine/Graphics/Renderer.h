@@ -30,12 +30,21 @@ namespace SnackerEngine
 		inline static GLFWcursor* currentCursor = nullptr;
 		/// Clear color
 		inline static Color3f clearColor{};
+		/// If this is set to true, the engine runs without a window and an OpenGL context (see
+		/// Engine::initializeHeadless()). Buffers and textures then keep their data on the CPU and
+		/// all commands are only recorded by the CommandLog
+		inline static bool headless = false;
+		/// Binds the vertex array and the index buffer and draws indexCount indices starting at firstIndex.
+		/// Draws instanceCount instances if instanceCount is larger than zero
+		static void drawElements(const VertexArray& vertexArray, const IndexBuffer& indexBuffer, const unsigned int& indexCount, const unsigned int& firstIndex, const unsigned int& instanceCount);
 	protected:
 		/// Initialize the Renderer and creates the window. Returns true on success
 		static bool initialize(const int& windowWidth, const int& windowHeight, const std::string& windowName);
 		/// Terminates the Renderer and the window
 		static void terminate();
 	public:
+		/// Returns true if the engine runs without a window and an OpenGL context
+		static bool isHeadless() { return headless; }
 		/// Returns the screen dimensions of the screen that the engine was launched on
 		static Vec2i getNativeScreenDimensions();
 		/// Returns the current window dimensions
@@ -44,15 +53,20 @@ namespace SnackerEngine
 		static Vec2i getWindowPosition();
 		/// Changes the viewport
 		static void changeViewPort(const Vec2i& viewPort);
+		/// Returns the current viewport
+		static const Vec2i& getViewPort() { return currentViewPort; }
 		/// Hides the cursor
 		static void hideCursor();
 		/// Unhides the cursor
 		static void unhideCursor();
 		/// Clears the screen
 		static void clear();
+		/// Clears the current render target with the given color. Does not change the clear color
+		static void clear(const Color4f& color);
 		/// Sets clear color
 		static void setClearColor(const Color3f& clearColor);
-		/// swaps renderBuffers. Should be called everytime after Rendering!
+		/// swaps renderBuffers. Should be called everytime after Rendering! Also ends the current frame of
+		/// the CommandLog. In headless mode, only the frame is ended
 		static void swapBuffers();
 		/// Enables depth testing
 		static void enableDepthTesting();
@@ -67,10 +81,25 @@ namespace SnackerEngine
 		static void enableScissorTest(const Vec4i& clippingBox);
 		/// Disables scissor test
 		static void disableScissorTest();
-		/// Draws a given model with the given material
+		/// Draws a given model with the given material. Always draws the full resolution level of detail
 		static void draw(const Model& model, const Material& material);
-		/// Draws a given model, with shaders, textures etc. already bound
+		/// Draws a given model, with shaders, textures etc. already bound. Always draws the full 
+		/// resolution level of detail
 		static void draw(const Model& model);
+		/// Draws the given level of detail of a model with the given material (see Model::selectLOD())
+		static void draw(const Model& model, const Material& material, const unsigned int& lod);
+		/// Draws a model with the given material, using the level of detail that Model::selectLOD() picks
+		/// for the given camera. modelMatrix transforms from model space to world space
+		static void draw(const Model& model, const Material& material, const Camera& camera, const Mat4f& modelMatrix, const float& maxPixelError = 1.0f);
+		/// Draws the given level of detail of a model, with shaders, textures etc. already bound
+		static void draw(const Model& model, const unsigned int& lod);
+		/// Draws a range of the index buffer of the given mesh, with shaders, textures etc. already bound.
+		/// Can be used to draw single variants of a ProceduralMeshBatch
+		static void draw(const Mesh& mesh, const unsigned int& firstIndex, const unsigned int& indexCount);
+		/// Draws the given number of instances of the given index buffer, using the given VertexArray object
+		/// (which should have an instance buffer, see VertexArray::bindInstanceBuffer()). Shaders, textures
+		/// etc. should already be bound
+		static void drawInstanced(const VertexArray& vertexArray, const IndexBuffer& indexBuffer, const unsigned int& instanceCount);
 		/// Enum for different cursor shapes
 		enum class CursorShape {
 			DEFAULT,
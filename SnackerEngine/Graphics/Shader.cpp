@@ -75,73 +75,73 @@ namespace SnackerEngine
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<float>(const std::string& name, const float& data) const
+	void SnackerEngine::Shader::setUniform<float>(const UniformName& name, const float& data) const
 	{
 		ShaderManager::setUniform<float>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<Vec2f>(const std::string& name, const Vec2f& data) const
+	void SnackerEngine::Shader::setUniform<Vec2f>(const UniformName& name, const Vec2f& data) const
 	{
 		ShaderManager::setUniform<Vec2f>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<Vec3f>(const std::string& name, const Vec3f& data) const
+	void SnackerEngine::Shader::setUniform<Vec3f>(const UniformName& name, const Vec3f& data) const
 	{
 		ShaderManager::setUniform<Vec3f>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<Vec4f>(const std::string& name, const Vec4f& data) const
+	void SnackerEngine::Shader::setUniform<Vec4f>(const UniformName& name, const Vec4f& data) const
 	{
 		ShaderManager::setUniform<Vec4f>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<int>(const std::string& name, const int& data) const
+	void SnackerEngine::Shader::setUniform<int>(const UniformName& name, const int& data) const
 	{
 		ShaderManager::setUniform<int>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<Mat3f>(const std::string& name, const Mat3f& data) const
+	void SnackerEngine::Shader::setUniform<Mat3f>(const UniformName& name, const Mat3f& data) const
 	{
 		ShaderManager::setUniform<Mat3f>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<Mat4f>(const std::string& name, const Mat4f& data) const
+	void SnackerEngine::Shader::setUniform<Mat4f>(const UniformName& name, const Mat4f& data) const
 	{
 		ShaderManager::setUniform<Mat4f>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<Color3f>(const std::string& name, const Color3f& data) const
+	void SnackerEngine::Shader::setUniform<Color3f>(const UniformName& name, const Color3f& data) const
 	{
 		ShaderManager::setUniform<Color3f>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<Color4f>(const std::string& name, const Color4f& data) const
+	void SnackerEngine::Shader::setUniform<Color4f>(const UniformName& name, const Color4f& data) const
 	{
 		ShaderManager::setUniform<Color4f>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<Vec2i>(const std::string& name, const Vec2i& data) const
+	void SnackerEngine::Shader::setUniform<Vec2i>(const UniformName& name, const Vec2i& data) const
 	{
 		ShaderManager::setUniform<Vec2i>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<Vec3i>(const std::string& name, const Vec3i& data) const
+	void SnackerEngine::Shader::setUniform<Vec3i>(const UniformName& name, const Vec3i& data) const
 	{
 		ShaderManager::setUniform<Vec3i>(*this, name, data);
 	}
 	//------------------------------------------------------------------------------------------------------
 	template<>
-	void SnackerEngine::Shader::setUniform<Vec4i>(const std::string& name, const Vec4i& data) const
+	void SnackerEngine::Shader::setUniform<Vec4i>(const UniformName& name, const Vec4i& data) const
 	{
 		ShaderManager::setUniform<Vec4i>(*this, name, data);
 	}
@@ -5,9 +5,41 @@
 #include "Math/Mat.h"
 
 #include <string>
+#include <string_view>
+#include <cstdint>
 
 namespace SnackerEngine
 {
+	//------------------------------------------------------------------------------------------------------
+	/// Name of a shader uniform together with its hash, which is used to look up the uniform location.
+	/// Implicitly constructible from string literals and strings. Call sites that set the same uniform
+	/// often can hold a precomputed handle, eg.
+	///		static constexpr UniformName modelUniform{ "u_model" };
+	/// Only a view of the name is stored, the string has to outlive the UniformName object!
+	class UniformName
+	{
+		std::string_view name;
+		std::uint32_t hash;
+		/// FNV-1a hash
+		static constexpr std::uint32_t computeHash(std::string_view name)
+		{
+			std::uint32_t hash = 2166136261u;
+			for (char c : name) {
+				hash ^= static_cast<std::uint8_t>(c);
+				hash *= 16777619u;
+			}
+			return hash;
+		}
+	public:
+		constexpr UniformName(const char* name)
+			: UniformName(std::string_view(name)) {}
+		constexpr UniformName(std::string_view name)
+			: name(name), hash(computeHash(name)) {}
+		UniformName(const std::string& name)
+			: UniformName(std::string_view(name)) {}
+		constexpr std::string_view getName() const { return name; }
+		constexpr std::uint32_t getHash() const { return hash; }
+	};
 	//------------------------------------------------------------------------------------------------------
 	class Shader
 	{
@@ -32,11 +64,13 @@ namespace SnackerEngine
 		static void unBind();
 		/// Setting uniforms
 		template<typename T>
-		void setUniform(const std::string& name, const T& data) const;
+		void setUniform(const UniformName& name, const T& data) const;
 		/// Set model, view and projection matrix uniforms all at once
 		void setModelViewProjection(const Mat4f& model, const Mat4f& view, const Mat4f& projection) const;
 		/// Returns true if this shader is valid and corresponds to a shader on the GPU
 		bool isValid() const;
+		/// Returns true if both objects refer to the same shader
+		bool operator==(const Shader& other) const { return shaderID == other.shaderID; }
 		/// Destructor
 		~Shader();
 	};
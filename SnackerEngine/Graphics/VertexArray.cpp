@@ -1,6 +1,9 @@
 #include "Graphics/VertexArray.h"
 #include "Core/Assert.h"
 #include "Core/Log.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/GLState.h"
+#include "Graphics/CommandLog.h"
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
@@ -45,15 +48,16 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	VertexArray::~VertexArray()
 	{
-		if (valid) {
-			GLCall(glDeleteVertexArrays(1, &GPU_ID));
+		if (valid && GPU_ID != 0) {
+			if (!Renderer::isHeadless()) GLCall(glDeleteVertexArrays(1, &GPU_ID));
+			GLState::onDeleteVertexArray(GPU_ID);
 		}
 	}
 	//------------------------------------------------------------------------------------------------------
 	void VertexArray::bind() const
 	{
 		if (valid) {
-			GLCall(glBindVertexArray(GPU_ID));
+			GLState::bindVertexArray(GPU_ID);
 		}
 		else {
 			warningLogger << LOGGER::BEGIN << "Tried to bind Vertex Array that was invalid!" << LOGGER::ENDL;
@@ -62,7 +66,7 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	void VertexArray::unbind()
 	{
-		GLCall(glBindVertexArray(0));
+		GLState::bindVertexArray(0);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void VertexArray::bindBuffer(const VertexBuffer& buffer)
@@ -71,10 +75,16 @@ namespace SnackerEngine
 			warningLogger << LOGGER::BEGIN << "Tried to bind buffer to a vertexArray that was already initialized!" << LOGGER::ENDL;
 			return;
 		}
+		// In headless mode there is nothing to set up on the GPU, the layout is all we need
+		if (Renderer::isHeadless()) {
+			GPU_ID = CommandLog::generateObjectName();
+			valid = true;
+			return;
+		}
 		// Generate new vertexArray
 		GLCall(glGenVertexArrays(1, &GPU_ID));
 		// Bind it
-		GLCall(glBindVertexArray(GPU_ID));
+		GLState::bindVertexArray(GPU_ID);
 		// go through layout and call VertexAttribPointer with the correct parameters
 		const auto& elements = layout.GetElements();
 		unsigned int offset = 0;
@@ -96,4 +106,28 @@ namespace SnackerEngine
 		bindBuffer(buffer);
 	}
 	//------------------------------------------------------------------------------------------------------
+	void VertexArray::bindInstanceBuffer(VertexBuffer& buffer, const VertexBufferLayout& instanceLayout)
+	{
+		if (!valid) {
+			warningLogger << LOGGER::BEGIN << "Tried to bind instance buffer to a vertexArray that was not yet initialized!" << LOGGER::ENDL;
+			return;
+		}
+		if (Renderer::isHeadless()) return;
+		GLState::bindVertexArray(GPU_ID);
+		buffer.bind();
+		// The instance attributes come after the per vertex attributes
+		const unsigned int firstAttribute = static_cast<unsigned int>(layout.GetElements().size());
+		const auto& elements = instanceLayout.GetElements();
+		unsigned int offset = 0;
+		for (unsigned int i = 0; i < elements.size(); i++)
+		{
+			const auto& element = elements[i];
+			GLCall(glEnableVertexAttribArray(firstAttribute + i));
+			GLCall(glVertexAttribPointer(firstAttribute + i, element.count, element.type,
+				element.normalized, instanceLayout.GetStride(), reinterpret_cast<const void*>(static_cast<std::size_t>(offset))));
+			GLCall(glVertexAttribDivisor(firstAttribute + i, 1));
+			offset += element.count * VertexBufferElement::GetSizeOfType(element.type);
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -38,9 +38,15 @@ namespace SnackerEngine
 		void bindBuffer(const VertexBuffer& buffer);
 		/// Specifies a layout and binds a buffer, finalizing this VertexArray object
 		void bindBuffer(const VertexBuffer& buffer, VertexBufferLayout layout);
+		/// Binds a buffer with per instance attributes to this VertexArray object (used for instanced
+		/// rendering). The attributes are numbered after the attributes of the layout of this VertexArray
+		/// and advance once per instance. Can only be called after the VertexArray object was finalized
+		void bindInstanceBuffer(VertexBuffer& buffer, const VertexBufferLayout& instanceLayout);
 
 		bool isValid() { return valid; };
 		const VertexBufferLayout& getLayout() { return layout; };
+		/// Returns the name of the vertex array object (used by the CommandLog)
+		unsigned int getGPU_ID() const { return GPU_ID; };
 	};
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
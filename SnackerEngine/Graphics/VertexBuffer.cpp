@@ -1,7 +1,11 @@
 #include "Graphics/VertexBuffer.h"
 #include "Core/Log.h"
 #include "Core/Assert.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/GLState.h"
+#include "Graphics/CommandLog.h"
 
+#include <cstring>
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
@@ -10,10 +14,20 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	void VertexBuffer::setDataAndFinalize(void* data, const unsigned int& size)
 	{
+		if (Renderer::isHeadless()) {
+			// Record the data instead of moving it to the GPU
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			recordedData.assign(bytes, bytes + size);
+			GPU_ID = CommandLog::generateObjectName();
+			CommandLog::recordBufferUpload(GL_ARRAY_BUFFER, GPU_ID, size);
+			valid = true;
+			sizeInBytes = size;
+			return;
+		}
 		// Generate one buffer and set the ID to m_RendererID.
 		GLCall(glGenBuffers(1, &GPU_ID));
 		// Bind the buffer. GL_ARRAY_BUFFER is used for vertex data!
-		GLCall(glBindBuffer(GL_ARRAY_BUFFER, GPU_ID));
+		GLState::bindArrayBuffer(GPU_ID);
 		// glBufferData creates a new data store for the buffer object currently bound to target. 
 		// Any pre-existing data store is deleted.
 		// - usage is a hint to the GL implementation as to how a buffer object's data store will be accessed. 
@@ -41,15 +55,26 @@ namespace SnackerEngine
 			warningLogger << LOGGER::BEGIN << "Used unknown storage type in VertexBuffer creation" << LOGGER::ENDL;
 			return;
 		}
+		CommandLog::recordBufferUpload(GL_ARRAY_BUFFER, GPU_ID, size);
 		valid = true;
 		sizeInBytes = size;
 	}
 	//------------------------------------------------------------------------------------------------------
 	void VertexBuffer::changeSubData(void* data, const unsigned int& size, const unsigned int& offset)
 	{
+		if (valid && Renderer::isHeadless()) {
+			if (static_cast<std::size_t>(offset) + size > recordedData.size()) {
+				warningLogger << LOGGER::BEGIN << "Tried to change data outside of vertex buffer!" << LOGGER::ENDL;
+				return;
+			}
+			std::memcpy(recordedData.data() + offset, data, size);
+			CommandLog::recordBufferUpload(GL_ARRAY_BUFFER, GPU_ID, size);
+			return;
+		}
 		if (valid) {
-			GLCall(glBindBuffer(GL_ARRAY_BUFFER, GPU_ID));
+			GLState::bindArrayBuffer(GPU_ID);
 			GLCall(glBufferSubData(GL_ARRAY_BUFFER, offset, size, data));
+			CommandLog::recordBufferUpload(GL_ARRAY_BUFFER, GPU_ID, size);
 		}
 		else {
 			warningLogger << LOGGER::BEGIN << "Tried to bind vertex buffer which has no data on the GPU!" << LOGGER::ENDL;
@@ -66,7 +91,8 @@ namespace SnackerEngine
 		: valid(false), GPU_ID(0), storageType(VertexBufferStorageType::DYNAMIC), sizeInBytes(0) {}
 	//------------------------------------------------------------------------------------------------------
 	VertexBuffer::VertexBuffer(VertexBuffer&& vb) noexcept
-		: valid(vb.valid), GPU_ID(vb.GPU_ID), storageType(vb.storageType), sizeInBytes(vb.sizeInBytes)
+		: valid(vb.valid), GPU_ID(vb.GPU_ID), storageType(vb.storageType), sizeInBytes(vb.sizeInBytes),
+		recordedData(std::move(vb.recordedData))
 	{
 		// Reset the other vb
 		vb.valid = false;
@@ -82,6 +108,7 @@ namespace SnackerEngine
 		GPU_ID = vb.GPU_ID;
 		storageType = vb.storageType;
 		sizeInBytes = vb.sizeInBytes;
+		recordedData = std::move(vb.recordedData);
 		// Reset the other vb
 		vb.valid = false;
 		vb.GPU_ID = 0;
@@ -99,15 +126,17 @@ namespace SnackerEngine
 		// If a buffer object that is currently bound is deleted, the binding reverts to 0 
 		// (the absence of any buffer object, which reverts to client memory usage).
 		// glDeleteBuffers silently ignores 0's and names that do not correspond to existing buffer objects.
-		if (valid) {
-			GLCall(glDeleteBuffers(1, &GPU_ID));
+		// In headless mode, GPU_ID was generated by the CommandLog and there is no OpenGL context to call.
+		if (valid && GPU_ID != 0) {
+			if (!Renderer::isHeadless()) GLCall(glDeleteBuffers(1, &GPU_ID));
+			GLState::onDeleteBuffer(GPU_ID);
 		}
 	}
 	//------------------------------------------------------------------------------------------------------
 	void VertexBuffer::bind()
 	{
 		if (valid) {
-			GLCall(glBindBuffer(GL_ARRAY_BUFFER, GPU_ID));
+			GLState::bindArrayBuffer(GPU_ID);
 		}
 		else {
 			warningLogger << LOGGER::BEGIN << "Tried to bind vertex buffer which has no data on the GPU!" << LOGGER::ENDL;
@@ -117,7 +146,7 @@ namespace SnackerEngine
 	void VertexBuffer::unBind()
 	{
 		// Unbind all Buffers!
-		GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));
+		GLState::bindArrayBuffer(0);
 	}
 	//------------------------------------------------------------------------------------------------------
 	void VertexBuffer::setStorageType(VertexBufferStorageType storageType)
@@ -24,6 +24,8 @@ namespace SnackerEngine
 		VertexBufferStorageType storageType;
 		// Size of the data in bytes
 		unsigned int sizeInBytes; 
+		/// Copy of the data. Only used in headless mode, where there is no GPU (see Renderer::isHeadless())
+		std::vector<unsigned char> recordedData;
 		/// Generates the buffer, Sets the data, and moves it to the GPU, finalizing this VertexBuffer object.
 		/// data:	pointer to the data
 		/// size:	size in bytes
@@ -71,12 +73,24 @@ namespace SnackerEngine
 			changeSubData(const_cast<void*>(static_cast<const void*>(data.data())), data.size() * sizeof(T), offset);
 		};
 
+		/// Changes a part of the data on the GPU without copying it into a vector first.
+		/// Can only be done when the VertexBuffer object is already valid.
+		/// data:	pointer to the first element
+		/// count:	number of elements
+		/// offset:	offset to the start of the data in bytes
+		template<typename T>
+		void changeSubData(const T* data, const unsigned int& count, const unsigned int& offset) {
+			changeSubData(const_cast<void*>(static_cast<const void*>(data)), count * static_cast<unsigned int>(sizeof(T)), offset);
+		};
+
 		/// Checks if this IndexBuffer object is valid and corresponds to data on the GPU
 		bool isValid() { return valid; };
 		/// returns the used storage type
 		VertexBufferStorageType getStorageType() { return storageType; };
 		/// Returns the size of the stored data in bytes
 		unsigned int getSizeInBytes() { return sizeInBytes; };
+		/// Returns the data recorded on the CPU. Is empty if the engine is not running in headless mode
+		const std::vector<unsigned char>& getRecordedData() const { return recordedData; };
 	};
 	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -14,6 +14,9 @@ namespace SnackerEngine
 		case GL_FLOAT: return 4;
 		case GL_UNSIGNED_INT: return 4;
 		case GL_UNSIGNED_BYTE: return 1;
+		case GL_SHORT: return 2;
+		case GL_UNSIGNED_SHORT: return 2;
+		case GL_HALF_FLOAT: return 2;
 		default:
 			ASSERT(false);
 			break;
@@ -78,4 +81,36 @@ namespace SnackerEngine
 		stride += count * 3 * VertexBufferElement::GetSizeOfType(GL_FLOAT);
 	}
 	//------------------------------------------------------------------------------------------------------
+	template<>
+	// shorts are mapped to the range [-1, 1]
+	void VertexBufferLayout::push<short>(unsigned int count)
+	{
+		elements.push_back({ GL_SHORT, count, GL_TRUE });
+		stride += count * VertexBufferElement::GetSizeOfType(GL_SHORT);
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<>
+	// unsigned shorts are mapped to the range [0, 1]
+	void VertexBufferLayout::push<unsigned short>(unsigned int count)
+	{
+		elements.push_back({ GL_UNSIGNED_SHORT, count, GL_TRUE });
+		stride += count * VertexBufferElement::GetSizeOfType(GL_UNSIGNED_SHORT);
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<>
+	void VertexBufferLayout::push<HalfFloat>(unsigned int count)
+	{
+		elements.push_back({ GL_HALF_FLOAT, count, GL_FALSE });
+		stride += count * VertexBufferElement::GetSizeOfType(GL_HALF_FLOAT);
+	}
+	//------------------------------------------------------------------------------------------------------
+	bool VertexBufferLayout::operator==(const VertexBufferLayout& other) const
+	{
+		if (stride != other.stride || elements.size() != other.elements.size()) return false;
+		for (std::size_t i = 0; i < elements.size(); ++i) {
+			if (elements[i].type != other.elements[i].type || elements[i].count != other.elements[i].count || elements[i].normalized != other.elements[i].normalized) return false;
+		}
+		return true;
+	}
+	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
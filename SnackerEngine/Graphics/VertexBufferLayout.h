@@ -7,7 +7,8 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	struct VertexBufferElement
 	{
-		/// The type of this vertexBufferElement, can be GL_FLOAT, GL_UNSIGNED_INT, GL_UNSIGNED_BYTE
+		/// The type of this vertexBufferElement, can be GL_FLOAT, GL_UNSIGNED_INT, GL_UNSIGNED_BYTE,
+		/// GL_SHORT, GL_UNSIGNED_SHORT or GL_HALF_FLOAT
 		unsigned int type;
 		/// The number of elements of the above type
 		unsigned int count;
@@ -19,6 +20,13 @@ namespace SnackerEngine
 		static unsigned int GetSizeOfType(const unsigned int& type);
 	};
 	//------------------------------------------------------------------------------------------------------
+	/// 16-bit floating point number (IEEE 754 half precision) as it is stored on the GPU.
+	/// Only used as a storage type, e.g. for quantized vertex attributes (see MeshOptimizer.h)
+	struct HalfFloat
+	{
+		unsigned short bits;
+	};
+	//------------------------------------------------------------------------------------------------------
 	class VertexBufferLayout
 	{
 	private:
@@ -32,12 +40,14 @@ namespace SnackerEngine
 		// New data types can be defined in the .cpp file, if this is necessary!
 		// Currently supported types: 
 		//		float, unsigned int, unsigned char, Vec2<unsigned int>,
-		//		Vec3<unsigned int>, Vec2f, Vec3f
+		//		Vec3<unsigned int>, Vec2f, Vec3f, short, unsigned short, HalfFloat
 		template<typename T>
 		void push(unsigned int count);
 
 		const inline std::vector<VertexBufferElement> GetElements() const { return elements; }
 		const inline unsigned int GetStride() const { return stride; }
+		/// Returns true if both layouts have the same elements
+		bool operator==(const VertexBufferLayout& other) const;
 
 	};
 	//------------------------------------------------------------------------------------------------------
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Math/Vec.h"
+#include "Graphics/FrameBuffer.h"
+#include "Graphics/Texture.h"
+
+#include <memory>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// Stores the drawing of a GuiElement and its children in retained mode (see 
+	/// GuiElement::setRetainedDrawing()). The subtree is drawn into the texture of the frameBuffer
+	/// once, and afterwards only the texture is drawn until the cache is invalidated.
+	struct GuiDrawCache
+	{
+		/// The frameBuffer the subtree is drawn into. Is recreated when the size of the element changes
+		std::unique_ptr<FrameBuffer> frameBuffer = nullptr;
+		/// The texture attached to the frameBuffer
+		Texture texture{};
+		/// The size of the texture in pixels
+		Vec2i size{};
+		/// Is set to false whenever the subtree changes
+		bool valid = false;
+	};
+	//--------------------------------------------------------------------------------------------------
+}
@@ -1,6 +1,9 @@
 #include "Gui/GuiElement.h"
 #include "Gui/GuiManager.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 namespace SnackerEngine
 {
 	//--------------------------------------------------------------------------------------------------
@@ -65,7 +68,7 @@ namespace SnackerEngine
 	GuiElement::GuiElement(const GuiElement& other) noexcept
 		: guiManager(nullptr), name(""), guiID(-1), parentID(-1), depth(0), position(other.position), size(other.size),
 		resizeMode(other.resizeMode), sizeHints{ other.sizeHints.minSize, other.sizeHints.maxSize, other.sizeHints.preferredSize },
-		children{}, sortedChildren{}, guiElementAnimatables{}
+		children{}, sortedChildren{}, drawCache(other.drawCache ? std::make_unique<GuiDrawCache>() : nullptr), guiElementAnimatables{}
 	{
 	}
 	//--------------------------------------------------------------------------------------------------
@@ -84,6 +87,8 @@ namespace SnackerEngine
 		sizeHints = { other.sizeHints.minSize, other.sizeHints.maxSize, other.sizeHints.preferredSize };
 		children.clear();
 		sortedChildren.clear();
+		childIndex.clear();
+		drawCache = other.drawCache ? std::make_unique<GuiDrawCache>() : nullptr;
 		guiElementAnimatables.clear();
 		return *this;
 	}
@@ -91,7 +96,7 @@ namespace SnackerEngine
 	GuiElement::GuiElement(GuiElement&& other) noexcept
 		: guiManager(other.guiManager), name(other.name), guiID(other.guiID), parentID(other.parentID), depth(other.depth), position(other.position), size(other.size),
 		resizeMode(other.resizeMode), sizeHints{ other.sizeHints.minSize, other.sizeHints.maxSize, other.sizeHints.preferredSize }, 
-		children(std::move(other.children)), sortedChildren(std::move(other.sortedChildren)), guiElementAnimatables{ std::move(other.guiElementAnimatables) }
+		children(std::move(other.children)), sortedChildren(std::move(other.sortedChildren)), drawCache(std::move(other.drawCache)), guiElementAnimatables{ std::move(other.guiElementAnimatables) }
 	{
 		if (guiManager) guiManager->updateMoved(*this);
 		for (const auto& animatable : guiElementAnimatables) {
@@ -118,6 +123,8 @@ namespace SnackerEngine
 		sizeHints = { other.sizeHints.minSize, other.sizeHints.maxSize, other.sizeHints.preferredSize };
 		children = std::move(other.children);
 		sortedChildren = std::move(other.sortedChildren);
+		childIndex.clear();
+		drawCache = std::move(other.drawCache);
 		guiElementAnimatables = std::move(other.guiElementAnimatables);
 		for (const auto& animatable : guiElementAnimatables) {
 			animatable->element = this;
@@ -136,6 +143,8 @@ namespace SnackerEngine
 			if (guiManager->registerElementAsChild(*this, guiElement)) {
 				children.push_back(guiElement.guiID);
 				sortedChildren.push_back(guiElement.guiID);
+				childIndex.invalidate();
+				invalidateDraw();
 				return true;
 			}
 		}
@@ -176,6 +185,8 @@ namespace SnackerEngine
 		if (this->position != position) {
 			this->position = position;
 			registerEnforceLayoutUp();
+			invalidateParentChildIndex();
+			invalidateParentDraw();
 			onPositionChange();
 		}
 	}
@@ -185,6 +196,8 @@ namespace SnackerEngine
 		if (this->position.x != positionX) {
 			this->position.x = positionX;
 			registerEnforceLayoutUp();
+			invalidateParentChildIndex();
+			invalidateParentDraw();
 			onPositionChange();
 		}
 	}
@@ -194,6 +207,8 @@ namespace SnackerEngine
 		if (this->position.y != positionY) {
 			this->position.y = positionY;
 			registerEnforceLayoutUp();
+			invalidateParentChildIndex();
+			invalidateParentDraw();
 			onPositionChange();
 		}
 	}
@@ -203,6 +218,8 @@ namespace SnackerEngine
 		if (this->size != size) {
 			this->size = size;
 			if (guiManager) guiManager->registerForEnforcingLayoutsUpAndDown(guiID);
+			invalidateParentChildIndex();
+			invalidateDraw();
 			onSizeChange();
 		}
 	}
@@ -212,6 +229,8 @@ namespace SnackerEngine
 		if (this->size.x != width) {
 			this->size.x = width;
 			if (guiManager) guiManager->registerForEnforcingLayoutsUpAndDown(guiID);
+			invalidateParentChildIndex();
+			invalidateDraw();
 			onSizeChange();
 		}
 	}
@@ -221,6 +240,8 @@ namespace SnackerEngine
 		if (this->size.y != height) {
 			this->size.y = height;
 			if (guiManager) guiManager->registerForEnforcingLayoutsUpAndDown(guiID);
+			invalidateParentChildIndex();
+			invalidateDraw();
 			onSizeChange();
 		}
 	}
@@ -401,7 +422,7 @@ namespace SnackerEngine
 		if (clipChildren) pushClippingBox(worldPosition);
 		for (const auto& childID : sortedChildren) {
 			auto child = getElement(childID);
-			if (child) child->draw(worldPosition + child->getPosition());
+			if (child) drawElement(childID, worldPosition + child->getPosition());
 		}
 		if (clipChildren) popClippingBox();
 	}
@@ -413,6 +434,8 @@ namespace SnackerEngine
 		{
 			if (guiManager) guiManager->signOffWithoutNotifyingParent(children[index.value()]);
 			children.erase(children.begin() + index.value());
+			childIndex.invalidate();
+			invalidateDraw();
 			for (auto it = sortedChildren.begin(); it != sortedChildren.end(); ++it) {
 				if (*it == guiElement) {
 					sortedChildren.erase(it);
@@ -460,9 +483,33 @@ namespace SnackerEngine
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
+	void GuiElement::getCurrentChildLayouts(std::vector<ChildLayout>& childLayouts) const
+	{
+		childLayouts.clear();
+		childLayouts.reserve(children.size());
+		for (const auto& childID : children) {
+			const GuiElement* child = getElement(childID);
+			if (child) childLayouts.push_back({ childID, child->getPosition(), child->getSize() });
+			else childLayouts.push_back({ childID, Vec2i(), Vec2i() });
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool GuiElement::getLayout(std::vector<ChildLayout>& childLayouts)
+	{
+		if (guiManager && guiManager->takePrecomputedLayout(guiID, childLayouts)) return true;
+		return computeLayout(childLayouts);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiElement::applyLayout(const std::vector<ChildLayout>& childLayouts)
+	{
+		for (const auto& childLayout : childLayouts) {
+			setPositionAndSizeOfChild(childLayout.childID, childLayout.position, childLayout.size);
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
 	void GuiElement::registerElementAsChild(GuiElement& guiElement)
 	{
-		if (guiManager) guiManager->registerElementAsChild(*this, guiElement);
+		if (guiManager && guiManager->registerElementAsChild(*this, guiElement)) invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	Vec2i GuiElement::getChildOffset(const GuiID& childID) const
@@ -488,11 +535,15 @@ namespace SnackerEngine
 	void GuiElement::setPositionInternal(const Vec2i& position)
 	{
 		this->position = position;
+		invalidateParentChildIndex();
+		invalidateParentDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiElement::setSizeInternal(const Vec2i& size)
 	{
 		this->size = size;
+		invalidateParentChildIndex();
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiElement::bringChildToForeground(GuiID childID)
@@ -501,6 +552,8 @@ namespace SnackerEngine
 			if (*it == childID) {
 				sortedChildren.erase(it);
 				sortedChildren.push_back(childID);
+				childIndex.invalidate();
+				invalidateDraw();
 				return;
 			}
 		}
@@ -514,7 +567,9 @@ namespace SnackerEngine
 	void GuiElement::drawElement(GuiID element, Vec2i worldPosition)
 	{
 		GuiElement* guiElement = getElement(element);
-		if (guiElement) guiElement->draw(worldPosition);
+		if (!guiElement) return;
+		if (guiElement->drawCache) guiManager->drawRetained(*guiElement, worldPosition);
+		else guiElement->draw(worldPosition);
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiElement::registerEnforceLayoutUp()
@@ -522,6 +577,63 @@ namespace SnackerEngine
 		if (guiManager) guiManager->registerForEnforcingLayoutsUp(guiID);
 	}
 	//--------------------------------------------------------------------------------------------------
+	void GuiElement::setRetainedDrawing(bool retainedDrawing)
+	{
+		if (retainedDrawing == (drawCache != nullptr)) return;
+		if (retainedDrawing) drawCache = std::make_unique<GuiDrawCache>();
+		else drawCache = nullptr;
+		invalidateParentDraw();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiElement::invalidateDraw()
+	{
+		if (drawCache) drawCache->valid = false;
+		invalidateParentDraw();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiElement::invalidateParentDraw()
+	{
+		if (!guiManager) return;
+		GuiID currentID = parentID;
+		while (currentID >= 0) {
+			GuiElement* element = guiManager->registeredGuiElements[currentID];
+			if (!element) return;
+			if (element->drawCache) element->drawCache->valid = false;
+			currentID = element->parentID;
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool GuiElement::updateChildIndex() const
+	{
+		if (!guiManager || children.size() < GuiSpatialIndex::minEntryCount) return false;
+		if (childIndex.isValid() && childIndex.getEntryCount() == children.size()) return true;
+		if (!childIndex.shouldRebuild()) return false;
+		std::vector<GuiSpatialIndex::Rect> rects;
+		rects.reserve(children.size());
+		for (const auto& childID : children) {
+			const GuiElement* child = getElement(childID);
+			if (child) rects.push_back({ child->position, child->position + child->size });
+			else rects.push_back({ Vec2i(0, 0), Vec2i(-1, -1) });
+		}
+		childIndex.build(std::move(rects));
+		// The children and sortedChildren vectors contain the same elements in different order
+		std::unordered_map<GuiID, unsigned int> childIndices;
+		for (unsigned int i = 0; i < children.size(); ++i) childIndices[children[i]] = i;
+		childDrawOrder.assign(children.size(), 0);
+		for (unsigned int i = 0; i < sortedChildren.size(); ++i) {
+			auto it = childIndices.find(sortedChildren[i]);
+			if (it != childIndices.end()) childDrawOrder[it->second] = i;
+		}
+		return true;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiElement::invalidateParentChildIndex()
+	{
+		if (!guiManager || parentID < 0) return;
+		GuiElement* parent = guiManager->registeredGuiElements[parentID];
+		if (parent) parent->childIndex.invalidate();
+	}
+	//--------------------------------------------------------------------------------------------------
 	void GuiElement::setPositionAndSizeOfChild(const GuiID& guiID, const Vec2i& position, const Vec2i& size)
 	{
 		if (!guiManager) return;
@@ -530,12 +642,16 @@ namespace SnackerEngine
 		if (child->position != position)
 		{
 			child->position = position;
+			childIndex.invalidate();
+			invalidateDraw();
 			child->onPositionChange();
 		}
 		if (child->size != size)
 		{
 			child->size = size;
 			guiManager->registerForEnforcingLayoutsDown(guiID);
+			childIndex.invalidate();
+			child->invalidateDraw();
 			child->onSizeChange();
 		}
 	}
@@ -548,6 +664,8 @@ namespace SnackerEngine
 		if (child->position != position)
 		{
 			child->position = position;
+			childIndex.invalidate();
+			invalidateDraw();
 			child->onPositionChange();
 		}
 	}
@@ -560,6 +678,8 @@ namespace SnackerEngine
 		if (child->position.x != positionX)
 		{
 			child->position.x = positionX;
+			childIndex.invalidate();
+			invalidateDraw();
 			child->onPositionChange();
 		}
 	}
@@ -572,6 +692,8 @@ namespace SnackerEngine
 		if (child->position.y != positionY)
 		{
 			child->position.y = positionY;
+			childIndex.invalidate();
+			invalidateDraw();
 			child->onPositionChange();
 		}
 	}
@@ -585,6 +707,8 @@ namespace SnackerEngine
 		{
 			child->size = size;
 			guiManager->registerForEnforcingLayoutsDown(guiID);
+			childIndex.invalidate();
+			child->invalidateDraw();
 			child->onSizeChange();
 		}
 	}
@@ -598,6 +722,8 @@ namespace SnackerEngine
 		{
 			child->size.x = width;
 			guiManager->registerForEnforcingLayoutsDown(guiID);
+			childIndex.invalidate();
+			child->invalidateDraw();
 			child->onSizeChange();
 		}
 	}
@@ -611,6 +737,8 @@ namespace SnackerEngine
 		{
 			child->size.y = height;
 			guiManager->registerForEnforcingLayoutsDown(guiID);
+			childIndex.invalidate();
+			child->invalidateDraw();
 			child->onSizeChange();
 		}
 	}
@@ -673,6 +801,21 @@ namespace SnackerEngine
 	GuiID GuiElement::getCollidingChild(const Vec2i& offset) const
 	{
 		if (!guiManager) return 0;
+		if (updateChildIndex()) {
+			// Only children whose bounding box contains the offset can collide. Test them from the
+			// foreground to the background, like below
+			childIndex.query(offset, childIndexQueryResult);
+			std::sort(childIndexQueryResult.begin(), childIndexQueryResult.end(), [this](unsigned int a, unsigned int b) {
+				return childDrawOrder[a] > childDrawOrder[b];
+				});
+			for (unsigned int index : childIndexQueryResult) {
+				auto child = getElement(children[index]);
+				IsCollidingResult result = child ? child->isColliding(offset - child->getPosition()) : IsCollidingResult::NOT_COLLIDING;
+				GuiID childCollision = getCollidingChild(result, children[index], offset);
+				if (childCollision > 0) return childCollision;
+			}
+			return 0;
+		}
 		for (auto it = sortedChildren.rbegin(); it != sortedChildren.rend(); ++it) {
 			auto child = getElement(*it);
 			IsCollidingResult result = child ? child->isColliding(offset - child->getPosition()) : IsCollidingResult::NOT_COLLIDING;
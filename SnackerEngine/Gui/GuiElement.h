@@ -3,6 +3,8 @@
 #include "Math/Vec.h"
 #include "Utility/Json.h"
 #include "Gui/SizeHints.h"
+#include "Gui/GuiSpatialIndex.h"
+#include "Gui/GuiDrawCache.h"
 #include "Gui\Text\Font.h"
 #include "Gui\GuiID.h"
 #include "Gui\GuiAnimatable.h"
@@ -11,6 +13,7 @@
 #include <vector>
 #include <optional>
 #include <set>
+#include <memory>
 
 namespace SnackerEngine
 {
@@ -105,6 +108,17 @@ namespace SnackerEngine
 		void setPreferredHeight(const int& preferredHeight);
 		void setResizeMode(ResizeMode resizeMode) { this->resizeMode = resizeMode; }
 		void setClipChildren(bool clipCildren) { this->clipChildren = clipChildren; }
+		/// Enables or disables retained drawing of this element and its children. In retained mode, the
+		/// subtree is drawn into a texture once, and afterwards only this texture is drawn with a single
+		/// quad, until the position, size or appearance of any element in the subtree changes. Meant for
+		/// mostly static subtrees, e.g. windows or layouts. Since the texture is blended twice,
+		/// subtrees should have an opaque background.
+		void setRetainedDrawing(bool retainedDrawing);
+		bool isRetainedDrawing() const { return drawCache != nullptr; }
+		/// Tells all retained ancestors of this element (and the element itself) that their drawing 
+		/// is outdated. Has to be called by derived GuiElements whenever their appearance changes
+		/// without a change in position or size
+		void invalidateDraw();
 		/// Getters
 		const std::string& getName() const { return name; }
 		GuiID getGuiID() const { return guiID; }
@@ -169,6 +183,25 @@ namespace SnackerEngine
 		std::vector<GuiID> sortedChildren{};
 		/// Wether or not one should clip children when drawing this guiElement
 		bool clipChildren = true;
+		/// The drawing of this element and its children, if retained drawing is enabled. nullptr otherwise
+		std::unique_ptr<GuiDrawCache> drawCache = nullptr;
+		/// Tells all retained ancestors of this element that their drawing is outdated, eg. because
+		/// this element moved. The drawing of this element itself stays valid
+		void invalidateParentDraw();
+		/// Spatial index over the bounding boxes of the children, entries are in the order of the children
+		/// vector. Only used by elements with many children, see updateChildIndex()
+		mutable GuiSpatialIndex childIndex{};
+		/// For each entry of the children vector, its index in the sortedChildren vector. Computed together
+		/// with the childIndex
+		mutable std::vector<unsigned int> childDrawOrder{};
+		/// Stores the result of the last query of the childIndex
+		mutable std::vector<unsigned int> childIndexQueryResult{};
+		/// Rebuilds the childIndex if it is outdated. Returns false if this element has too few children
+		/// for an index to pay off or if the children changed very recently, in which case all children
+		/// should be tested directly
+		bool updateChildIndex() const;
+		/// Tells the parent element that the bounding box of this element changed
+		void invalidateParentChildIndex();
 		/// Tells this GuiElement object that the guiManager was deleted.
 		virtual void signOff();
 		/// Friend classes
@@ -200,6 +233,28 @@ namespace SnackerEngine
 		/// layout rules, if there are any. May register children and/or parent for
 		/// enforcing layouts as well
 		virtual void enforceLayout();
+		/// Position and size of a single child, as computed by computeLayout()
+		struct ChildLayout
+		{
+			GuiID childID;
+			Vec2i position;
+			Vec2i size;
+		};
+		/// Computes the positions and sizes of all children according to layout rules without changing
+		/// anything, and stores them in childLayouts (one entry per child, in the order of the children 
+		/// vector). Returns false if the layout can not be computed this way, in which case 
+		/// enforceLayout() has to do all the work. The GuiManager calls this function on worker threads
+		/// for many elements at once, so it may only read this element and its children! Derived
+		/// classes that change enforceLayout() have to override this function as well
+		virtual bool computeLayout(std::vector<ChildLayout>& childLayouts) const { return false; }
+		/// Fills childLayouts with the current positions and sizes of all children
+		void getCurrentChildLayouts(std::vector<ChildLayout>& childLayouts) const;
+		/// Gets the layout that was computed in advance by the GuiManager, or calls computeLayout()
+		/// if there is none. Returns false if no layout could be computed
+		bool getLayout(std::vector<ChildLayout>& childLayouts);
+		/// Sets the positions and sizes of all children to the given layout. Calls onPositionChange()
+		/// and onSizeChange() on all children that changed
+		void applyLayout(const std::vector<ChildLayout>& childLayouts);
 		/// Registers an element at the guiManager without pushing it to the children
 		/// vector (Used for registering guiElements that are part of other
 		/// guiElements, eg. the window bar of a window element)
@@ -261,7 +316,9 @@ namespace SnackerEngine
 			COLLIDE_STRONG,				/// Collision detected, no child elements should be checked!
 		};
 		/// Returns how the given offset vector (relative to the top left corner of the guiElement)
-		/// collides with this element
+		/// collides with this element. Offsets outside of the bounding box of the element must not
+		/// collide, since parents with many children only test the children whose bounding box
+		/// contains the offset (see updateChildIndex())
 		virtual IsCollidingResult isColliding(const Vec2i& offset) const;
 		/// Helper function that returns true if a collision occured inside the bounding box given by
 		/// the position and size of this element
@@ -293,6 +350,7 @@ namespace SnackerEngine
 			MOUSE_LEAVE,
 			UPDATE,
 			DRAW_ON_TOP,
+			GLYPHS_ADDED,
 		};
 
 		/// This function can be called by derived GuiElement objects to register themselves for getting 
@@ -328,6 +386,9 @@ namespace SnackerEngine
 		/// in this function.
 		/// worldPosition:		position of the upper left corner of the element in world space
 		virtual void callbackDrawOnTop(const Vec2i& worldPosition) {};
+		/// Callback function that is called in the update step after glyphs that were generated in the
+		/// background were added to the font atlases (see FontManager::update()), before layouts are enforced
+		virtual void callbackGlyphsAdded() {};
 
 		//==============================================================================================
 		// ClippingBoxes (Scissor test) for rendering
@@ -173,6 +173,7 @@ namespace SnackerEngine
 		if (!guiManager) return;
 		if (checked && drawCheckMark && checkMarkColor.alpha != 0.0f)
 		{
+			guiManager->flushQuadBatch();
 			checkMarkShader.bind();
 			guiManager->setUniformViewAndProjectionMatrices(checkMarkShader);
 			int trueCheckMarkSize = checkMarkSize;
@@ -17,6 +17,7 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiEditBox::computeTextOffsetAndCursorOffset()
 	{
+		invalidateDraw();
 		if (!dynamicText) return;
 		// Compute "normal" text position (without cursor)
 		textPosition = computeTextPosition();
@@ -41,6 +42,7 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiEditBox::computeTextOffsetAndCursorOffsetKeepTextOffset()
 	{
+		invalidateDraw();
 		if (!dynamicText) return;
 		// If the text width is small enough that the text can fit, or if we anyways scale the text to fit, call default procedure
 		if (!repositionTextToFitCursor || !active || getTextSize().x < getWidth() - getLeftBorder() - getRightBorder()) {
@@ -73,6 +75,7 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiEditBox::computeTextOffsetAndCursorOffsetKeepCursorOffset()
 	{
+		invalidateDraw();
 		if (!dynamicText) return;
 		// If the text width is small enough that the text can fit, call default procedure
 		if (!repositionTextToFitCursor || !active || getTextSize().x < getWidth() - getLeftBorder() - getRightBorder()) {
@@ -104,6 +107,7 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiEditBox::computeTextOffsetAndCursorOffsetAdvanceCursor()
 	{
+		invalidateDraw();
 		if (!dynamicText) return;
 		// If the text width is small enough that the text can fit, call default procedure
 		if (!repositionTextToFitCursor || !active || getTextSize().x < getWidth() - getLeftBorder() - getRightBorder()) {
@@ -138,6 +142,7 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiEditBox::computeModelMatrixCursor()
 	{
+		invalidateDraw();
 		Vec2f cursorSize = static_cast<EditableText&>(*dynamicText).getCursorSize();
 		cursorSize.x = pointsToPixels(cursorSize.x);
 		cursorSize.y = pointsToPixels(cursorSize.y) * scaleFactor;
@@ -147,6 +152,7 @@ namespace SnackerEngine
 	void GuiEditBox::computeModelMatricesSelectionBoxes()
 	{
 		if (!dynamicText) return;
+		invalidateDraw();
 		modelMatricesSelectionBoxes.clear();
 		auto result = static_cast<EditableText&>(*dynamicText).getSelectionBoxes();
 		if (result.empty()) return;
@@ -267,6 +273,7 @@ namespace SnackerEngine
 		pushClippingBox(worldPosition);
 		for (const auto& modelMatrixSelectionBox : modelMatricesSelectionBoxes) {
 			Shader tempShader = guiManager->getAlphaColorShader();
+			guiManager->flushQuadBatch();
 			tempShader.bind();
 			guiManager->setUniformViewAndProjectionMatrices(tempShader);
 			tempShader.setUniform<Mat4f>("u_model", translationMatrix * modelMatrixSelectionBox);
@@ -279,6 +286,7 @@ namespace SnackerEngine
 		// Draw cursor
 		if (cursorIsVisible) {
 			Shader tempShader = guiManager->getAlphaColorShader();
+			guiManager->flushQuadBatch();
 			tempShader.bind();
 			guiManager->setUniformViewAndProjectionMatrices(tempShader);
 			tempShader.setUniform<Mat4f>("u_model", translationMatrix * modelMatrixCursor);
@@ -585,6 +593,7 @@ namespace SnackerEngine
 		if (active) {
 			if (cursorBlinkingTimer.tick(dt).first) {
 				cursorIsVisible = !cursorIsVisible;
+				invalidateDraw();
 			}
 		}
 	}
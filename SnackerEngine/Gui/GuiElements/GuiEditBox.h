@@ -119,6 +119,8 @@ namespace SnackerEngine
 		virtual void onRegister() override;
 		/// This function gets called when the size changes. Not called by the constructor!
 		virtual void onSizeChange() override;
+		/// The EditableText edits its model in place, so it is never drawn from glyph instances
+		virtual bool supportsInstancedRendering() const override { return false; }
 		
 		//==============================================================================================
 		// Collisions
@@ -74,6 +74,7 @@ namespace SnackerEngine
 	void GuiImage::setImageTexture(const Texture& texture)
 	{
 		this->texture = texture; 
+		invalidateDraw();
 		if (guiImageSizeHintMode == GuiImageSizeHintMode::DYNAMIC) {
 			if (texture.getSize().x > texture.getSize().y) tryForLargestWidth = true;
 			else tryForLargestWidth = false;
@@ -85,6 +86,7 @@ namespace SnackerEngine
 	{
 		if (this->guiImageSizeHintMode != guiImageSizeHintMode) {
 			this->guiImageSizeHintMode = guiImageSizeHintMode;
+			invalidateDraw();
 			if (guiImageSizeHintMode == GuiImageSizeHintMode::DYNAMIC) {
 				if (texture.getSize().x > texture.getSize().y) tryForLargestWidth = true;
 				else tryForLargestWidth = false;
@@ -101,6 +103,14 @@ namespace SnackerEngine
 		// Draw background
 		GuiPanel::draw(worldPosition);
 		// Draw image
+		if (imageShader == defaultImageShader) {
+			// modelMatrixImage only translates and scales the unit square
+			guiManager->getQuadBatch().addImage(
+				Vec2f(static_cast<float>(worldPosition.x) + modelMatrixImage.data[3], static_cast<float>(-worldPosition.y) + modelMatrixImage.data[7]),
+				Vec2f(modelMatrixImage.data[0], modelMatrixImage.data[5]), texture);
+			return;
+		}
+		guiManager->flushQuadBatch();
 		imageShader.bind();
 		guiManager->setUniformViewAndProjectionMatrices(imageShader);
 		imageShader.setUniform<Mat4f>("u_model", translationMatrix * modelMatrixImage);
@@ -78,53 +78,62 @@ namespace SnackerEngine
 	void GuiPanel::setBackgroundColor(const Color4f& backgroundColor)
 	{
 		this->backgroundColor = backgroundColor;
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiPanel::setBorderColor(const Color4f& borderColor)
 	{
 		this->borderColor = borderColor;
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiPanel::setRoundedCorners(float roundedCorners)
 	{
 		this->roundedCorners = Vec4f(roundedCorners);
 		selectShader();
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiPanel::setRoundedCorners(const Vec4f& roundedCorners)
 	{
 		this->roundedCorners = roundedCorners;
 		selectShader();
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiPanel::setRoundedCornersTopLeft(float roundedCornersTopLeft)
 	{
 		this->roundedCorners[0] = roundedCornersTopLeft;
 		selectShader();
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiPanel::setRoundedCornersTopRight(float roundedCornersTopRight)
 	{
 		this->roundedCorners[1] = roundedCornersTopRight;
 		selectShader();
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiPanel::setRoundedCornersBottomRight(float roundedCornersBottomRight)
 	{
 		this->roundedCorners[2] = roundedCornersBottomRight;
 		selectShader();
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiPanel::setRoundedCornersBottomLeft(float roundedCornersBottomLeft)
 	{
 		this->roundedCorners[2] = roundedCornersBottomLeft;
 		selectShader();
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiPanel::setBorderThickness(float borderThickness)
 	{
 		this->borderThickness = borderThickness;
 		selectShader();
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiPanel::draw(const Vec2i& worldPosition, const Mat4f& transformMatrix)
@@ -325,23 +334,11 @@ namespace SnackerEngine
 		if (!guiManager) return;
 		if (backgroundColor.alpha != 0.0f || borderColor.alpha != 0.0f)
 		{
-			shader.bind();
-			guiManager->setUniformViewAndProjectionMatrices(shader);
-			Mat4f translationMatrix = Mat4f::Translate(Vec3f(static_cast<float>(worldPosition.x), static_cast<float>(-worldPosition.y), 0.0f));
-			shader.setUniform<Mat4f>("u_model", translationMatrix * modelMatrix);
-			shader.setUniform<Color4f>("u_color", backgroundColor);
-			if (roundedCorners != 0.0f || borderThickness != 0.0f) {
-				shader.setUniform<Vec2f>("u_size", getSize());
-				if (!roundedCorners.isZero()) {
-					if (roundedCorners.allEqual()) shader.setUniform<float>("u_roundedCorners", roundedCorners[0]);
-					else shader.setUniform<Vec4f>("u_roundedCorners", roundedCorners);
-				}
-				if (borderThickness != 0.0f) {
-					shader.setUniform<float>("u_borderThickness", borderThickness);
-					shader.setUniform<Color4f>("u_borderColor", borderColor);
-				}
-			}
-			Renderer::draw(guiManager->getModelSquare());
+			const Vec2i& size = getSize();
+			guiManager->getQuadBatch().addPanel(GuiQuadBatch::QuadInstance{
+				Vec2f(static_cast<float>(worldPosition.x), static_cast<float>(-worldPosition.y - size.y)),
+				Vec2f(static_cast<float>(size.x), static_cast<float>(size.y)),
+				backgroundColor, borderColor, roundedCorners, borderThickness });
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
@@ -351,6 +348,8 @@ namespace SnackerEngine
 		if (!guiManager) return;
 		if (backgroundColor.alpha != 0.0f || borderColor.alpha != 0.0f)
 		{
+			// Arbitrary transformations are not supported by the quad batch
+			guiManager->flushQuadBatch();
 			shader.bind();
 			guiManager->setUniformViewAndProjectionMatrices(shader);
 			Mat4f translationMatrix = Mat4f::Translate(Vec3f(static_cast<float>(worldPosition.x), static_cast<float>(-worldPosition.y), 0.0f));
@@ -13,6 +13,7 @@ namespace SnackerEngine
 		transformMatrix = Mat4f::TranslateAndScale(
 			Vec3f(offset.x, offset.y, 0),
 			Vec3f(currentButtonScale));
+		invalidateDraw();
 	}
 
 	void GuiScaleButton::setCurrentButtonScale(float currentButtonScale)
@@ -196,6 +196,7 @@ namespace SnackerEngine
 		// Draw drop down symbol
 		if (drawDropDownSymbol && ((optionListLayout && optionListLayout->isValid() && dropDownSymbolColorOpen.alpha != 0.0f) || ((!optionListLayout || !optionListLayout->isValid()) && dropDownSymbolColorClosed.alpha != 0.0f))) {
 			//pushClippingBox(worldPosition);
+			getGuiManager()->flushQuadBatch();
 			dropDownSymbolShader.bind();
 			getGuiManager()->setUniformViewAndProjectionMatrices(dropDownSymbolShader);
 			Vec2i trueDropDownSymbolSize = dropDownSymbolSize;
@@ -184,8 +184,8 @@ namespace SnackerEngine
 		void setHoverButtonScale(float hoverButtonScale) override;
 		void setPressedButtonScale(float pressedButtonScale) override;
 		void setPressedHoverButtonScale(float pressedHoverButtonScale) override;
-		void setDropDownSymbolColorOpen(const Color4f& dropDownSymbolColorOpen) { this->dropDownSymbolColorOpen = dropDownSymbolColorOpen; }
-		void setDropDownSymbolColorClosed(const Color4f& dropDownSymbolColorClosed) { this->dropDownSymbolColorClosed = dropDownSymbolColorClosed; }
+		void setDropDownSymbolColorOpen(const Color4f& dropDownSymbolColorOpen) { this->dropDownSymbolColorOpen = dropDownSymbolColorOpen; invalidateDraw(); }
+		void setDropDownSymbolColorClosed(const Color4f& dropDownSymbolColorClosed) { this->dropDownSymbolColorClosed = dropDownSymbolColorClosed; invalidateDraw(); }
 		void setDropDownSymbolTextureOpen(const Texture& dropDownSymbolTextureOpen) { this->dropDownSymbolTextureOpen = dropDownSymbolTextureOpen; }
 		void setDropDownSymbolTextureClosed(const Texture& dropDownSymbolTextureClosed) { this->dropDownSymbolTextureClosed = dropDownSymbolTextureClosed; }
 		void setDropDownSymbolShader(const Shader& dropDownSymbolShader) { this->dropDownSymbolShader = dropDownSymbolShader; }
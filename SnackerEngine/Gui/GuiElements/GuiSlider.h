@@ -95,7 +95,7 @@ namespace SnackerEngine
 		VariableHandle<T>& getVariableHandle() { return value; }
 		/// Setters
 		void setSliderButtonWidth(int sliderButtonWidth);
-		void setSliderButtonColor(const Color4f& sliderButtonColor) { this->sliderButtonColor = sliderButtonColor; }
+		void setSliderButtonColor(const Color4f& sliderButtonColor) { this->sliderButtonColor = sliderButtonColor; invalidateDraw(); }
 		void setSliderButtonShader(const Shader& sliderButtonShader) { this->shader = sliderButtonShader; }
 		void setValue(const T& value);
 		void setMinValue(const T& minValue);
@@ -391,6 +391,7 @@ namespace SnackerEngine
 		if (!guiManager) return;
 		pushClippingBox(worldPosition);
 		// Draw Slider Button
+		guiManager->flushQuadBatch();
 		sliderButtonShader.bind();
 		guiManager->setUniformViewAndProjectionMatrices(sliderButtonShader);
 		Mat4f translationMatrix = Mat4f::Translate(Vec3f(static_cast<float>(worldPosition.x), static_cast<float>(-worldPosition.y), 0.0f));
@@ -429,6 +430,7 @@ namespace SnackerEngine
 	inline void GuiSlider<T>::computeSliderButtonModelMatrix()
 	{
 		sliderButtonModelMatrix = Mat4f::TranslateAndScale(Vec3i(sliderButtonOffsetX, -getHeight(), 0), Vec3i(sliderButtonWidth, getHeight(), 0));
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	template<typename T>
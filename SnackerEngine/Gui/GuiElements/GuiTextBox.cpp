@@ -12,6 +12,7 @@ namespace SnackerEngine
 	Color4f GuiTextBox::defaultTextColor = Color4f(1.0f, 1.0f);
 	Color4f GuiTextBox::defaultBackgroundColor = Color4f(0.0f, 0.0f);
 	unsigned GuiTextBox::defaultRecomputeTries = 10;
+	bool GuiTextBox::defaultInstancedRendering = false;
 	GuiTextBox::SizeHintModes GuiTextBox::defaultSizeHintModes = { GuiTextBox::SizeHintMode::ARBITRARY, GuiTextBox::SizeHintMode::ARBITRARY, GuiTextBox::SizeHintMode::ARBITRARY };
 	//--------------------------------------------------------------------------------------------------
 	/// Helper functions for parsing JSON
@@ -138,11 +139,13 @@ namespace SnackerEngine
 		}
 		Vec2f textPosition = computeTextPosition();
 		if (dynamicText) modelMatrixText = Mat4f::TranslateAndScale(Vec3f(textPosition.x, textPosition.y, 0), Vec3f(static_cast<float>(pointsToPixels(dynamicText->getFontSize()) * scaleFactor)));
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiTextBox::recomputeText()
 	{
 		if (!dynamicText) return;
+		invalidateDraw();
 		if (textScaleMode == TextScaleMode::RECOMPUTE_DOWN) {
 			dynamicText->setTextWidth((getWidth() - leftBorder - rightBorder) / pointsToPixels(1.0f), false);
 			dynamicText->setFontSize(fontSize, false);
@@ -220,6 +223,7 @@ namespace SnackerEngine
 			computeModelMatrices();
 		}
 		//infoLogger << LOGGER::BEGIN << "Recomputed text! size: " << dynamicText->getTextSize() << LOGGER::ENDL;
+		if (instancedTextMesh) instancedTextMesh->update(*dynamicText);
 		computeHeightHints();
 		computeWidthHints();
 	}
@@ -228,7 +232,8 @@ namespace SnackerEngine
 	{
 		GuiPanel::onRegister();
 		this->dynamicText = std::move(dynamicText);
-		material = constructTextMaterial(font, textColor, getBackgroundColor());
+		signUpEvent(CallbackType::GLYPHS_ADDED);
+		applyInstancedRendering();
 		computeModelMatrices();
 		computeHeightHints();
 		computeWidthHints();
@@ -310,15 +315,12 @@ namespace SnackerEngine
 		if (!guiManager) return;
 		if (dynamicText) {
 			Mat4f translationMatrix = Mat4f::Translate(Vec3f(static_cast<float>(worldPosition.x), static_cast<float>(-worldPosition.y), 0.0f));
+			guiManager->flushQuadBatch();
 			material.bind();
 			guiManager->setUniformViewAndProjectionMatrices(material.getShader());
 			material.getShader().setUniform<Mat4f>("u_model", translationMatrix * modelMatrixText);
 			material.getShader().setUniform<float>("u_pxRange", static_cast<float>(dynamicText->getFont().getPixelRange()));
-			if (textColor.has_value()) {
-				material.getShader().setUniform<SnackerEngine::Color4f>("u_color", textColor.value());
-				SnackerEngine::Renderer::draw(dynamicText->getModel());
-			}
-			else SnackerEngine::Renderer::draw(dynamicText->getModel(), material);
+			drawTextModel(textColor);
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
@@ -328,15 +330,12 @@ namespace SnackerEngine
 		if (!guiManager) return;
 		if (dynamicText) {
 			Mat4f translationMatrix = Mat4f::Translate(Vec3f(static_cast<float>(worldPosition.x), static_cast<float>(-worldPosition.y), 0.0f));
+			guiManager->flushQuadBatch();
 			material.bind();
 			guiManager->setUniformViewAndProjectionMatrices(material.getShader());
 			material.getShader().setUniform<Mat4f>("u_model", translationMatrix * transformMatrix * modelMatrixText);
 			material.getShader().setUniform<float>("u_pxRange", static_cast<float>(dynamicText->getFont().getPixelRange()));
-			if (textColor.has_value()) {
-				material.getShader().setUniform<SnackerEngine::Color4f>("u_color", textColor.value());
-				SnackerEngine::Renderer::draw(dynamicText->getModel());
-			}
-			else SnackerEngine::Renderer::draw(dynamicText->getModel(), material);
+			drawTextModel(textColor);
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
@@ -414,12 +413,38 @@ namespace SnackerEngine
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
-	Material GuiTextBox::constructTextMaterial(const Font& font, const Color4f& textColor, const Color4f& backgroundColor)
+	Material GuiTextBox::constructTextMaterial(const Font& font, const Color4f& textColor, const Color4f& backgroundColor, bool instanced)
 	{
-		return Material(std::move(std::make_unique<SimpleTextMaterialData>(Shader("shaders/gui/basic2DText.shader"),
+		return Material(std::move(std::make_unique<SimpleTextMaterialData>(Shader(instanced ? "shaders/gui/instancedText.shader" : "shaders/gui/basic2DText.shader"),
 			font, textColor)));
 	}
 	//--------------------------------------------------------------------------------------------------
+	void GuiTextBox::applyInstancedRendering()
+	{
+		if (!dynamicText) return;
+		if (instancedRendering && supportsInstancedRendering()) {
+			// Only the layout of the text is needed, the instances are computed from it
+			dynamicText->setModelEnabled(false);
+			if (!instancedTextMesh) instancedTextMesh = std::make_unique<InstancedTextMesh>();
+			instancedTextMesh->update(*dynamicText);
+		}
+		else if (instancedTextMesh) {
+			instancedTextMesh = nullptr;
+			dynamicText->setModelEnabled(true);
+		}
+		material = constructTextMaterial(font, textColor, getBackgroundColor(), instancedTextMesh != nullptr);
+		invalidateDraw();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiTextBox::drawTextModel(std::optional<Color4f> textColor)
+	{
+		if (textColor.has_value()) material.getShader().setUniform<SnackerEngine::Color4f>("u_color", textColor.value());
+		// The material was already bound by drawText()
+		if (instancedTextMesh) instancedTextMesh->draw();
+		else if (textColor.has_value()) SnackerEngine::Renderer::draw(dynamicText->getModel());
+		else SnackerEngine::Renderer::draw(dynamicText->getModel(), material);
+	}
+	//--------------------------------------------------------------------------------------------------
 	GuiTextBox::GuiTextBox(const Vec2i& position, const Vec2i& size, const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const Color4f& backgroundColor)
 		: GuiPanel(position, size, ResizeMode::RESIZE_RANGE, backgroundColor), fontSize(fontSize), lineHeightMultiplier(lineHeightMultiplier), text(text), font(font) {}
 	//--------------------------------------------------------------------------------------------------
@@ -469,6 +494,7 @@ namespace SnackerEngine
 		parseJsonOrReadFromData(alignmentHorizontal, "alignmentHorizontal", json, data, parameterNames);
 		parseJsonOrReadFromData(alignmentVertical, "alignmentVertical", json, data, parameterNames);
 		parseJsonOrReadFromData(font, "font", json, data, parameterNames);
+		parseJsonOrReadFromData(instancedRendering, "instancedRendering", json, data, parameterNames);
 		if (!json.contains("backgroundColor")) setBackgroundColor(defaultBackgroundColor);
 		if (json.contains("size") || (json.contains("width") && json.contains("height"))) {
 			sizeHintModes.sizeHintModeMinSize = SizeHintMode::ARBITRARY;
@@ -505,7 +531,11 @@ namespace SnackerEngine
 		doRecomputeOnSizeChange(other.doRecomputeOnSizeChange),
 		lastSizeOnRecomputeText(other.lastSizeOnRecomputeText), text(other.text),
 		parseMode(other.parseMode), alignmentHorizontal(other.alignmentHorizontal),
-		alignmentVertical(other.alignmentVertical), font(other.font) {}
+		alignmentVertical(other.alignmentVertical), font(other.font), instancedRendering(other.instancedRendering), 
+		instancedTextMesh(nullptr)
+	{
+		if (other.instancedTextMesh) applyInstancedRendering();
+	}
 	//--------------------------------------------------------------------------------------------------
 	GuiTextBox& GuiTextBox::operator=(const GuiTextBox& other) noexcept
 	{
@@ -531,6 +561,9 @@ namespace SnackerEngine
 		alignmentHorizontal = other.alignmentHorizontal;
 		alignmentVertical = other.alignmentVertical;
 		font = other.font;
+		instancedRendering = other.instancedRendering;
+		instancedTextMesh = nullptr;
+		if (other.instancedTextMesh) applyInstancedRendering();
 		return *this;
 	}
 	//--------------------------------------------------------------------------------------------------
@@ -560,7 +593,8 @@ namespace SnackerEngine
 	void GuiTextBox::setTextColor(const Color4f& textColor)
 	{
 		this->textColor = textColor;
-		material = constructTextMaterial(font, textColor, getBackgroundColor());
+		material = constructTextMaterial(font, textColor, getBackgroundColor(), instancedTextMesh != nullptr);
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiTextBox::setTextScaleMode(TextScaleMode textScaleMode)
@@ -704,6 +738,14 @@ namespace SnackerEngine
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
+	void GuiTextBox::setInstancedRendering(bool instancedRendering)
+	{
+		if (this->instancedRendering != instancedRendering) {
+			this->instancedRendering = instancedRendering;
+			applyInstancedRendering();
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
 	void GuiTextBox::setText(const std::string& text)
 	{
 		this->text = text;
@@ -754,7 +796,7 @@ namespace SnackerEngine
 			this->font = font;
 			if (this->dynamicText) {
 				this->dynamicText->setFont(font, false);
-				material = constructTextMaterial(font, textColor, getBackgroundColor());
+				material = constructTextMaterial(font, textColor, getBackgroundColor(), instancedTextMesh != nullptr);
 				recomputeText();
 				computeWidthHints();
 				computeModelMatrices();
@@ -765,7 +807,7 @@ namespace SnackerEngine
 	void GuiTextBox::setBackgroundColor(const Color4f& backgroundColor)
 	{
 		GuiPanel::setBackgroundColor(backgroundColor);
-		material = constructTextMaterial(font, textColor, backgroundColor);
+		material = constructTextMaterial(font, textColor, backgroundColor, instancedTextMesh != nullptr);
 	}
 	//--------------------------------------------------------------------------------------------------
 	std::unique_ptr<GuiElementAnimatable> GuiTextBox::animateTextColor(const Color4f& startVal, const Color4f& stopVal, double duration, std::function<double(double)> animationFunction)
@@ -913,4 +955,10 @@ namespace SnackerEngine
 		recomputeTextOnSizeChange();
 	}
 	//--------------------------------------------------------------------------------------------------
+	void GuiTextBox::callbackGlyphsAdded()
+	{
+		// Glyphs that were generated in the background may replace placeholders in the text
+		if (dynamicText && dynamicText->hasOutdatedGlyphs()) recomputeText();
+	}
+	//--------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
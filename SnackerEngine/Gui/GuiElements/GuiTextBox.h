@@ -2,6 +2,7 @@
 
 #include "Gui/GuiElements/GuiPanel.h"
 #include "Gui/Text/Text.h"
+#include "Gui/Text/InstancedTextMesh.h"
 #include "Graphics/Material.h"
 #include "Graphics/Color.h"
 #include "Utility\Alignment.h"
@@ -57,6 +58,7 @@ namespace SnackerEngine
 		static Color4f defaultBackgroundColor;
 		static unsigned defaultRecomputeTries;
 		static SizeHintModes defaultSizeHintModes;
+		static bool defaultInstancedRendering;
 	protected:
 		/// The text object. This needs to be a pointer such that the Edit text class can save an 
 		/// EditableText object in this variable instead (thus avoiding code duplication)
@@ -76,6 +78,8 @@ namespace SnackerEngine
 		void recomputeText();
 		/// Helper function that should get called when the element is registered
 		void onRegister(std::unique_ptr<DynamicText>&& dynamicText);
+		/// Returns false if the text can't be drawn with instanced rendering (see setInstancedRendering())
+		virtual bool supportsInstancedRendering() const { return true; }
 	private:
 		/// Material, containing font, textColor and backgroundColor.
 		/// MaterialData is of type SimpleTextMaterialData
@@ -115,14 +119,25 @@ namespace SnackerEngine
 		AlignmentVertical alignmentVertical = AlignmentVertical::CENTER;
 		/// The font of the text
 		Font font = GuiElement::defaultFont;
+		/// If this is set to true, the text is drawn from its glyph instances (see InstancedTextMesh)
+		bool instancedRendering = defaultInstancedRendering;
+		/// The glyph instances of the text. Only exists while instanced rendering is used
+		std::unique_ptr<InstancedTextMesh> instancedTextMesh = nullptr;
 		/// Helper function that Computes the modelMatrix of the text and the background box.
 		/// Depending on the textBoxMode the text is scaled appropriately.
 		void computeModelMatrices();
 		/// Helper function that should be called on size change. Only recomputes the text
 		/// if it is absolutely necessary, saving computation time!
 		void recomputeTextOnSizeChange();
-		/// Helper function that constructs the text material
-		static Material constructTextMaterial(const Font& font, const Color4f& textColor, const Color4f& backgroundColor);
+		/// Helper function that constructs the text material. If instanced is set to true, the material
+		/// uses the shader for instanced text rendering
+		static Material constructTextMaterial(const Font& font, const Color4f& textColor, const Color4f& backgroundColor, bool instanced);
+		/// Helper function that creates or deletes the instanced text mesh according to instancedRendering
+		/// and constructs the matching material
+		void applyInstancedRendering();
+		/// Helper function that draws the model or the glyph instances of the text. The material
+		/// should already be bound
+		void drawTextModel(std::optional<Color4f> textColor);
 	protected:
 		/// Helper functions computing the correct values for the size hint height variables, ie.
 		/// minheight, maxheight and preferredHeight.
@@ -166,6 +181,7 @@ namespace SnackerEngine
 		double getLineHeight() const;
 		int getRecomputeTries() const { return recomputeTries; }
 		bool isDoRecomputeOnSizeChange() const { return doRecomputeOnSizeChange; }
+		bool isInstancedRendering() const { return instancedRendering; }
 		virtual std::string_view getText() const { return text; }
 		StaticText::ParseMode getParseMode() const { return parseMode; }
 		AlignmentHorizontal getAlignmentHorizontal() const { return alignmentHorizontal; }
@@ -190,6 +206,10 @@ namespace SnackerEngine
 		void setLineHeightMultiplier(double lineHeightMultiplier);
 		void setRecomputeTries(int recomputeTries);
 		void setDoRecomputeOnSizeChange(const bool& doRecomputeOnSizeChange);
+		/// Sets whether the text is drawn from compact glyph instances with a single instanced draw call
+		/// instead of a regular model. This saves memory and upload bandwidth for texts with many characters.
+		/// Has no effect on GuiEditBox, which edits the model of its text in place
+		void setInstancedRendering(bool instancedRendering);
 		virtual void setText(const std::string& text);
 		void setParseMode(const StaticText::ParseMode& parseMode);
 		void setAlignmentHorizontal(AlignmentHorizontal alignmentHorizontal);
@@ -232,5 +252,7 @@ namespace SnackerEngine
 		/// compute model matrices. Not called by the constructor. Do not enforce layouts
 		/// in this function!
 		virtual void onSizeChange() override;
+		/// Recomputes the text if it shows placeholders for glyphs that were added to the font
+		virtual void callbackGlyphsAdded() override;
 	};
 }
\ No newline at end of file
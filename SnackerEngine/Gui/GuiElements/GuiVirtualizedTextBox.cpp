@@ -0,0 +1,278 @@
+#include "Gui/GuiElements/GuiVirtualizedTextBox.h"
+#include "Gui/Text/TextMaterial.h"
+#include "Math/Utility.h"
+#include "Gui/GuiManager.h"
+#include "Graphics/Renderer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	Color4f GuiVirtualizedTextBox::defaultTextColor = Color4f(1.0f, 1.0f);
+	Color4f GuiVirtualizedTextBox::defaultBackgroundColor = Color4f(0.0f, 0.0f);
+	float GuiVirtualizedTextBox::defaultScrollSpeed = 50.0f;
+	//--------------------------------------------------------------------------------------------------
+	double GuiVirtualizedTextBox::getContentHeight() const
+	{
+		if (!virtualizedText) return 0.0;
+		return pointsToPixels(virtualizedText->getTextHeight()) + 2.0 * border;
+	}
+	//--------------------------------------------------------------------------------------------------
+	double GuiVirtualizedTextBox::getMaxScrollOffset() const
+	{
+		return std::max(0.0, getContentHeight() - static_cast<double>(getHeight()));
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::clampScrollOffset()
+	{
+		scrollOffset = std::clamp(scrollOffset, 0.0, getMaxScrollOffset());
+	}
+	//--------------------------------------------------------------------------------------------------
+	double GuiVirtualizedTextBox::offsetToTextCoordinate(const double& offsetY) const
+	{
+		return virtualizedText->getTop() - pixelsToPoints(offsetY - static_cast<double>(border) + scrollOffset);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::updateVisibleRange()
+	{
+		if (!virtualizedText) return;
+		invalidateDraw();
+		virtualizedText->setVisibleRange(offsetToTextCoordinate(0.0), offsetToTextCoordinate(static_cast<double>(getHeight())));
+		if (scrolledToEnd && scrollOffset != getMaxScrollOffset()) {
+			// The estimated line counts of the paragraphs at the end were replaced by exact ones
+			scrollOffset = getMaxScrollOffset();
+			virtualizedText->setVisibleRange(offsetToTextCoordinate(0.0), offsetToTextCoordinate(static_cast<double>(getHeight())));
+		}
+		else {
+			clampScrollOffset();
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	Material GuiVirtualizedTextBox::constructTextMaterial(const Font& font, const Color4f& textColor)
+	{
+		return Material(std::move(std::make_unique<SimpleTextMaterialData>(Shader("shaders/gui/basic2DText.shader"),
+			font, textColor)));
+	}
+	//--------------------------------------------------------------------------------------------------
+	GuiVirtualizedTextBox::GuiVirtualizedTextBox(const Vec2i& position, const Vec2i& size, const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const Color4f& backgroundColor)
+		: GuiPanel(position, size, ResizeMode::RESIZE_RANGE, backgroundColor), fontSize(fontSize), lineHeightMultiplier(lineHeightMultiplier), text(text), font(font) {}
+	//--------------------------------------------------------------------------------------------------
+	GuiVirtualizedTextBox::GuiVirtualizedTextBox(const nlohmann::json& json, const nlohmann::json* data, std::set<std::string>* parameterNames)
+		: GuiPanel(json, data, parameterNames)
+	{
+		parseJsonOrReadFromData(textColor, "textColor", json, data, parameterNames);
+		parseJsonOrReadFromData(border, "border", json, data, parameterNames);
+		parseJsonOrReadFromData(fontSize, "fontSize", json, data, parameterNames);
+		parseJsonOrReadFromData(lineHeightMultiplier, "lineHeightMultiplier", json, data, parameterNames);
+		parseJsonOrReadFromData(text, "text", json, data, parameterNames);
+		parseJsonOrReadFromData(parseMode, "parseMode", json, data, parameterNames);
+		parseJsonOrReadFromData(alignmentHorizontal, "alignmentHorizontal", json, data, parameterNames);
+		parseJsonOrReadFromData(font, "font", json, data, parameterNames);
+		parseJsonOrReadFromData(scrollSpeed, "scrollSpeed", json, data, parameterNames);
+		parseJsonOrReadFromData(followEnd, "followEnd", json, data, parameterNames);
+		if (!json.contains("backgroundColor")) setBackgroundColor(defaultBackgroundColor);
+	}
+	//--------------------------------------------------------------------------------------------------
+	GuiVirtualizedTextBox::GuiVirtualizedTextBox(const GuiVirtualizedTextBox& other) noexcept
+		: GuiPanel(other), virtualizedText(nullptr), material(other.material), textColor(other.textColor),
+		border(other.border), fontSize(other.fontSize), lineHeightMultiplier(other.lineHeightMultiplier),
+		text(other.getText()), parseMode(other.parseMode), alignmentHorizontal(other.alignmentHorizontal),
+		font(other.font), scrollOffset(other.scrollOffset), scrollSpeed(other.scrollSpeed),
+		followEnd(other.followEnd), scrolledToEnd(other.scrolledToEnd) {}
+	//--------------------------------------------------------------------------------------------------
+	GuiVirtualizedTextBox& GuiVirtualizedTextBox::operator=(const GuiVirtualizedTextBox& other) noexcept
+	{
+		GuiPanel::operator=(other);
+		virtualizedText = nullptr;
+		material = other.material;
+		textColor = other.textColor;
+		border = other.border;
+		fontSize = other.fontSize;
+		lineHeightMultiplier = other.lineHeightMultiplier;
+		text = other.getText();
+		parseMode = other.parseMode;
+		alignmentHorizontal = other.alignmentHorizontal;
+		font = other.font;
+		scrollOffset = other.scrollOffset;
+		scrollSpeed = other.scrollSpeed;
+		followEnd = other.followEnd;
+		scrolledToEnd = other.scrolledToEnd;
+		return *this;
+	}
+	//--------------------------------------------------------------------------------------------------
+	unsigned int GuiVirtualizedTextBox::getNumLines() const
+	{
+		return virtualizedText ? virtualizedText->getNumLines() : 0;
+	}
+	//--------------------------------------------------------------------------------------------------
+	unsigned int GuiVirtualizedTextBox::getLineIndex(const Vec2i& offset) const
+	{
+		if (!virtualizedText) return 0;
+		return virtualizedText->getLineIndex(offsetToTextCoordinate(static_cast<double>(offset.y)));
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::setTextColor(const Color4f& textColor)
+	{
+		invalidateDraw();
+		this->textColor = textColor;
+		material = constructTextMaterial(font, textColor);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::setBorder(const int& border)
+	{
+		invalidateDraw();
+		this->border = border;
+		onSizeChange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::setFontSize(const double& fontSize)
+	{
+		invalidateDraw();
+		this->fontSize = fontSize;
+		if (virtualizedText) virtualizedText->setFontSize(fontSize);
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::setLineHeightMultiplier(double lineHeightMultiplier)
+	{
+		invalidateDraw();
+		this->lineHeightMultiplier = lineHeightMultiplier;
+		if (virtualizedText) virtualizedText->setLineHeightMultiplier(lineHeightMultiplier);
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::setText(const std::string& text)
+	{
+		invalidateDraw();
+		if (virtualizedText) virtualizedText->setText(text);
+		else this->text = text;
+		scrollOffset = 0.0;
+		scrolledToEnd = false;
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::appendText(const std::string& text)
+	{
+		invalidateDraw();
+		if (!virtualizedText) {
+			this->text.append(text);
+			return;
+		}
+		bool stayAtEnd = followEnd && (scrolledToEnd || scrollOffset >= getMaxScrollOffset());
+		virtualizedText->appendText(text);
+		if (stayAtEnd) scrollToEnd();
+		else updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::setParseMode(const StaticText::ParseMode& parseMode)
+	{
+		invalidateDraw();
+		this->parseMode = parseMode;
+		if (virtualizedText) virtualizedText->setParseMode(parseMode);
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::setAlignmentHorizontal(AlignmentHorizontal alignmentHorizontal)
+	{
+		invalidateDraw();
+		this->alignmentHorizontal = alignmentHorizontal;
+		if (virtualizedText) virtualizedText->setAlignment(alignmentHorizontal);
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::setFont(const Font& font)
+	{
+		invalidateDraw();
+		this->font = font;
+		material = constructTextMaterial(font, textColor);
+		if (virtualizedText) virtualizedText->setFont(font);
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::setScrollOffset(const double& scrollOffset)
+	{
+		invalidateDraw();
+		this->scrollOffset = scrollOffset;
+		scrolledToEnd = false;
+		clampScrollOffset();
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::scrollToLine(const unsigned int& lineIndex)
+	{
+		if (!virtualizedText) return;
+		setScrollOffset(pointsToPixels(virtualizedText->getTop() - virtualizedText->getBaseline(lineIndex)
+			- virtualizedText->getFont().getAscender() * fontSize));
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::scrollToEnd()
+	{
+		invalidateDraw();
+		scrollOffset = getMaxScrollOffset();
+		scrolledToEnd = true;
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::draw(const Vec2i& worldPosition)
+	{
+		GuiManager* const& guiManager = getGuiManager();
+		if (!guiManager) return;
+		// Draw background
+		GuiPanel::draw(worldPosition);
+		if (!virtualizedText) return;
+		pushClippingBox(worldPosition);
+		// Only the paragraphs in the visible window have a model. They are laid out whenever the window
+		// or the text changes, so drawing does not change the layout
+		Mat4f translationMatrix = Mat4f::Translate(Vec3f(static_cast<float>(worldPosition.x), static_cast<float>(-worldPosition.y), 0.0f));
+		float scale = static_cast<float>(pointsToPixels(fontSize));
+		double top = -static_cast<double>(border) - pointsToPixels(virtualizedText->getTop()) + scrollOffset;
+		guiManager->flushQuadBatch();
+		material.bind();
+		guiManager->setUniformViewAndProjectionMatrices(material.getShader());
+		material.getShader().setUniform<float>("u_pxRange", static_cast<float>(font.getPixelRange()));
+		for (const auto& paragraph : virtualizedText->getVisibleParagraphs()) {
+			Vec3f position(static_cast<float>(border + pointsToPixels(paragraph.offset.x)),
+				static_cast<float>(top + pointsToPixels(paragraph.offset.y)), 0.0f);
+			material.getShader().setUniform<Mat4f>("u_model", translationMatrix * Mat4f::TranslateAndScale(position, Vec3f(scale)));
+			Renderer::draw(paragraph.text->getModel());
+		}
+		popClippingBox();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::onRegister()
+	{
+		GuiPanel::onRegister();
+		virtualizedText = std::make_unique<VirtualizedText>(text, font, fontSize, pixelsToPoints(static_cast<double>(getWidth() - 2 * border)), lineHeightMultiplier, parseMode, alignmentHorizontal);
+		// The text is now stored in virtualizedText
+		text.clear();
+		material = constructTextMaterial(font, textColor);
+		signUpEvent(CallbackType::MOUSE_SCROLL_ON_ELEMENT);
+		signUpEvent(CallbackType::GLYPHS_ADDED);
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::onSizeChange()
+	{
+		GuiPanel::onSizeChange();
+		if (!virtualizedText) return;
+		virtualizedText->setTextWidth(pixelsToPoints(static_cast<double>(getWidth() - 2 * border)));
+		if (scrolledToEnd) scrollOffset = getMaxScrollOffset();
+		else clampScrollOffset();
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::callbackMouseScrollOnElement(const Vec2d& offset)
+	{
+		setScrollOffset(scrollOffset - offset.y * static_cast<double>(scrollSpeed));
+		if (followEnd && scrollOffset >= getMaxScrollOffset()) scrolledToEnd = true;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualizedTextBox::callbackGlyphsAdded()
+	{
+		// Visible paragraphs that show placeholders for the new glyphs are laid out again
+		updateVisibleRange();
+	}
+	//--------------------------------------------------------------------------------------------------
+}
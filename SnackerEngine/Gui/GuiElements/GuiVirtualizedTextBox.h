@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Gui/GuiElements/GuiPanel.h"
+#include "Gui/Text/VirtualizedText.h"
+#include "Graphics/Material.h"
+#include "Graphics/Color.h"
+#include "Utility\Alignment.h"
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// Scrollable text box for very long texts (eg. log viewers). Instead of laying out and meshing
+	/// the whole text like GuiTextBox, the text is laid out lazily paragraph by paragraph, and only
+	/// the paragraphs in the visible window (plus a margin) have a model (see VirtualizedText).
+	/// Scrolling and finding the line under the mouse are O(log n) in the number of paragraphs.
+	/// The text is always aligned to the top of the box, and the box does not set size hints
+	class GuiVirtualizedTextBox : public GuiPanel
+	{
+	public:
+		/// Static default Attributes
+		static Color4f defaultTextColor;
+		static Color4f defaultBackgroundColor;
+		static float defaultScrollSpeed;
+	private:
+		/// The lazily laid out text. Created when the element is registered
+		std::unique_ptr<VirtualizedText> virtualizedText = nullptr;
+		/// Material, containing font and textColor. MaterialData is of type SimpleTextMaterialData
+		Material material = {};
+		/// Text color
+		Color4f textColor = defaultTextColor;
+		/// Border between the box and the text in pixels
+		int border = GuiElement::defaultBorderSmall;
+		/// The font size of the text in pt
+		double fontSize = GuiElement::defaultFontSizeNormal;
+		/// Line height multiplier for changing the default lineHeight of the font
+		double lineHeightMultiplier = 1.0;
+		/// The displayed text. Only used until the element is registered, afterwards the text is
+		/// stored in virtualizedText
+		std::string text = "";
+		/// The parse mode
+		StaticText::ParseMode parseMode = StaticText::ParseMode::WORD_BY_WORD;
+		/// The text alignment
+		AlignmentHorizontal alignmentHorizontal = AlignmentHorizontal::LEFT;
+		/// The font of the text
+		Font font = GuiElement::defaultFont;
+		/// Distance (in pixels) that the text is scrolled down
+		double scrollOffset = 0.0;
+		/// Speed when scrolling, in pixels
+		float scrollSpeed = defaultScrollSpeed;
+		/// If this is set to true and the text is scrolled to the end, appended text stays in view
+		bool followEnd = true;
+		/// Set to true if the box was scrolled to the end. Since the line count contains estimates,
+		/// the scroll offset is fixed up after the visible paragraphs were laid out
+		bool scrolledToEnd = false;
+		/// Returns the height of the whole text in pixels, including the border
+		double getContentHeight() const;
+		/// Returns the maximum scroll offset in pixels
+		double getMaxScrollOffset() const;
+		/// Clamps the scroll offset to the valid range
+		void clampScrollOffset();
+		/// Converts a vertical offset from the top of the box (in pixels) to a y coordinate in the text (in pt)
+		double offsetToTextCoordinate(const double& offsetY) const;
+		/// Lays out the paragraphs in the visible window. Called whenever the scroll offset, the size or
+		/// the text changes, such that draw() only has to draw the visible paragraphs
+		void updateVisibleRange();
+		/// Helper function that constructs the text material
+		static Material constructTextMaterial(const Font& font, const Color4f& textColor);
+	public:
+		/// name of this GuiElementType for JSON parsing
+		static constexpr std::string_view typeName = "GUI_VIRTUALIZED_TEXT_BOX";
+		virtual std::string_view getTypeName() const override { return typeName; }
+		/// Default constructor
+		GuiVirtualizedTextBox(const Vec2i& position = Vec2i(), const Vec2i& size = Vec2i(), const std::string& text = "", const Font& font = defaultFont, const double& fontSize = defaultFontSizeNormal, double lineHeightMultiplier = 1.0, const Color4f& backgroundColor = defaultBackgroundColor);
+		/// Constructor from JSON
+		GuiVirtualizedTextBox(const nlohmann::json& json, const nlohmann::json* data = nullptr, std::set<std::string>* parameterNames = nullptr);
+		/// Destructor
+		virtual ~GuiVirtualizedTextBox() {}
+		/// Copy constructor and assignment operator. The layout of the copy is computed again when it is registered
+		GuiVirtualizedTextBox(const GuiVirtualizedTextBox& other) noexcept;
+		GuiVirtualizedTextBox& operator=(const GuiVirtualizedTextBox& other) noexcept;
+		/// Move constructor and assignment operator
+		GuiVirtualizedTextBox(GuiVirtualizedTextBox&& other) noexcept = default;
+		GuiVirtualizedTextBox& operator=(GuiVirtualizedTextBox&& other) noexcept = default;
+		/// Getters
+		const Color4f& getTextColor() const { return textColor; }
+		int getBorder() const { return border; }
+		double getFontSize() const { return fontSize; }
+		double getLineHeightMultiplier() const { return lineHeightMultiplier; }
+		const std::string& getText() const { return virtualizedText ? virtualizedText->getText() : text; }
+		StaticText::ParseMode getParseMode() const { return parseMode; }
+		AlignmentHorizontal getAlignmentHorizontal() const { return alignmentHorizontal; }
+		const Font& getFont() const { return font; }
+		double getScrollOffset() const { return scrollOffset; }
+		float getScrollSpeed() const { return scrollSpeed; }
+		bool isFollowEnd() const { return followEnd; }
+		/// Returns the number of lines. Contains estimates for parts of the text that were never visible
+		unsigned int getNumLines() const;
+		/// Returns the index of the line at the given offset from the top left corner of the box (in pixels)
+		unsigned int getLineIndex(const Vec2i& offset) const;
+		/// Returns the index of the line under the mouse
+		unsigned int getLineIndexUnderMouse() const { return getLineIndex(getMouseOffset()); }
+		/// Setters
+		void setTextColor(const Color4f& textColor);
+		void setBorder(const int& border);
+		void setFontSize(const double& fontSize);
+		void setLineHeightMultiplier(double lineHeightMultiplier);
+		void setText(const std::string& text);
+		/// Appends text. Only the last paragraph has to be laid out again
+		void appendText(const std::string& text);
+		void setParseMode(const StaticText::ParseMode& parseMode);
+		void setAlignmentHorizontal(AlignmentHorizontal alignmentHorizontal);
+		void setFont(const Font& font);
+		void setScrollSpeed(float scrollSpeed) { this->scrollSpeed = scrollSpeed; }
+		void setFollowEnd(bool followEnd) { this->followEnd = followEnd; }
+		/// Sets the scroll offset (in pixels), clamped to the valid range
+		void setScrollOffset(const double& scrollOffset);
+		/// Scrolls such that the given line is at the top of the box
+		void scrollToLine(const unsigned int& lineIndex);
+		/// Scrolls to the end of the text
+		void scrollToEnd();
+	protected:
+		/// Draws this GuiElement object relative to its parent element. Will also recursively
+		/// draw all children of this element.
+		/// worldPosition:		position of the upper left corner of the guiElement in world space
+		virtual void draw(const Vec2i& worldPosition) override;
+		/// This function is called by the guiManager after registering this GuiElement object.
+		/// When this function is called, the guiManager pointer was already set.
+		/// This function can e.g. be used for registering callbacks at the guiManager
+		virtual void onRegister() override;
+		/// This function is called when the size changes. Can eg. be. be used to
+		/// compute model matrices. Not called by the constructor. Do not enforce layouts
+		/// in this function!
+		virtual void onSizeChange() override;
+
+		//==============================================================================================
+		// Events
+		//==============================================================================================
+
+		/// Callback function for scrolling the mouse wheel. Parameter the same as in Scene.h
+		virtual void callbackMouseScrollOnElement(const Vec2d& offset) override;
+		/// Lays out the visible paragraphs again if they show placeholders for glyphs that were added
+		virtual void callbackGlyphsAdded() override;
+	};
+	//--------------------------------------------------------------------------------------------------
+}
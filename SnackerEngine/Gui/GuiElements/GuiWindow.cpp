@@ -139,6 +139,7 @@ namespace SnackerEngine
 		// Draw top bar
 		drawElement(topBar.getGuiID(), worldPosition);
 		// Draw resize button
+		guiManager->flushQuadBatch();
 		getPanelShader().bind();
 		guiManager->setUniformViewAndProjectionMatrices(getPanelShader());
 		Mat4f translationMatrix = Mat4f::Translate(Vec3f(static_cast<float>(worldPosition.x), static_cast<float>(-worldPosition.y), 0.0f));
@@ -0,0 +1,69 @@
+#include "Gui/GuiEventTable.h"
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	void GuiEventTable::compact()
+	{
+		std::size_t newSize = 0;
+		for (std::size_t i = 0; i < guiIDs.size(); ++i) {
+			const GuiID guiID = guiIDs[i];
+			if (guiID < 0) continue;
+			guiIDs[newSize] = guiID;
+			indices[guiID] = static_cast<unsigned int>(newSize + 1);
+			newSize++;
+		}
+		guiIDs.resize(newSize);
+		holeCount = 0;
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool GuiEventTable::insert(GuiID guiID)
+	{
+		if (guiID < 0) return false;
+		if (static_cast<std::size_t>(guiID) >= indices.size()) indices.resize(static_cast<std::size_t>(guiID) + 1, 0);
+		if (indices[guiID] != 0) return false;
+		guiIDs.push_back(guiID);
+		indices[guiID] = static_cast<unsigned int>(guiIDs.size());
+		return true;
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool GuiEventTable::erase(GuiID guiID)
+	{
+		if (!contains(guiID)) return false;
+		const unsigned int index = indices[guiID] - 1;
+		indices[guiID] = 0;
+		if (index + 1 == guiIDs.size() && iterationDepth == 0) {
+			guiIDs.pop_back();
+		}
+		else {
+			guiIDs[index] = -1;
+			holeCount++;
+			// Close the holes once they make up half of the table. During an iteration this is done
+			// when the iteration has finished
+			if (iterationDepth == 0 && holeCount * 2 > guiIDs.size()) compact();
+		}
+		return true;
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool GuiEventTable::contains(GuiID guiID) const
+	{
+		return guiID >= 0 && static_cast<std::size_t>(guiID) < indices.size() && indices[guiID] != 0;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiEventTable::clear()
+	{
+		for (GuiID& guiID : guiIDs) {
+			if (guiID < 0) continue;
+			indices[guiID] = 0;
+			guiID = -1;
+		}
+		if (iterationDepth > 0) {
+			// Running iterations still need the (now empty) entries
+			holeCount = guiIDs.size();
+			return;
+		}
+		guiIDs.clear();
+		holeCount = 0;
+	}
+	//--------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Gui/GuiID.h"
+
+#include <vector>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// Set of GuiIDs that are subscribed to a certain event (see GuiElement::CallbackType). Since GuiIDs
+	/// are small, dense integers, the table is a sparse set: the GuiIDs are stored contiguously in the
+	/// order they were added, and a second vector indexed by GuiID stores the position of each GuiID.
+	/// Adding, removing and looking up GuiIDs is O(1), and iterating only walks the contiguous vector.
+	/// GuiIDs can be added and removed while the table is iterated with forEach(): removed GuiIDs leave 
+	/// a hole that is skipped and closed once the iteration has finished, and added GuiIDs are not 
+	/// visited by iterations that are already running.
+	class GuiEventTable
+	{
+	private:
+		/// All subscribed GuiIDs in the order they were added. Removed entries are set to -1
+		std::vector<GuiID> guiIDs{};
+		/// For each GuiID, its index into the guiIDs vector plus one. Zero if the GuiID is not in the table
+		std::vector<unsigned int> indices{};
+		/// Number of removed entries (holes) in the guiIDs vector
+		std::size_t holeCount = 0;
+		/// Number of running iterations. The holes are only closed if no iteration is running
+		unsigned int iterationDepth = 0;
+		/// Removes all holes from the guiIDs vector without changing the order of the remaining GuiIDs
+		void compact();
+	public:
+		/// Default constructor
+		GuiEventTable() = default;
+		/// Adds the given GuiID. Returns false if it was already in the table
+		bool insert(GuiID guiID);
+		/// Removes the given GuiID. Returns false if it was not in the table
+		bool erase(GuiID guiID);
+		/// Returns true if the given GuiID is in the table
+		bool contains(GuiID guiID) const;
+		/// Removes all GuiIDs
+		void clear();
+		/// Returns the number of GuiIDs in the table
+		std::size_t size() const { return guiIDs.size() - holeCount; }
+		bool empty() const { return size() == 0; }
+		/// Calls the given function for each GuiID in the table, in the order they were added
+		template<typename Function>
+		void forEach(Function function);
+	};
+	//--------------------------------------------------------------------------------------------------
+	template<typename Function>
+	inline void GuiEventTable::forEach(Function function)
+	{
+		iterationDepth++;
+		// GuiIDs that are added during the iteration are not visited
+		const std::size_t count = guiIDs.size();
+		for (std::size_t i = 0; i < count; ++i) {
+			const GuiID guiID = guiIDs[i];
+			if (guiID >= 0) function(guiID);
+		}
+		iterationDepth--;
+		if (iterationDepth == 0 && holeCount > 0) compact();
+	}
+	//--------------------------------------------------------------------------------------------------
+}
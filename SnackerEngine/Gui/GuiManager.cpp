@@ -3,6 +3,7 @@
 #include "Graphics/Meshes/Square.h"
 #include "Graphics/Meshes/Triangle.h"
 #include "Core/Engine.h"
+#include "AssetManager/FontManager.h"
 
 #include "GuiElements/GuiPanel.h"
 #include "GuiElements/GuiTextBox.h"
@@ -17,6 +18,7 @@
 #include "Gui/Layouts/VerticalListLayout.h"
 #include "Gui\Layouts\HorizontalListLayout.h"
 #include "Gui/Layouts/VerticalScrollingListLayout.h"
+#include "Gui/Layouts/VirtualListLayout.h"
 #include "Gui\GuiElements\GuiWindow.h"
 #include "Gui\GuiElements\GuiEditBox.h"
 #include "Gui\GuiElements\GuiCheckBox.h"
@@ -28,50 +30,104 @@
 #include "Gui\GuiElements\GuiSelectionBox.h"
 #include "Gui\GuiElements\GuiClickableTextBox.h"
 #include "Gui\GuiElements\GuiScaleButton.h"
+#include "Gui\GuiElements\GuiVirtualizedTextBox.h"
+
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
 
 namespace SnackerEngine
 {
 	//--------------------------------------------------------------------------------------------------
 	std::unordered_map<std::string, GuiManager::parseFunction> GuiManager::elementParsingMap = std::unordered_map<std::string, GuiManager::parseFunction>();
-	//--------------------------------------------------------------------------------------------------
-	void GuiManager::processSignOffQueue()
-	{
-		for (const auto& element : signOffQueue) {
-			switch (element.second)
+
+	//==================================================================================================
+	// Layout worker threads
+	//==================================================================================================
+
+	/// The function that is currently called by the layout worker threads for every index in 
+	/// [0, layoutJobSize). Indices are handed out using layoutJobNextIndex
+	static std::function<void(std::size_t)> layoutJobFunction{};
+	static std::size_t layoutJobSize = 0;
+	static std::atomic<std::size_t> layoutJobNextIndex{ 0 };
+	/// Is incremented every time a new job is started. Guarded by layoutJobMutex
+	static unsigned int layoutJobGeneration = 0;
+	/// Number of worker threads that are currently working on the job. Guarded by layoutJobMutex
+	static unsigned int layoutJobBusyWorkers = 0;
+	static std::mutex layoutJobMutex{};
+	static std::condition_variable layoutJobConditionVariable{};
+	static std::condition_variable layoutJobFinishedConditionVariable{};
+	/// If this is set to true, the worker threads stop. Guarded by layoutJobMutex
+	static bool stopLayoutWorkerThreads = false;
+	/// The layout worker threads
+	static std::vector<std::thread> layoutWorkerThreads{};
+	//--------------------------------------------------------------------------------------------------
+	/// Calls the job function for indices until all indices are handed out
+	static void workOnLayoutJob()
+	{
+		for (std::size_t index = layoutJobNextIndex++; index < layoutJobSize; index = layoutJobNextIndex++) {
+			layoutJobFunction(index);
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	static void runLayoutWorkerThread()
+	{
+		unsigned int generation = 0;
+		while (true) {
+			{
+				std::unique_lock<std::mutex> lock(layoutJobMutex);
+				layoutJobConditionVariable.wait(lock, [&generation] { return stopLayoutWorkerThreads || layoutJobGeneration != generation; });
+				if (stopLayoutWorkerThreads) return;
+				generation = layoutJobGeneration;
+				++layoutJobBusyWorkers;
+			}
+			workOnLayoutJob();
 			{
-			case GuiElement::CallbackType::MOUSE_BUTTON: eventSetMouseButton.erase(element.first); break;
-			case GuiElement::CallbackType::MOUSE_MOTION: eventSetMouseMotion.erase(element.first); break;
-			case GuiElement::CallbackType::KEYBOARD: eventSetKeyboard.erase(element.first); break;
-			case GuiElement::CallbackType::CHARACTER_INPUT: eventSetCharacterInput.erase(element.first); break;
-			case GuiElement::CallbackType::MOUSE_BUTTON_ON_ELEMENT: eventSetMouseButtonOnElement.erase(element.first); break;
-			case GuiElement::CallbackType::MOUSE_SCROLL_ON_ELEMENT: eventSetMouseScrollOnElement.erase(element.first); break;
-			case GuiElement::CallbackType::MOUSE_ENTER: eventSetMouseEnter.erase(element.first); break;
-			case GuiElement::CallbackType::MOUSE_LEAVE: eventSetMouseLeave.erase(element.first); break;
-			case GuiElement::CallbackType::UPDATE: eventSetUpdate.erase(element.first); break;
-			case GuiElement::CallbackType::DRAW_ON_TOP: eventVectorDrawOnTop.erase(std::remove(eventVectorDrawOnTop.begin(), eventVectorDrawOnTop.end(), element.first), eventVectorDrawOnTop.end()); break;
-			default:
-				break;
+				std::lock_guard<std::mutex> lock(layoutJobMutex);
+				--layoutJobBusyWorkers;
 			}
+			layoutJobFinishedConditionVariable.notify_all();
 		}
-		signOffQueue.clear();
 	}
 	//--------------------------------------------------------------------------------------------------
+	/// Calls function for every index in [0, count) on the layout worker threads and the calling 
+	/// thread, and returns after all calls finished
+	static void runLayoutJob(std::size_t count, std::function<void(std::size_t)> function)
+	{
+		{
+			// Workers that woke up late from the last job may still be reading the job variables
+			std::unique_lock<std::mutex> lock(layoutJobMutex);
+			layoutJobFinishedConditionVariable.wait(lock, [] { return layoutJobBusyWorkers == 0; });
+			layoutJobFunction = std::move(function);
+			layoutJobSize = count;
+			layoutJobNextIndex = 0;
+			++layoutJobGeneration;
+		}
+		layoutJobConditionVariable.notify_all();
+		workOnLayoutJob();
+		// All indices are handed out, wait for the workers that are still computing
+		std::unique_lock<std::mutex> lock(layoutJobMutex);
+		layoutJobFinishedConditionVariable.wait(lock, [] { return layoutJobBusyWorkers == 0; });
+	}
+	//--------------------------------------------------------------------------------------------------
+	//--------------------------------------------------------------------------------------------------
 	void GuiManager::signUpEvent(const GuiElement& guiElement, const GuiElement::CallbackType& callbackType)
 	{
-		processSignOffQueue();
 		if (guiElement.guiID <= 0) return;
 		switch (callbackType)
 		{
-		case GuiElement::CallbackType::MOUSE_BUTTON: eventSetMouseButton.insert(guiElement.guiID); break;
-		case GuiElement::CallbackType::MOUSE_MOTION: eventSetMouseMotion.insert(guiElement.guiID); break;
-		case GuiElement::CallbackType::KEYBOARD: eventSetKeyboard.insert(guiElement.guiID); break;
-		case GuiElement::CallbackType::CHARACTER_INPUT: eventSetCharacterInput.insert(guiElement.guiID); break;
-		case GuiElement::CallbackType::MOUSE_BUTTON_ON_ELEMENT: eventSetMouseButtonOnElement.insert(guiElement.guiID); break;
-		case GuiElement::CallbackType::MOUSE_SCROLL_ON_ELEMENT: eventSetMouseScrollOnElement.insert(guiElement.guiID); break;
-		case GuiElement::CallbackType::MOUSE_ENTER: eventSetMouseEnter.insert(guiElement.guiID); break;
-		case GuiElement::CallbackType::MOUSE_LEAVE: eventSetMouseLeave.insert(guiElement.guiID); break;
-		case GuiElement::CallbackType::UPDATE: eventSetUpdate.insert(guiElement.guiID); break;
-		case GuiElement::CallbackType::DRAW_ON_TOP: eventVectorDrawOnTop.push_back(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_BUTTON: eventTableMouseButton.insert(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_MOTION: eventTableMouseMotion.insert(guiElement.guiID); break;
+		case GuiElement::CallbackType::KEYBOARD: eventTableKeyboard.insert(guiElement.guiID); break;
+		case GuiElement::CallbackType::CHARACTER_INPUT: eventTableCharacterInput.insert(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_BUTTON_ON_ELEMENT: eventTableMouseButtonOnElement.insert(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_SCROLL_ON_ELEMENT: eventTableMouseScrollOnElement.insert(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_ENTER: eventTableMouseEnter.insert(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_LEAVE: eventTableMouseLeave.insert(guiElement.guiID); break;
+		case GuiElement::CallbackType::UPDATE: eventTableUpdate.insert(guiElement.guiID); break;
+		case GuiElement::CallbackType::DRAW_ON_TOP: eventTableDrawOnTop.insert(guiElement.guiID); break;
+		case GuiElement::CallbackType::GLYPHS_ADDED: eventTableGlyphsAdded.insert(guiElement.guiID); break;
 		default:
 			break;
 		}
@@ -79,8 +135,23 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::signOffEvent(const GuiElement& guiElement, const GuiElement::CallbackType& callbackType)
 	{
-		// push into signOffQueue. Event will be signed off the next time update() is called.
-		signOffQueue.push_back(std::make_pair(guiElement.guiID, callbackType));
+		// Event tables can be changed while they are iterated, so the element is signed off instantly
+		switch (callbackType)
+		{
+		case GuiElement::CallbackType::MOUSE_BUTTON: eventTableMouseButton.erase(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_MOTION: eventTableMouseMotion.erase(guiElement.guiID); break;
+		case GuiElement::CallbackType::KEYBOARD: eventTableKeyboard.erase(guiElement.guiID); break;
+		case GuiElement::CallbackType::CHARACTER_INPUT: eventTableCharacterInput.erase(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_BUTTON_ON_ELEMENT: eventTableMouseButtonOnElement.erase(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_SCROLL_ON_ELEMENT: eventTableMouseScrollOnElement.erase(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_ENTER: eventTableMouseEnter.erase(guiElement.guiID); break;
+		case GuiElement::CallbackType::MOUSE_LEAVE: eventTableMouseLeave.erase(guiElement.guiID); break;
+		case GuiElement::CallbackType::UPDATE: eventTableUpdate.erase(guiElement.guiID); break;
+		case GuiElement::CallbackType::DRAW_ON_TOP: eventTableDrawOnTop.erase(guiElement.guiID); break;
+		case GuiElement::CallbackType::GLYPHS_ADDED: eventTableGlyphsAdded.erase(guiElement.guiID); break;
+		default:
+			break;
+		}
 	}
 	//--------------------------------------------------------------------------------------------------
 	GuiID GuiManager::getCollidingElement()
@@ -100,6 +171,8 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::pushClippingBox(const Vec4i& clippingBox)
 	{
+		// Quads collected so far have to be drawn with the previous clipping box
+		quadBatch.flush();
 		Vec4i alteredClippingBox = clippingBox;
 		alteredClippingBox.y = screenDims.y - clippingBox.y - clippingBox.w;
 		alteredClippingBox.z = std::max(alteredClippingBox.z, 0);
@@ -123,6 +196,7 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::popClippingBox()
 	{
+		quadBatch.flush();
 		if (!clippingBoxStack.empty()) {
 			clippingBoxStack.pop_back();
 			if (!clippingBoxStack.empty()) {
@@ -137,20 +211,86 @@ namespace SnackerEngine
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
+	void GuiManager::drawRetained(GuiElement& guiElement, const Vec2i& worldPosition)
+	{
+		if (guiElement.size.x <= 0 || guiElement.size.y <= 0) return;
+		GuiDrawCache& drawCache = *guiElement.drawCache;
+		if (!drawCache.valid || drawCache.size != guiElement.size) {
+			drawIntoCache(guiElement);
+		}
+		// If the frameBuffer could not be created, fall back to drawing the element directly
+		if (!drawCache.valid) {
+			guiElement.draw(worldPosition);
+			return;
+		}
+		quadBatch.addImage(
+			Vec2f(static_cast<float>(worldPosition.x), static_cast<float>(-worldPosition.y - guiElement.size.y)),
+			Vec2f(static_cast<float>(guiElement.size.x), static_cast<float>(guiElement.size.y)), drawCache.texture);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiManager::drawIntoCache(GuiElement& guiElement)
+	{
+		GuiDrawCache& drawCache = *guiElement.drawCache;
+		if (!drawCache.frameBuffer || drawCache.size != guiElement.size) {
+			drawCache.size = guiElement.size;
+			drawCache.texture = Texture::Create2D(drawCache.size, Texture::TextureDataFormat::RGBA, false);
+			drawCache.frameBuffer = std::make_unique<FrameBuffer>(drawCache.size, false, false);
+			drawCache.frameBuffer->attachTexture(drawCache.texture);
+			drawCache.frameBuffer->finalize();
+		}
+		if (!drawCache.frameBuffer->isValid()) return;
+		quadBatch.flush();
+		// Save the current render state. The element is drawn as if the screen had the size of the element,
+		// with the upper left corner of the element at the origin
+		const Vec2i previousScreenDims = screenDims;
+		const Mat4f previousProjectionMatrix = projectionMatrix;
+		const Vec2i previousViewPort = Renderer::getViewPort();
+		std::vector<Vec4i> previousClippingBoxStack = std::move(clippingBoxStack);
+		clippingBoxStack.clear();
+		screenDims = drawCache.size;
+		projectionMatrix = Mat4f::TranslateAndScale({ -1.0f, 1.0f, 0.0f }, { 2.0f / static_cast<float>(screenDims.x), 2.0f / static_cast<float>(screenDims.y), 0.0f });
+		quadBatch.setViewAndProjection(viewMatrix, projectionMatrix);
+		Renderer::disableScissorTest();
+		drawCache.frameBuffer->bindAsTarget();
+		drawCacheTargetStack.push_back(drawCache.frameBuffer.get());
+		Renderer::changeViewPort(drawCache.size);
+		Renderer::clear(Color4f(0.0f, 0.0f, 0.0f, 0.0f));
+		guiElement.draw(Vec2i(0, 0));
+		quadBatch.flush();
+		drawCache.valid = true;
+		// Restore the previous render state
+		drawCacheTargetStack.pop_back();
+		if (drawCacheTargetStack.empty()) drawCache.frameBuffer->unbindAllTargets();
+		else drawCacheTargetStack.back()->bindAsTarget();
+		Renderer::changeViewPort(previousViewPort);
+		screenDims = previousScreenDims;
+		projectionMatrix = previousProjectionMatrix;
+		quadBatch.setViewAndProjection(viewMatrix, projectionMatrix);
+		clippingBoxStack = std::move(previousClippingBoxStack);
+		if (doClipping && !clippingBoxStack.empty()) Renderer::enableScissorTest(clippingBoxStack.back());
+		else Renderer::disableScissorTest();
+	}
+	//--------------------------------------------------------------------------------------------------
 	void GuiManager::removeFromEnforceLayoutQueues(const GuiID guiID)
+	{
+		// The entries in the queues are skipped once the flags are reset
+		if (guiID >= 0 && static_cast<std::size_t>(guiID) < layoutFlags.size()) layoutFlags[guiID] = 0;
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool GuiManager::addToEnforceLayoutQueue(const GuiID& guiID, std::vector<std::vector<GuiID>>& queue, LayoutFlag flag)
 	{
 		if (guiID >= registeredGuiElements.size() || guiID < 0 || !registeredGuiElements[guiID])
 		{
-			return;
-		}
-		auto it = enforceLayoutQueueUp.find(registeredGuiElements[guiID]->depth);
-		if (it != enforceLayoutQueueUp.end()) {
-			it->second.erase(guiID);
-		}
-		auto it2 = enforceLayoutQueueDown.find(registeredGuiElements[guiID]->depth);
-		if (it2 != enforceLayoutQueueDown.end()) {
-			it2->second.erase(guiID);
+			warningLogger << LOGGER::BEGIN << "Tried to register invalid guiElement to EnforceLayoutQueue." << LOGGER::ENDL;
+			return false;
 		}
+		if (static_cast<std::size_t>(guiID) >= layoutFlags.size()) layoutFlags.resize(registeredGuiElements.size(), 0);
+		if (layoutFlags[guiID] & flag) return true;
+		layoutFlags[guiID] |= flag;
+		const unsigned int depth = registeredGuiElements[guiID]->depth;
+		if (depth >= queue.size()) queue.resize(depth + 1);
+		queue[depth].push_back(guiID);
+		return true;
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::registerForEnforcingLayoutsUpAndDown(const GuiID& guiID)
@@ -161,63 +301,139 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::registerForEnforcingLayoutsUp(const GuiID& guiID)
 	{
-		if (guiID >= registeredGuiElements.size() || guiID < 0 || !registeredGuiElements[guiID])
-		{
-			warningLogger << LOGGER::BEGIN << "Tried to register invalid guiElement to EnforceLayoutQueue." << LOGGER::ENDL;
-			return;
-		}
-		auto it = enforceLayoutQueueUp.find(registeredGuiElements[guiID]->depth);
-		if (it != enforceLayoutQueueUp.end()) {
-			it->second.insert(guiID);
-		}
-		else {
-			enforceLayoutQueueUp.insert(std::make_pair(registeredGuiElements[guiID]->depth, std::set<GuiID>({ guiID })));
-		}
+		if (!addToEnforceLayoutQueue(guiID, enforceLayoutQueueUp, LAYOUT_QUEUED_UP)) return;
+		// The layout of the parent has to be enforced again
+		const GuiID parentID = registeredGuiElements[guiID]->parentID;
+		if (parentID >= 0 && static_cast<std::size_t>(parentID) < layoutFlags.size()) layoutFlags[parentID] &= ~LAYOUT_ENFORCED;
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::registerForEnforcingLayoutsDown(const GuiID& guiID)
 	{
-		if (guiID >= registeredGuiElements.size() || guiID < 0 || !registeredGuiElements[guiID])
-		{
-			warningLogger << LOGGER::BEGIN << "Tried to register invalid guiElement to EnforceLayoutQueue." << LOGGER::ENDL;
+		if (!addToEnforceLayoutQueue(guiID, enforceLayoutQueueDown, LAYOUT_QUEUED_DOWN)) return;
+		layoutFlags[guiID] &= ~LAYOUT_ENFORCED;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiManager::enforceLayout(GuiElement& guiElement)
+	{
+		if (static_cast<std::size_t>(guiElement.guiID) >= layoutFlags.size()) layoutFlags.resize(registeredGuiElements.size(), 0);
+		std::uint8_t& flags = layoutFlags[guiElement.guiID];
+		if (flags & LAYOUT_ENFORCED) {
+			layoutStatistics.layoutsSkipped++;
 			return;
 		}
-		auto it = enforceLayoutQueueDown.find(registeredGuiElements[guiID]->depth);
-		if (it != enforceLayoutQueueDown.end()) {
-			it->second.insert(guiID);
-		}
-		else {
-			enforceLayoutQueueDown.insert(std::make_pair(registeredGuiElements[guiID]->depth, std::set<GuiID>({ guiID })));
+		flags |= LAYOUT_ENFORCED;
+		enforcedLayouts.push_back(guiElement.guiID);
+		layoutStatistics.layoutsEnforced++;
+		guiElement.enforceLayout();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiManager::clearEnforceLayoutQueue(std::vector<std::vector<GuiID>>& queue, std::uint8_t flags)
+	{
+		for (auto& guiIDs : queue) {
+			for (const GuiID& guiID : guiIDs) {
+				if (static_cast<std::size_t>(guiID) < layoutFlags.size()) layoutFlags[guiID] &= ~flags;
+			}
+			guiIDs.clear();
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiManager::precomputeLayouts(const std::vector<GuiID>& queue, unsigned int depth)
+	{
+		precomputedLayoutElements.clear();
+		precomputedLayoutQueueIndices.clear();
+		currentPrecomputedLayout = 0;
+		if (!parallelLayouts || layoutWorkerThreads.empty() || queue.size() < minParallelLayoutCount) return;
+		// Collect all elements that will be enforced in the down sweep
+		for (std::size_t i = 0; i < queue.size(); ++i) {
+			const GuiID guiID = queue[i];
+			if (guiID < 0 || guiID >= registeredGuiElements.size() || !registeredGuiElements[guiID]) continue;
+			if (registeredGuiElements[guiID]->depth != depth) continue;
+			const std::uint8_t flags = layoutFlags[guiID];
+			if (!(flags & LAYOUT_QUEUED_DOWN) || (flags & (LAYOUT_DONE_DOWN | LAYOUT_ENFORCED))) continue;
+			precomputedLayoutElements.push_back(registeredGuiElements[guiID]);
+			precomputedLayoutQueueIndices.push_back(i);
+		}
+		const std::size_t count = precomputedLayoutElements.size();
+		currentPrecomputedLayout = count;
+		if (count < minParallelLayoutCount) {
+			precomputedLayoutElements.clear();
+			precomputedLayoutQueueIndices.clear();
+			currentPrecomputedLayout = 0;
+			return;
 		}
+		if (precomputedLayouts.size() < count) precomputedLayouts.resize(count);
+		precomputedLayoutValid.assign(count, 0);
+		// computeLayout() only reads the element and its children, and writes to its own result
+		runLayoutJob(count, [this](std::size_t index) {
+			precomputedLayoutValid[index] = precomputedLayoutElements[index]->computeLayout(precomputedLayouts[index]) ? 1 : 0;
+		});
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool GuiManager::takePrecomputedLayout(const GuiID& guiID, std::vector<GuiElement::ChildLayout>& childLayouts)
+	{
+		if (currentPrecomputedLayout >= precomputedLayoutElements.size()) return false;
+		const std::size_t index = currentPrecomputedLayout;
+		if (precomputedLayoutElements[index]->guiID != guiID) return false;
+		currentPrecomputedLayout = precomputedLayoutElements.size();
+		if (!precomputedLayoutValid[index]) return false;
+		childLayouts.swap(precomputedLayouts[index]);
+		layoutStatistics.layoutsPrecomputed++;
+		return true;
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::enforceLayouts()
 	{
+		// Entries are only processed if the element still has the queued flag and was not processed
+		// yet in this sweep. Queues are iterated by index, since enforcing a layout can add new entries
+		auto isQueued = [this](GuiID guiID, unsigned int depth, std::uint8_t queuedFlag, std::uint8_t doneFlag) {
+			if (guiID < 0 || guiID >= registeredGuiElements.size() || !registeredGuiElements[guiID]) return false;
+			if (registeredGuiElements[guiID]->depth != depth) return false;
+			std::uint8_t& flags = layoutFlags[guiID];
+			if (!(flags & queuedFlag) || (flags & doneFlag)) return false;
+			flags |= doneFlag;
+			return true;
+		};
 		/// First go from bottom to top and enforce all layouts
-		for (auto rit = enforceLayoutQueueUp.rbegin(); rit != enforceLayoutQueueUp.rend(); ++rit)
+		for (std::size_t depth = enforceLayoutQueueUp.size(); depth-- > 0;)
 		{
-			for (const GuiID& guiID : rit->second)
+			for (std::size_t i = 0; i < enforceLayoutQueueUp[depth].size(); ++i)
 			{
-				if (guiID < registeredGuiElements.size() && guiID >= 0 && registeredGuiElements[guiID]) {
-					GuiID parentID = registeredGuiElements[guiID]->parentID;
-					if (parentID < registeredGuiElements.size() && parentID >= 0 && registeredGuiElements[parentID]) {
-						registeredGuiElements[parentID]->enforceLayout();
-					}
+				const GuiID guiID = enforceLayoutQueueUp[depth][i];
+				if (!isQueued(guiID, static_cast<unsigned int>(depth), LAYOUT_QUEUED_UP, LAYOUT_DONE_UP)) continue;
+				GuiID parentID = registeredGuiElements[guiID]->parentID;
+				if (parentID < registeredGuiElements.size() && parentID >= 0 && registeredGuiElements[parentID]) {
+					enforceLayout(*registeredGuiElements[parentID]);
 				}
 			}
 		}
-		enforceLayoutQueueUp.clear();
-		/// Now go from the top down and enforce all layouts
-		for (const auto& it : enforceLayoutQueueDown)
+		clearEnforceLayoutQueue(enforceLayoutQueueUp, LAYOUT_QUEUED_UP | LAYOUT_DONE_UP);
+		/// Now go from the top down and enforce all layouts. The layouts of all elements at the same 
+		/// depth are independent of each other, so they can be computed in parallel first
+		for (std::size_t depth = 0; depth < enforceLayoutQueueDown.size(); ++depth)
 		{
-			for (const GuiID& guiID : it.second)
+			precomputeLayouts(enforceLayoutQueueDown[depth], static_cast<unsigned int>(depth));
+			std::size_t nextPrecomputedLayout = 0;
+			for (std::size_t i = 0; i < enforceLayoutQueueDown[depth].size(); ++i)
 			{
-				if (guiID < registeredGuiElements.size() && guiID >= 0 && registeredGuiElements[guiID]) {
-					registeredGuiElements[guiID]->enforceLayout();
+				const GuiID guiID = enforceLayoutQueueDown[depth][i];
+				if (!isQueued(guiID, static_cast<unsigned int>(depth), LAYOUT_QUEUED_DOWN, LAYOUT_DONE_DOWN)) continue;
+				while (nextPrecomputedLayout < precomputedLayoutQueueIndices.size() && precomputedLayoutQueueIndices[nextPrecomputedLayout] < i) ++nextPrecomputedLayout;
+				if (nextPrecomputedLayout < precomputedLayoutQueueIndices.size() && precomputedLayoutQueueIndices[nextPrecomputedLayout] == i
+					&& precomputedLayoutElements[nextPrecomputedLayout] == registeredGuiElements[guiID]) {
+					currentPrecomputedLayout = nextPrecomputedLayout;
 				}
+				enforceLayout(*registeredGuiElements[guiID]);
+				currentPrecomputedLayout = precomputedLayoutElements.size();
 			}
 		}
-		enforceLayoutQueueDown.clear();
+		precomputedLayoutElements.clear();
+		precomputedLayoutQueueIndices.clear();
+		currentPrecomputedLayout = 0;
+		clearEnforceLayoutQueue(enforceLayoutQueueDown, LAYOUT_QUEUED_DOWN | LAYOUT_DONE_DOWN);
+		for (const GuiID& guiID : enforcedLayouts) {
+			if (static_cast<std::size_t>(guiID) < layoutFlags.size()) layoutFlags[guiID] &= ~LAYOUT_ENFORCED;
+		}
+		enforcedLayouts.clear();
 		// Callback mouseMotion, because we could collide with moved elements!
 		callbackMouseMotion(currentMousePosition);
 	}
@@ -437,16 +653,17 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::clearEventQueues(const GuiID& guiID)
 	{
-		eventSetMouseButton.erase(guiID);
-		eventSetMouseMotion.erase(guiID);
-		eventSetKeyboard.erase(guiID);
-		eventSetCharacterInput.erase(guiID);
-		eventSetMouseButtonOnElement.erase(guiID);
-		eventSetMouseScrollOnElement.erase(guiID);
-		eventSetMouseEnter.erase(guiID);
-		eventSetMouseLeave.erase(guiID);
-		eventSetUpdate.erase(guiID);
-		eventVectorDrawOnTop.erase(std::remove(eventVectorDrawOnTop.begin(), eventVectorDrawOnTop.end(), guiID), eventVectorDrawOnTop.end());
+		eventTableMouseButton.erase(guiID);
+		eventTableMouseMotion.erase(guiID);
+		eventTableKeyboard.erase(guiID);
+		eventTableCharacterInput.erase(guiID);
+		eventTableMouseButtonOnElement.erase(guiID);
+		eventTableMouseScrollOnElement.erase(guiID);
+		eventTableMouseEnter.erase(guiID);
+		eventTableMouseLeave.erase(guiID);
+		eventTableUpdate.erase(guiID);
+		eventTableDrawOnTop.erase(guiID);
+		eventTableGlyphsAdded.erase(guiID);
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::signOff(const GuiID& guiElement)
@@ -648,49 +865,72 @@ namespace SnackerEngine
 		return offset;
 	}
 	//--------------------------------------------------------------------------------------------------
-	std::optional<GuiID> GuiManager::getLowestCollidingElementInEventSet(const std::unordered_set<GuiID>& eventSet)
+	std::optional<GuiID> GuiManager::getLowestCollidingElementInEventSet(const GuiEventTable& eventTable)
 	{
-		if (eventSet.empty()) return {};
-		return getLowestCollidingChildInEventSet(parentElement, currentMousePosition, eventSet);
+		if (eventTable.empty()) return {};
+		return getLowestCollidingChildInEventSet(parentElement, currentMousePosition, eventTable);
 	}
 	//--------------------------------------------------------------------------------------------------
-	std::optional<GuiID> GuiManager::getLowestCollidingChildInEventSet(const GuiID& parentID, const Vec2i& offset, const std::unordered_set<GuiID>& eventSet)
+	std::optional<GuiID> GuiManager::getLowestCollidingChildInEventSet(const GuiID& parentID, const Vec2i& offset, const GuiEventTable& eventTable)
 	{
 		auto parent = getGuiElement(parentID);
 		if (!parent) return {};
-		for (auto it = parent->children.rbegin(); it != parent->children.rend(); ++it) {
-			auto child = getGuiElement(*it);
-			if (!child) continue;
-			switch (child->isColliding(offset - parent->getChildOffset(*it))) {
-			case GuiElement::IsCollidingResult::COLLIDE_CHILD:
-			case GuiElement::IsCollidingResult::COLLIDE_IF_CHILD_DOES_NOT:
-			{
-				auto result = getLowestCollidingChildInEventSet(*it, offset - parent->getChildOffset(*it), eventSet);
-				if (result.has_value()) return result;
-				if (eventSet.find(*it) != eventSet.end()) return { *it };
-				break;
-			}
-			case GuiElement::IsCollidingResult::COLLIDE_STRONG:
-			{
-				if (eventSet.find(*it) != eventSet.end()) return { *it };
-				return {};
-			}
-			case GuiElement::IsCollidingResult::NOT_COLLIDING:
-			default:
-			{
-				break;
-			}
+		std::optional<GuiID> result;
+		if (parent->updateChildIndex()) {
+			// The index stores the children at their positions. getChildOffset() may move all children
+			// by the same amount (eg. when scrolling), so the offset is moved back accordingly
+			const GuiElement* firstChild = getGuiElement(parent->children.front());
+			const Vec2i translation = firstChild ? firstChild->position - parent->getChildOffset(firstChild->guiID) : Vec2i(0, 0);
+			parent->childIndex.query(offset + translation, parent->childIndexQueryResult);
+			for (auto it = parent->childIndexQueryResult.rbegin(); it != parent->childIndexQueryResult.rend(); ++it) {
+				if (getLowestCollidingChildInEventSet(*parent, parent->children[*it], offset, eventTable, result)) return result;
 			}
+			return {};
+		}
+		for (auto it = parent->children.rbegin(); it != parent->children.rend(); ++it) {
+			if (getLowestCollidingChildInEventSet(*parent, *it, offset, eventTable, result)) return result;
 		}
 		return {};
 	}
 	//--------------------------------------------------------------------------------------------------
+	bool GuiManager::getLowestCollidingChildInEventSet(const GuiElement& parent, const GuiID& childID, const Vec2i& offset, const GuiEventTable& eventTable, std::optional<GuiID>& result)
+	{
+		auto child = getGuiElement(childID);
+		if (!child) return false;
+		const Vec2i childOffset = offset - parent.getChildOffset(childID);
+		switch (child->isColliding(childOffset)) {
+		case GuiElement::IsCollidingResult::COLLIDE_CHILD:
+		case GuiElement::IsCollidingResult::COLLIDE_IF_CHILD_DOES_NOT:
+		{
+			result = getLowestCollidingChildInEventSet(childID, childOffset, eventTable);
+			if (result.has_value()) return true;
+			if (eventTable.contains(childID)) {
+				result = childID;
+				return true;
+			}
+			return false;
+		}
+		case GuiElement::IsCollidingResult::COLLIDE_STRONG:
+		{
+			if (eventTable.contains(childID)) result = childID;
+			else result = {};
+			return true;
+		}
+		case GuiElement::IsCollidingResult::NOT_COLLIDING:
+		default:
+		{
+			return false;
+		}
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
 	void GuiManager::initialize()
 	{
 		// Initialize parser map by registering all standard GuiElement derived classes
 		registerGuiElementType<GuiElement>();
 		registerGuiElementType<GuiPanel>();
 		registerGuiElementType<GuiTextBox>();
+		registerGuiElementType<GuiVirtualizedTextBox>();
 		registerGuiElementType<GuiPositioningLayout>();
 		registerGuiElementType<GuiHorizontalLayout>();
 		registerGuiElementType<GuiHorizontalListLayout>();
@@ -705,6 +945,7 @@ namespace SnackerEngine
 		registerGuiElementType<GuiSliderUnsignedInt>("_UNSIGNED_INT");
 		registerGuiElementType<GuiVerticalListLayout>();
 		registerGuiElementType<GuiVerticalScrollingListLayout>();
+		registerGuiElementType<GuiVirtualListLayout>();
 		registerGuiElementType<GuiWindow>();
 		registerGuiElementType<GuiEditBox>();
 		registerGuiElementType<GuiCheckBox>();
@@ -768,10 +1009,28 @@ namespace SnackerEngine
 		/// Compute default parameters based on GuiScale
 		double guiScale = Engine::getDPI().y / 250.0;
 		recomputeDefaultGuiElementValues(guiScale);
+		// Start the layout worker threads. The main thread computes layouts as well
+		const unsigned int hardwareThreads = std::max(std::thread::hardware_concurrency(), 2u);
+		const unsigned int workerThreadCount = std::min(hardwareThreads - 1, 7u);
+		stopLayoutWorkerThreads = false;
+		for (unsigned int i = 0; i < workerThreadCount; ++i) {
+			layoutWorkerThreads.push_back(std::thread(&runLayoutWorkerThread));
+		}
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::terminate()
 	{
+		// Stop the layout worker threads
+		{
+			std::lock_guard<std::mutex> lock(layoutJobMutex);
+			stopLayoutWorkerThreads = true;
+		}
+		layoutJobConditionVariable.notify_all();
+		for (auto& thread : layoutWorkerThreads) {
+			if (thread.joinable()) thread.join();
+		}
+		layoutWorkerThreads.clear();
+		layoutJobFunction = {};
 		// Cleanup
 		GuiElement::defaultFont = Font();
 		GuiPanel::defaultBackgroundShader = Shader();
@@ -787,10 +1046,11 @@ namespace SnackerEngine
 		: registeredGuiElements(startingSize + 1, nullptr), ownedGuiElements{},
 		availableGuiIDs{}, maxGuiElements(startingSize), registeredGuiElementsCount(0),
 		ownedGuiElementsCount(0), viewMatrix{}, projectionMatrix{}, parentElement(0), currentMousePosition{},
-		lastMouseHoverElement(0), eventSetMouseButton{}, eventSetMouseMotion{}, eventSetKeyboard{},
-		eventSetCharacterInput{}, eventSetMouseButtonOnElement{}, eventSetMouseScrollOnElement{},
-		eventSetMouseEnter{}, eventSetMouseLeave{}, eventSetUpdate{}, eventVectorDrawOnTop{}, signOffQueue{}, squareModel{},
-		triangleModel{}, alphaColorShader{}, clippingBoxStack{}, doClipping(true), enforceLayoutQueueUp{}, enforceLayoutQueueDown{}, // animations{}, TODO: Uncomment
+		lastMouseHoverElement(0), lastGlyphAtlasVersion(FontManager::getGlyphAtlasVersion()), eventTableMouseButton{}, eventTableMouseMotion{}, eventTableKeyboard{},
+		eventTableCharacterInput{}, eventTableMouseButtonOnElement{}, eventTableMouseScrollOnElement{},
+		eventTableMouseEnter{}, eventTableMouseLeave{}, eventTableUpdate{}, eventTableDrawOnTop{}, eventTableGlyphsAdded{}, squareModel{},
+		triangleModel{}, alphaColorShader{}, quadBatch{}, clippingBoxStack{}, doClipping(true), drawCacheTargetStack{}, enforceLayoutQueueUp{}, enforceLayoutQueueDown{}, layoutFlags{}, enforcedLayouts{}, layoutStatistics{}, // animations{}, TODO: Uncomment
+		parallelLayouts(true), precomputedLayoutElements{}, precomputedLayoutQueueIndices{}, precomputedLayouts{}, precomputedLayoutValid{}, currentPrecomputedLayout(0),
 		screenDims{}, namedElements{}, guiGroupMap{}, guiGroups{},
 		registeredGuiGroupsCount(0), availableGuiGroupIDs{}, maxGuiGroups(startingSize)
 	{
@@ -839,6 +1099,7 @@ namespace SnackerEngine
 		guiElement.depth = 1;
 		registeredGuiElements[parentElement]->children.push_back(guiElement.guiID);
 		registeredGuiElements[parentElement]->sortedChildren.push_back(guiElement.guiID);
+		registeredGuiElements[parentElement]->childIndex.invalidate();
 		guiElement.onRegister();
 		registerForEnforcingLayoutsUpAndDown(guiElement.guiID);
 		// Callback mouseMotion, because we could collide with the new element!
@@ -858,6 +1119,7 @@ namespace SnackerEngine
 					element.parentID = 0;
 					registeredGuiElements[parentElement]->children.push_back(element.guiID);
 					registeredGuiElements[parentElement]->sortedChildren.push_back(element.guiID);
+					registeredGuiElements[parentElement]->childIndex.invalidate();
 					element.depth = 1;
 				}
 				element.onRegister();
@@ -883,6 +1145,7 @@ namespace SnackerEngine
 		element.depth = 1;
 		registeredGuiElements[parentElement]->children.push_back(element.guiID);
 		registeredGuiElements[parentElement]->sortedChildren.push_back(element.guiID);
+		registeredGuiElements[parentElement]->childIndex.invalidate();
 		element.onRegister();
 		registerForEnforcingLayoutsUpAndDown(element.guiID);
 		// Callback mouseMotion, because we could collide with the new element!
@@ -919,8 +1182,10 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::setUniformViewAndProjectionMatrices(const Shader& shader)
 	{
-		shader.setUniform<Mat4f>("u_view", viewMatrix);
-		shader.setUniform<Mat4f>("u_projection", projectionMatrix);
+		static constexpr UniformName viewUniform{ "u_view" };
+		static constexpr UniformName projectionUniform{ "u_projection" };
+		shader.setUniform<Mat4f>(viewUniform, viewMatrix);
+		shader.setUniform<Mat4f>(projectionUniform, projectionMatrix);
 	}
 	//--------------------------------------------------------------------------------------------------
 	const Mat4f& GuiManager::getViewMatrix() const
@@ -957,6 +1222,11 @@ namespace SnackerEngine
 		return alphaColorShader;
 	}
 	//--------------------------------------------------------------------------------------------------
+	void GuiManager::flushQuadBatch()
+	{
+		quadBatch.flush();
+	}
+	//--------------------------------------------------------------------------------------------------
 	Vec2i GuiManager::clipSizeToMinMaxSize(const Vec2i& size, const GuiID& guiElement)
 	{
 		if (guiElement > registeredGuiElements.size() || !registeredGuiElements[guiElement]) return Vec2i();
@@ -1190,6 +1460,7 @@ namespace SnackerEngine
 		GuiCheckBox::defaultCheckBoxSize = std::max(1, static_cast<int>(scale * 50));
 		GuiEditBox::defaultCursorWidth = static_cast<float>(scale * 0.05f);
 		GuiVerticalScrollingListLayout::defaultScrollBarWidth = std::max(1, static_cast<int>(scale * 23));
+		GuiVirtualListLayout::defaultItemHeight = std::max(1, static_cast<int>(scale * 30));
 		GuiSliderFloat::defaultSliderButtonWidth = std::max(1, static_cast<int>(scale * 20));
 		GuiSliderDouble::defaultSliderButtonWidth = std::max(1, static_cast<int>(scale * 20));
 		GuiSliderInt::defaultSliderButtonWidth = std::max(1, static_cast<int>(scale * 20));
@@ -1203,47 +1474,41 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::callbackKeyboard(const int& key, const int& scancode, const int& action, const int& mods)
 	{
-		processSignOffQueue();
-		for (const auto& guiID : eventSetKeyboard) {
+		eventTableKeyboard.forEach([&](GuiID guiID) {
 			auto element = getGuiElement(guiID);
-			if (!element) continue;
-			element->callbackKeyboard(key, scancode, action, mods);
-		}
+			if (element) element->callbackKeyboard(key, scancode, action, mods);
+			});
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::callbackMouseButton(const int& button, const int& action, const int& mods)
 	{
-		processSignOffQueue();
 		// Go from the lastMouseHoverElement to the parent elements, until an element is found which 
 		// is registered for mouseButtonOnElement
 		GuiID guiID = lastMouseHoverElement;
 		auto element = getGuiElement(guiID);
-		if (element && eventSetMouseButtonOnElement.find(guiID) != eventSetMouseButtonOnElement.end()) {
+		if (element && eventTableMouseButtonOnElement.contains(guiID)) {
 			element->callbackMouseButtonOnElement(button, action, mods);
 		}
-		for (const auto& guiID : eventSetMouseButton) {
+		eventTableMouseButton.forEach([&](GuiID guiID) {
 			auto element = getGuiElement(guiID);
-			if (!element) continue;
-			element->callbackMouseButton(button, action, mods);
-		}
+			if (element) element->callbackMouseButton(button, action, mods);
+			});
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::callbackMouseMotion(const Vec2d& position)
 	{
-		processSignOffQueue();
 		currentMousePosition = position;
-		for (const auto& guiID : eventSetMouseMotion) {
+		eventTableMouseMotion.forEach([&](GuiID guiID) {
 			auto element = getGuiElement(guiID);
-			if (!element) continue;
-			element->callbackMouseMotion(position);
-		}
+			if (element) element->callbackMouseMotion(position);
+			});
 		auto newMouseHoverElement = getCollidingElement();
 		if (newMouseHoverElement != lastMouseHoverElement) {
-			if (eventSetMouseLeave.find(lastMouseHoverElement) != eventSetMouseLeave.end()) {
+			if (eventTableMouseLeave.contains(lastMouseHoverElement)) {
 				auto element = getGuiElement(lastMouseHoverElement);
 				if (element) element->callbackMouseLeave(position);
 			}
-			if (eventSetMouseEnter.find(newMouseHoverElement) != eventSetMouseEnter.end()) {
+			if (eventTableMouseEnter.contains(newMouseHoverElement)) {
 				auto element = getGuiElement(newMouseHoverElement);
 				if (element) element->callbackMouseEnter(position);
 			}
@@ -1259,8 +1524,7 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::callbackMouseScroll(const Vec2d& offset)
 	{
-		processSignOffQueue();
-		auto result = getLowestCollidingElementInEventSet(eventSetMouseScrollOnElement);
+		auto result = getLowestCollidingElementInEventSet(eventTableMouseScrollOnElement);
 		if (result) {
 			auto element = getGuiElement(result.value());
 			if (element) element->callbackMouseScrollOnElement(offset);
@@ -1269,20 +1533,27 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::callbackCharacterInput(const unsigned int& codepoint)
 	{
-		processSignOffQueue();
-		for (auto& guiID : eventSetCharacterInput) {
+		eventTableCharacterInput.forEach([&](GuiID guiID) {
 			auto element = getGuiElement(guiID);
 			if (element) element->callbackCharacterInput(codepoint);
-		}
+			});
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiManager::update(const double& dt)
 	{
+		layoutStatistics = LayoutStatistics();
 		processSignOffAtNextUpdateQueue();
-		processSignOffQueue();
-		for (auto& guiID : eventSetUpdate) {
+		eventTableUpdate.forEach([&](GuiID guiID) {
 			auto element = getGuiElement(guiID);
 			if (element) element->update(dt);
+			});
+		// Texts waiting for glyphs are recomputed before the layouts are enforced, since their size may change
+		if (lastGlyphAtlasVersion != FontManager::getGlyphAtlasVersion()) {
+			lastGlyphAtlasVersion = FontManager::getGlyphAtlasVersion();
+			eventTableGlyphsAdded.forEach([&](GuiID guiID) {
+				auto element = getGuiElement(guiID);
+				if (element) element->callbackGlyphsAdded();
+				});
 		}
 		updateAnimatables(dt);
 		enforceLayouts();
@@ -1292,13 +1563,15 @@ namespace SnackerEngine
 	{
 		Renderer::disableDepthTesting();
 		Renderer::enableBlending();
+		quadBatch.begin(viewMatrix, projectionMatrix);
 		registeredGuiElements[parentElement]->draw(Vec2i(0, 0));
+		quadBatch.flush();
 		Renderer::disableScissorTest();
 		// Draw all elements that registered for the DRAW_ON_TOP callback
-		for (GuiID guiID : eventVectorDrawOnTop)
-		{
+		eventTableDrawOnTop.forEach([&](GuiID guiID) {
 			registeredGuiElements[guiID]->callbackDrawOnTop(getWorldOffset(guiID));
-		}
+			});
+		quadBatch.flush();
 		Renderer::enableDepthTesting();
 	}
 	//--------------------------------------------------------------------------------------------------
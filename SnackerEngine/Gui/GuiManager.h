@@ -4,6 +4,9 @@
 #include "Math/Mat.h"
 #include "Graphics/Model.h"
 #include "Graphics/Shader.h"
+#include "Gui/GuiQuadBatch.h"
+#include "Gui/GuiDrawCache.h"
+#include "Gui/GuiEventTable.h"
 #include "Gui\Group.h"
 #include "Gui\GuiID.h"
 #include "Gui\GuiAnimatable.h"
@@ -15,6 +18,7 @@
 #include <set>
 #include <optional>
 #include <functional>
+#include <cstdint>
 
 namespace SnackerEngine
 {
@@ -48,6 +52,8 @@ namespace SnackerEngine
 		Vec2i currentMousePosition;
 		/// The guiID of the element the mouse was over last
 		GuiID lastMouseHoverElement;
+		/// The glyph atlas version (see FontManager::getGlyphAtlasVersion()) at the last update
+		unsigned int lastGlyphAtlasVersion;
 		/// The current screen dimensions
 		Vec2i screenDims;
 		
@@ -55,22 +61,20 @@ namespace SnackerEngine
 		// Events
 		//==============================================================================================
 
-		/// Event sets for all types of events that a GuiElement object can register for
-		std::unordered_set<GuiID> eventSetMouseButton;
-		std::unordered_set<GuiID> eventSetMouseMotion;
-		std::unordered_set<GuiID> eventSetKeyboard;
-		std::unordered_set<GuiID> eventSetCharacterInput;
-		std::unordered_set<GuiID> eventSetMouseButtonOnElement;
-		std::unordered_set<GuiID> eventSetMouseScrollOnElement;
-		std::unordered_set<GuiID> eventSetMouseEnter;
-		std::unordered_set<GuiID> eventSetMouseLeave;
-		std::unordered_set<GuiID> eventSetUpdate;
-		std::vector<GuiID> eventVectorDrawOnTop;
-		/// After an event happens, the signoff queue will be processed. This is necessary, as 
-		/// modifying a set while it is iterated through can lead to crashes
-		std::vector<std::pair<GuiID, GuiElement::CallbackType>> signOffQueue;
-		/// processes the signoff queue by signing off elements from the event sets
-		void processSignOffQueue();
+		/// Event tables for all types of events that a GuiElement object can register for. Elements
+		/// are notified in the order they signed up. The tables may be changed while they are iterated,
+		/// so elements can sign up and off from within their callbacks
+		GuiEventTable eventTableMouseButton;
+		GuiEventTable eventTableMouseMotion;
+		GuiEventTable eventTableKeyboard;
+		GuiEventTable eventTableCharacterInput;
+		GuiEventTable eventTableMouseButtonOnElement;
+		GuiEventTable eventTableMouseScrollOnElement;
+		GuiEventTable eventTableMouseEnter;
+		GuiEventTable eventTableMouseLeave;
+		GuiEventTable eventTableUpdate;
+		GuiEventTable eventTableDrawOnTop;
+		GuiEventTable eventTableGlyphsAdded;
 
 	private:
 
@@ -96,6 +100,9 @@ namespace SnackerEngine
 
 		Shader alphaColorShader;
 
+		/// Collects panel and image quads while drawing, see GuiQuadBatch
+		GuiQuadBatch quadBatch;
+
 		//==============================================================================================
 		// Rectangle clipping (scissor testing)
 		//==============================================================================================
@@ -110,16 +117,55 @@ namespace SnackerEngine
 		/// Pops the top clipping box from the stack and updates the scissor test
 		void popClippingBox();
 
+		//==============================================================================================
+		// Retained drawing (see GuiElement::setRetainedDrawing())
+		//==============================================================================================
+
+		/// Stack of the frameBuffers of the retained elements that are currently drawn into their cache.
+		/// Needed for restoring the render target when retained elements are nested
+		std::vector<FrameBuffer*> drawCacheTargetStack;
+		/// Draws the given retained element at the given world position, using its cached drawing. 
+		/// Redraws the cache first if it is outdated
+		void drawRetained(GuiElement& guiElement, const Vec2i& worldPosition);
+		/// Draws the given retained element and its children into the frameBuffer of its cache
+		void drawIntoCache(GuiElement& guiElement);
+
 		//==============================================================================================
 		// Enforcing Layouts
 		//==============================================================================================
 
-		/// Maps that store for each depth a set of GuiIDs that correspond to GuiElements that need their
-		/// Layouts enforced. The maps are cleared when enforceLayouts() is called.
-		std::map<unsigned int, std::set<GuiID>> enforceLayoutQueueUp;
-		std::map<unsigned int, std::set<GuiID>> enforceLayoutQueueDown;
+		/// Bit flags stored for each GuiElement in the layoutFlags vector
+		enum LayoutFlag : std::uint8_t
+		{
+			/// The element is in enforceLayoutQueueUp/enforceLayoutQueueDown
+			LAYOUT_QUEUED_UP = 1,
+			LAYOUT_QUEUED_DOWN = 2,
+			/// The queue entry of the element was already processed in the current sweep
+			LAYOUT_DONE_UP = 4,
+			LAYOUT_DONE_DOWN = 8,
+			/// enforceLayout() was called on the element during the current enforceLayouts() call, and 
+			/// nothing requested a new layout since. Further calls are skipped
+			LAYOUT_ENFORCED = 16,
+		};
+		/// Vectors that store for each depth the GuiIDs of the GuiElements that need their layouts 
+		/// enforced. Each element is only added once, which is tracked by the layoutFlags. The vectors
+		/// are cleared when enforceLayouts() is called
+		std::vector<std::vector<GuiID>> enforceLayoutQueueUp;
+		std::vector<std::vector<GuiID>> enforceLayoutQueueDown;
+		/// LayoutFlags of all elements, indexed by GuiID
+		std::vector<std::uint8_t> layoutFlags;
+		/// GuiIDs of all elements with the LAYOUT_ENFORCED flag
+		std::vector<GuiID> enforcedLayouts;
 		/// Removes a guiElement from both LayoutQueues
 		void removeFromEnforceLayoutQueues(const GuiID guiID);
+		/// Adds the given element to the given queue, if the flag is not set yet. Returns false if the
+		/// element is invalid
+		bool addToEnforceLayoutQueue(const GuiID& guiID, std::vector<std::vector<GuiID>>& queue, LayoutFlag flag);
+		/// Calls enforceLayout() on the given element, unless it was already called during the current
+		/// enforceLayouts() call and no new layout was requested since
+		void enforceLayout(GuiElement& guiElement);
+		/// Clears the given queue and resets the given flags of all elements in it
+		void clearEnforceLayoutQueue(std::vector<std::vector<GuiID>>& queue, std::uint8_t flags);
 		/// This is called by GuiElements who need to enforce Layouts up and down the tree, 
 		/// eg. when the size changes. Layouts are enforced whenever the GuiManager updates.
 		void registerForEnforcingLayoutsUpAndDown(const GuiID& guiID);
@@ -136,6 +182,44 @@ namespace SnackerEngine
 		/// after adding a bunch of elements. Layouts are enforced first from the bottom up, and
 		/// then from the top down in two successive sweeps.
 		void enforceLayouts();
+		/// Statistics about the layouts that were enforced since the start of the last update()
+		struct LayoutStatistics
+		{
+			/// Number of calls to GuiElement::enforceLayout()
+			unsigned int layoutsEnforced = 0;
+			/// Number of layouts that were skipped because they were already enforced and nothing 
+			/// changed since
+			unsigned int layoutsSkipped = 0;
+			/// Number of enforced layouts that were computed in advance on the layout worker threads
+			unsigned int layoutsPrecomputed = 0;
+		};
+	private:
+		LayoutStatistics layoutStatistics;
+		/// If this is set to true, the layouts of many elements with the same depth are computed in 
+		/// parallel on the layout worker threads before they are enforced
+		bool parallelLayouts;
+		/// Minimal number of queued elements at the same depth for computing their layouts in parallel
+		static constexpr std::size_t minParallelLayoutCount = 64;
+		/// Elements whose layouts were computed in advance, their indices into the queue of their depth,
+		/// the computed layouts and whether GuiElement::computeLayout() succeeded
+		std::vector<GuiElement*> precomputedLayoutElements;
+		std::vector<std::size_t> precomputedLayoutQueueIndices;
+		std::vector<std::vector<GuiElement::ChildLayout>> precomputedLayouts;
+		std::vector<std::uint8_t> precomputedLayoutValid;
+		/// Index into precomputedLayoutElements of the element whose layout is currently enforced, or
+		/// precomputedLayoutElements.size() if there is none
+		std::size_t currentPrecomputedLayout;
+		/// Computes the layouts of all elements in the given queue on the layout worker threads, if 
+		/// there are enough of them. The GuiElements are not changed
+		void precomputeLayouts(const std::vector<GuiID>& queue, unsigned int depth);
+		/// Moves the layout that was computed in advance for the given element into childLayouts.
+		/// Returns false if there is none
+		bool takePrecomputedLayout(const GuiID& guiID, std::vector<GuiElement::ChildLayout>& childLayouts);
+	public:
+		const LayoutStatistics& getLayoutStatistics() const { return layoutStatistics; }
+		/// Enables or disables computing layouts in parallel. Enabled by default
+		void setParallelLayouts(bool parallelLayouts) { this->parallelLayouts = parallelLayouts; }
+		bool isParallelLayouts() const { return parallelLayouts; }
 
 		//==============================================================================================
 		// Animations
@@ -318,13 +402,16 @@ namespace SnackerEngine
 		int getMouseOffsetY(GuiID guiID);
 		/// Returns the vector from the parentGuiElement with guiID == 0 to the given guiElement
 		Vec2i getWorldOffset(GuiID guiID);
-		/// Returns the lowest currently colliding element in a given event set. In this context
+		/// Returns the lowest currently colliding element in a given event table. In this context
 		/// "colliding" means != IsCollidingResult::NOT_COLLIDING.
-		std::optional<GuiID> getLowestCollidingElementInEventSet(const std::unordered_set<GuiID>& eventSet);
+		std::optional<GuiID> getLowestCollidingElementInEventSet(const GuiEventTable& eventTable);
 		/// Helper function for getLowestCollidingElementInEventSet() function. Returns the lowest colliding
-		/// child in a given event set, if it exists
+		/// child in a given event table, if it exists
 		/// offset: offset from the top left corner of the parent element
-		std::optional<GuiID> getLowestCollidingChildInEventSet(const GuiID& parentID, const Vec2i& offset, const std::unordered_set<GuiID>& eventSet);
+		std::optional<GuiID> getLowestCollidingChildInEventSet(const GuiID& parentID, const Vec2i& offset, const GuiEventTable& eventTable);
+		/// Helper function for getLowestCollidingChildInEventSet(): Tests a single child of the given parent.
+		/// Returns true if the search is finished, in which case the result is stored in result
+		bool getLowestCollidingChildInEventSet(const GuiElement& parent, const GuiID& childID, const Vec2i& offset, const GuiEventTable& eventTable, std::optional<GuiID>& result);
 		/// Initializes functionality that is the same over several instances of GuiManagers,
 		/// e.g. the parserMap.
 		static void initialize();
@@ -369,6 +456,11 @@ namespace SnackerEngine
 		Model getModelTriangle();
 		/// Returns a basic alpha color shader
 		Shader getAlphaColorShader();
+		/// Returns the batch that collects the quads of panels and images while the GUI is drawn
+		GuiQuadBatch& getQuadBatch() { return quadBatch; }
+		/// Draws all quads that were collected by the quad batch so far. Has to be called by every
+		/// GuiElement that draws something without using the quad batch, before binding its shader
+		void flushQuadBatch();
 		/// Takes a size and a guiElement and clips the size according to minSize and maxSize of the guiElement
 		Vec2i clipSizeToMinMaxSize(const Vec2i& size, const GuiID& guiElement);
 		int clipWidthToMinMaxWidth(const int& width, const GuiID& guiElement);
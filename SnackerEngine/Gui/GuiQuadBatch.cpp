@@ -0,0 +1,108 @@
+#include "Gui/GuiQuadBatch.h"
+#include "AssetManager/MeshManager.h"
+#include "Graphics/Renderer.h"
+
+#include <algorithm>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	VertexBufferLayout GuiQuadBatch::getInstanceLayout()
+	{
+		VertexBufferLayout layout;
+		layout.push<Vec2f>(1);
+		layout.push<Vec2f>(1);
+		layout.push<float>(4);
+		layout.push<float>(4);
+		layout.push<float>(4);
+		layout.push<float>(1);
+		return layout;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiQuadBatch::initialize()
+	{
+		std::vector<Vec2f> vertices{ Vec2f(0.0f, 0.0f), Vec2f(1.0f, 0.0f), Vec2f(1.0f, 1.0f), Vec2f(0.0f, 1.0f) };
+		std::vector<unsigned int> indices{ 0, 1, 2, 0, 2, 3 };
+		VertexBufferLayout layout;
+		layout.push<Vec2f>(1);
+		unitQuad = MeshManager::createMesh<Vec2f>(layout, vertices, indices);
+		panelShader = Shader("shaders/gui/instancedPanel.shader");
+		imageShader = Shader("shaders/gui/instancedImage.shader");
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiQuadBatch::upload()
+	{
+		const unsigned int instanceCount = static_cast<unsigned int>(instances.size());
+		if (instanceCount > capacity) {
+			// Grow geometrically, such that the buffer quickly reaches the size of the largest batch
+			capacity = std::max(instanceCount, capacity * 2);
+			std::vector<unsigned char> initialData(std::size_t(capacity) * sizeof(QuadInstance));
+			instanceBuffer = VertexBuffer(VertexBuffer::VertexBufferStorageType::DYNAMIC);
+			instanceBuffer.setDataAndFinalize(initialData);
+			// The vertex buffer of the unit quad has to be bound when the VertexArray object is finalized
+			unitQuad.getVertexBuffer().bind();
+			VertexBufferLayout quadLayout;
+			quadLayout.push<Vec2f>(1);
+			vertexArray = VertexArray(quadLayout, unitQuad.getVertexBuffer());
+			vertexArray.bindInstanceBuffer(instanceBuffer, getInstanceLayout());
+			VertexArray::unbind();
+		}
+		instanceBuffer.changeSubData(instances.data(), instanceCount, 0);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiQuadBatch::begin(const Mat4f& viewMatrix, const Mat4f& projectionMatrix)
+	{
+		instances.clear();
+		batchType = BatchType::NONE;
+		this->viewMatrix = viewMatrix;
+		this->projectionMatrix = projectionMatrix;
+		drawCallCount = 0;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiQuadBatch::setViewAndProjection(const Mat4f& viewMatrix, const Mat4f& projectionMatrix)
+	{
+		this->viewMatrix = viewMatrix;
+		this->projectionMatrix = projectionMatrix;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiQuadBatch::addPanel(const QuadInstance& quad)
+	{
+		if (batchType != BatchType::PANEL) {
+			flush();
+			batchType = BatchType::PANEL;
+		}
+		instances.push_back(quad);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiQuadBatch::addImage(const Vec2f& position, const Vec2f& size, const Texture& texture)
+	{
+		if (batchType != BatchType::IMAGE || this->texture.getTextureID() != texture.getTextureID()) {
+			flush();
+			batchType = BatchType::IMAGE;
+			this->texture = texture;
+		}
+		instances.push_back(QuadInstance{ position, size, Color4f(1.0f), Color4f(0.0f), Vec4f(0.0f), 0.0f });
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiQuadBatch::flush()
+	{
+		if (instances.empty()) {
+			batchType = BatchType::NONE;
+			return;
+		}
+		if (!unitQuad.isValid()) initialize();
+		upload();
+		const Shader& shader = batchType == BatchType::PANEL ? panelShader : imageShader;
+		shader.bind();
+		static constexpr UniformName viewUniform{ "u_view" };
+		static constexpr UniformName projectionUniform{ "u_projection" };
+		shader.setUniform<Mat4f>(viewUniform, viewMatrix);
+		shader.setUniform<Mat4f>(projectionUniform, projectionMatrix);
+		if (batchType == BatchType::IMAGE) texture.bind();
+		Renderer::drawInstanced(vertexArray, unitQuad.getIndexBuffer(), static_cast<unsigned int>(instances.size()));
+		drawCallCount++;
+		instances.clear();
+		batchType = BatchType::NONE;
+	}
+	//--------------------------------------------------------------------------------------------------
+}
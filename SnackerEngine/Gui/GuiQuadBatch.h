@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Graphics/Mesh.h"
+#include "Graphics/Shader.h"
+#include "Graphics/Texture.h"
+#include "Graphics/Color.h"
+#include "Math/Mat.h"
+
+#include <vector>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// Collects the quads of GuiPanel backgrounds (including borders and rounded corners) and of
+	/// GuiImage objects while the GUI is drawn, and draws consecutive quads that share the same shader
+	/// and texture with a single instanced draw call. Quads are always drawn in the order they were
+	/// added. The batch has to be flushed before anything else is drawn and before the clipping box
+	/// changes, which is done by the GuiManager (see GuiManager::flushQuadBatch()).
+	class GuiQuadBatch
+	{
+	public:
+		/// A single quad. Position and size are given in pixels, the position is the bottom left corner
+		/// in the coordinate system of the GuiManager (y axis pointing up)
+		struct QuadInstance
+		{
+			Vec2f position;
+			Vec2f size;
+			Color4f color;
+			Color4f borderColor;
+			/// top left, top right, bottom right, bottom left
+			Vec4f roundedCorners;
+			float borderThickness;
+		};
+	private:
+		/// The kind of quads that are currently collected
+		enum class BatchType
+		{
+			NONE,
+			PANEL,
+			IMAGE,
+		};
+		/// Shaders used for drawing the batches
+		Shader panelShader{};
+		Shader imageShader{};
+		/// Unit quad shared by all instances
+		Mesh unitQuad{};
+		/// VertexArray object combining the vertex buffer of the unit quad with the instance buffer
+		VertexArray vertexArray{};
+		/// Buffer storing the instances of the current batch
+		VertexBuffer instanceBuffer{ VertexBuffer::VertexBufferStorageType::DYNAMIC };
+		/// Number of instances that fit into the instance buffer
+		unsigned int capacity = 0;
+		/// The instances of the current batch
+		std::vector<QuadInstance> instances{};
+		/// The kind of the current batch
+		BatchType batchType = BatchType::NONE;
+		/// The texture of the current batch. Only used for image batches
+		Texture texture{};
+		/// View and projection matrix, set by begin()
+		Mat4f viewMatrix{};
+		Mat4f projectionMatrix{};
+		/// Number of instanced draw calls since the last call to begin()
+		unsigned int drawCallCount = 0;
+		/// Creates the unit quad and loads the shaders. Called on the first flush
+		void initialize();
+		/// Returns the layout of a single QuadInstance
+		static VertexBufferLayout getInstanceLayout();
+		/// Uploads the instances vector, recreates the buffers if they are too small
+		void upload();
+	public:
+		/// Default constructor
+		GuiQuadBatch() = default;
+		/// Starts a new frame with the given view and projection matrix
+		void begin(const Mat4f& viewMatrix, const Mat4f& projectionMatrix);
+		/// Changes the view and projection matrix without starting a new frame. The batch has to be
+		/// flushed before calling this function
+		void setViewAndProjection(const Mat4f& viewMatrix, const Mat4f& projectionMatrix);
+		/// Adds the background quad of a panel. Flushes the current batch if it contains images
+		void addPanel(const QuadInstance& quad);
+		/// Adds an image quad that is drawn with the given texture. Flushes the current batch if it
+		/// contains panels or images with a different texture
+		void addImage(const Vec2f& position, const Vec2f& size, const Texture& texture);
+		/// Draws all collected quads with a single instanced draw call and clears the batch
+		void flush();
+		/// Returns the number of instanced draw calls since the last call to begin()
+		unsigned int getDrawCallCount() const { return drawCallCount; }
+	};
+	//--------------------------------------------------------------------------------------------------
+}
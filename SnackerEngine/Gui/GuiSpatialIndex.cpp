@@ -0,0 +1,109 @@
+#include "Gui/GuiSpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	int GuiSpatialIndex::getCell(int coordinate, unsigned int dimension) const
+	{
+		const int cell = (coordinate - origin[dimension]) / cellSize[dimension];
+		return std::clamp(cell, 0, cellCount[dimension] - 1);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiSpatialIndex::build(std::vector<Rect>&& rects)
+	{
+		this->rects = std::move(rects);
+		cellStart.clear();
+		cellEntries.clear();
+		largeEntries.clear();
+		valid = true;
+		// Compute the bounding box of all non-empty rectangles
+		Vec2i boundsMin(std::numeric_limits<int>::max(), std::numeric_limits<int>::max());
+		Vec2i boundsMax(std::numeric_limits<int>::min(), std::numeric_limits<int>::min());
+		for (const Rect& rect : this->rects) {
+			if (rect.min.x > rect.max.x || rect.min.y > rect.max.y) continue;
+			boundsMin.x = std::min(boundsMin.x, rect.min.x);
+			boundsMin.y = std::min(boundsMin.y, rect.min.y);
+			boundsMax.x = std::max(boundsMax.x, rect.max.x);
+			boundsMax.y = std::max(boundsMax.y, rect.max.y);
+		}
+		if (boundsMin.x > boundsMax.x) {
+			cellCount = Vec2i(0, 0);
+			return;
+		}
+		// Roughly one entry per cell
+		const int cellsPerDimension = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(this->rects.size())))));
+		origin = boundsMin;
+		for (unsigned int i = 0; i < 2; ++i) {
+			const int extent = boundsMax[i] - boundsMin[i] + 1;
+			cellSize[i] = std::max(1, (extent + cellsPerDimension - 1) / cellsPerDimension);
+			cellCount[i] = (extent + cellSize[i] - 1) / cellSize[i];
+		}
+		// Count the entries of each cell first, then fill the cellEntries vector (counting sort)
+		cellStart.assign(static_cast<std::size_t>(cellCount.x) * cellCount.y + 1, 0);
+		std::vector<Vec4i> cellRanges(this->rects.size(), Vec4i(0, -1, 0, -1));
+		for (unsigned int i = 0; i < this->rects.size(); ++i) {
+			const Rect& rect = this->rects[i];
+			if (rect.min.x > rect.max.x || rect.min.y > rect.max.y) continue;
+			const Vec4i range(getCell(rect.min.x, 0), getCell(rect.max.x, 0), getCell(rect.min.y, 1), getCell(rect.max.y, 1));
+			if ((range.y - range.x + 1) * (range.w - range.z + 1) > maxCellsPerEntry) {
+				largeEntries.push_back(i);
+				continue;
+			}
+			cellRanges[i] = range;
+			for (int y = range.z; y <= range.w; ++y) {
+				for (int x = range.x; x <= range.y; ++x) {
+					cellStart[static_cast<std::size_t>(y) * cellCount.x + x + 1]++;
+				}
+			}
+		}
+		for (std::size_t i = 1; i < cellStart.size(); ++i) cellStart[i] += cellStart[i - 1];
+		cellEntries.resize(cellStart.back());
+		std::vector<unsigned int> fill(cellStart.begin(), cellStart.end() - 1);
+		for (unsigned int i = 0; i < this->rects.size(); ++i) {
+			const Vec4i& range = cellRanges[i];
+			for (int y = range.z; y <= range.w; ++y) {
+				for (int x = range.x; x <= range.y; ++x) {
+					cellEntries[fill[static_cast<std::size_t>(y) * cellCount.x + x]++] = i;
+				}
+			}
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiSpatialIndex::query(const Vec2i& point, std::vector<unsigned int>& result) const
+	{
+		result.clear();
+		auto contains = [this, &point](unsigned int index) {
+			const Rect& rect = rects[index];
+			return point.x >= rect.min.x && point.x <= rect.max.x && point.y >= rect.min.y && point.y <= rect.max.y;
+		};
+		if (cellCount.x > 0 && point.x >= origin.x && point.y >= origin.y &&
+			point.x < origin.x + cellCount.x * cellSize.x && point.y < origin.y + cellCount.y * cellSize.y) {
+			const std::size_t cell = static_cast<std::size_t>(getCell(point.y, 1)) * cellCount.x + getCell(point.x, 0);
+			for (unsigned int i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+				if (contains(cellEntries[i])) result.push_back(cellEntries[i]);
+			}
+		}
+		if (largeEntries.empty()) return;
+		const std::size_t cellResultCount = result.size();
+		for (unsigned int index : largeEntries) {
+			if (contains(index)) result.push_back(index);
+		}
+		std::inplace_merge(result.begin(), result.begin() + cellResultCount, result.end());
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiSpatialIndex::clear()
+	{
+		rects = std::vector<Rect>();
+		cellStart = std::vector<unsigned int>();
+		cellEntries = std::vector<unsigned int>();
+		largeEntries = std::vector<unsigned int>();
+		cellCount = Vec2i(0, 0);
+		valid = false;
+		invalidQueryCount = 0;
+	}
+	//--------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Math/Vec.h"
+
+#include <vector>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// Uniform grid over a set of axis aligned rectangles, used by GuiElement objects with many children
+	/// for finding the children below the mouse cursor without testing every single child. Entries are
+	/// referred to by their index in the vector passed to build(). Rectangles that cover many cells are
+	/// not inserted into the grid but kept in a separate list that is tested on every query.
+	class GuiSpatialIndex
+	{
+	public:
+		/// Number of entries from which on building an index pays off
+		static constexpr std::size_t minEntryCount = 16;
+		/// A rectangle, given by its two (inclusive) corners. Rectangles with min > max never collide
+		struct Rect
+		{
+			Vec2i min;
+			Vec2i max;
+		};
+	private:
+		/// Rectangles spanning more cells than this are stored in the largeEntries vector
+		static constexpr int maxCellsPerEntry = 16;
+		/// Number of queries an invalid index has to receive before it is rebuilt, see shouldRebuild()
+		static constexpr unsigned int rebuildDelay = 2;
+		/// All entries
+		std::vector<Rect> rects{};
+		/// Position of the first cell
+		Vec2i origin{};
+		/// Size of a single cell in pixels
+		Vec2i cellSize{ 1, 1 };
+		/// Number of cells in x and y direction
+		Vec2i cellCount{};
+		/// For each cell, the index of its first entry in the cellEntries vector. Has one additional
+		/// element at the end, such that the entries of cell i are [cellStart[i], cellStart[i + 1])
+		std::vector<unsigned int> cellStart{};
+		/// Indices of the entries of all cells, sorted by cell and then by index
+		std::vector<unsigned int> cellEntries{};
+		/// Indices of the entries that are too large for being stored in the cells, sorted by index
+		std::vector<unsigned int> largeEntries{};
+		/// Wether the index is up to date
+		bool valid = false;
+		/// Number of calls to shouldRebuild() since the index was invalidated
+		unsigned int invalidQueryCount = 0;
+		/// Returns the cell index in one dimension, clamped to the grid
+		int getCell(int coordinate, unsigned int dimension) const;
+	public:
+		/// Default constructor
+		GuiSpatialIndex() = default;
+		/// Builds the index from the given rectangles and marks it as valid
+		void build(std::vector<Rect>&& rects);
+		/// Writes the indices of all entries whose rectangle contains the given point into the result
+		/// vector, sorted in ascending order
+		void query(const Vec2i& point, std::vector<unsigned int>& result) const;
+		/// Marks the index as outdated. It has to be rebuilt before the next query
+		void invalidate() { valid = false; invalidQueryCount = 0; }
+		/// Should be called when a query is needed but the index is invalid. Returns true if the index
+		/// should be rebuilt. This is only the case once the entries did not change for a few queries, 
+		/// such that the index is not rebuilt over and over while entries are added or moved
+		bool shouldRebuild() { return ++invalidQueryCount >= rebuildDelay; }
+		/// Removes all entries and frees the memory
+		void clear();
+		/// Getters
+		bool isValid() const { return valid; }
+		std::size_t getEntryCount() const { return rects.size(); }
+	};
+	//--------------------------------------------------------------------------------------------------
+}
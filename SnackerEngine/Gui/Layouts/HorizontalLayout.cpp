@@ -186,33 +186,32 @@ namespace SnackerEngine
 		return index;
 	}
 	//--------------------------------------------------------------------------------------------------
-	void GuiHorizontalLayout::enforceLayout()
+	void GuiHorizontalLayout::computeChildLayoutsY(std::vector<ChildLayout>& childLayouts) const
 	{
-		/// Set y position and height of children
 		const auto& children = getChildren();
 		switch (horizontalLayoutMode)
 		{
 		case HorizontalLayoutMode::CHILD_HEIGHT_RANGE:
 		{
 			for (unsigned i = 0; i < children.size(); ++i) {
-				GuiElement* child = getElement(children[i]);
+				const GuiElement* child = getElement(children[i]);
 				if (!child) continue;
 				int childHeight = child->getPreferredHeight();
 				if (childHeight < 0) childHeight = child->getMaxHeight() >= 0 ? child->getMaxHeight() : getHeight() - 2 * static_cast<int>(verticalBorder);
 				childHeight = std::min(childHeight, getHeight() - 2 * static_cast<int>(verticalBorder));
 				childHeight = child->clampToMinMaxHeight(childHeight);
-				child->setHeight(childHeight);
-				child->setPositionY(computeChildPositionY(child->getHeight(), alignmentsVertical[i]));
+				childLayouts[i].size.y = childHeight;
+				childLayouts[i].position.y = computeChildPositionY(childHeight, alignmentsVertical[i]);
 			}
 			break;
 		}
 		case HorizontalLayoutMode::CHILD_HEIGHT_TO_LAYOUT_HEIGHT:
 		{
 			for (unsigned i = 0; i < children.size(); ++i) {
-				GuiElement* child = getElement(children[i]);
+				const GuiElement* child = getElement(children[i]);
 				if (!child) continue;
-				child->setHeight(child->clampToMinMaxHeight(getHeight() - 2 * static_cast<int>(verticalBorder)));
-				child->setPositionY(computeChildPositionY(child->getHeight(), alignmentsVertical[i]));
+				childLayouts[i].size.y = child->clampToMinMaxHeight(getHeight() - 2 * static_cast<int>(verticalBorder));
+				childLayouts[i].position.y = computeChildPositionY(childLayouts[i].size.y, alignmentsVertical[i]);
 			}
 			break;
 		}
@@ -221,7 +220,7 @@ namespace SnackerEngine
 			// Determine largest preferredHeight
 			int largestPreferredHeight = -1;
 			for (auto childID : children) {
-				GuiElement* child = getElement(childID);
+				const GuiElement* child = getElement(childID);
 				if (child) {
 					int preferredHeight = child->getPreferredHeight();
 					if (preferredHeight == SIZE_HINT_AS_LARGE_AS_POSSIBLE) {
@@ -234,14 +233,28 @@ namespace SnackerEngine
 			largestPreferredHeight = std::min(largestPreferredHeight, getHeight() - 2 * static_cast<int>(verticalBorder));
 			if (largestPreferredHeight == SIZE_HINT_ARBITRARY) largestPreferredHeight = getHeight() - 2 * static_cast<int>(verticalBorder);
 			for (unsigned i = 0; i < children.size(); ++i) {
-				GuiElement* child = getElement(children[i]);
+				const GuiElement* child = getElement(children[i]);
 				if (!child) continue;
-				child->setHeight(child->clampToMinMaxHeight(largestPreferredHeight));
-				child->setPositionY(computeChildPositionY(child->getHeight(), alignmentsVertical[i]));
+				childLayouts[i].size.y = child->clampToMinMaxHeight(largestPreferredHeight);
+				childLayouts[i].position.y = computeChildPositionY(childLayouts[i].size.y, alignmentsVertical[i]);
 			}
 			break;
 		}
 		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiHorizontalLayout::enforceLayout()
+	{
+		/// Set y position and height of children
+		std::vector<ChildLayout> childLayouts;
+		getCurrentChildLayouts(childLayouts);
+		computeChildLayoutsY(childLayouts);
+		for (const auto& childLayout : childLayouts) {
+			GuiElement* child = getElement(childLayout.childID);
+			if (!child) continue;
+			child->setHeight(childLayout.size.y);
+			child->setPositionY(childLayout.position.y);
+		}
 		computeHeightHintsFromChildren();
 	}
 	//--------------------------------------------------------------------------------------------------
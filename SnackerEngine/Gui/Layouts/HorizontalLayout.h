@@ -32,8 +32,12 @@ namespace SnackerEngine
 		int computeChildPositionY(int childHeight, AlignmentVertical alignmentVertical) const;
 		/// Helper function that gets called when a child is registered
 		void onRegisterChild(AlignmentVertical alignmentVertical);
+	protected:
 		/// Computes the minHeight, preferredHeight and maxHeight of this layout from the size hints of its children
 		void computeHeightHintsFromChildren();
+		/// Computes the y position and height of all children and stores them in childLayouts, which
+		/// has one entry per child. The x position and width are left unchanged
+		void computeChildLayoutsY(std::vector<ChildLayout>& childLayouts) const;
 	public:
 		/// name of this GuiElementType for JSON parsing
 		static constexpr std::string_view typeName = "GUI_HORIZONTAL_LAYOUT";
@@ -315,69 +315,102 @@ namespace SnackerEngine
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
-	void GuiHorizontalListLayout::enforceLayout()
+	std::vector<int> GuiHorizontalListLayout::computeChildWidthsFromHints() const
 	{
-		GuiHorizontalLayout::enforceLayout();
-		std::vector<int> widths;
-		if (groupID != -1 && groupExists(groupID)) {
-			GuiGroup* groupPointer = getGroup(groupID);
-			if (groupPointer != nullptr) {
-				HorizontalLayoutGroup* horizontalLayoutGroupPointer = static_cast<HorizontalLayoutGroup*>(groupPointer);
-				horizontalLayoutGroupPointer->recomputeWidths();
-				widths = horizontalLayoutGroupPointer->getWidths();
-			}
-		}
 		const auto& childIDs = getChildren();
-		if (childIDs.empty()) return;
-		if (widths.empty()) {
-			std::vector<int> minWidths;
-			std::vector<int> preferredWidths;
-			std::vector<int> maxWidths;
-			for (auto childId : childIDs) {
-				GuiElement* child = getElement(childId);
-				if (child) {
-					minWidths.push_back(child->getMinWidth());
-					if (child->getPreferredWidth() < 0) preferredWidths.push_back(child->getPreferredWidth());
-					else preferredWidths.push_back(child->clampToMinMaxWidth(child->getPreferredWidth()));
-					maxWidths.push_back(child->getMaxWidth());
-				}
-				else {
-					minWidths.push_back(0);
-					preferredWidths.push_back(SIZE_HINT_ARBITRARY);
-					maxWidths.push_back(SIZE_HINT_ARBITRARY);
-				}
+		std::vector<int> minWidths;
+		std::vector<int> preferredWidths;
+		std::vector<int> maxWidths;
+		for (auto childId : childIDs) {
+			const GuiElement* child = getElement(childId);
+			if (child) {
+				minWidths.push_back(child->getMinWidth());
+				if (child->getPreferredWidth() < 0) preferredWidths.push_back(child->getPreferredWidth());
+				else preferredWidths.push_back(child->clampToMinMaxWidth(child->getPreferredWidth()));
+				maxWidths.push_back(child->getMaxWidth());
+			}
+			else {
+				minWidths.push_back(0);
+				preferredWidths.push_back(SIZE_HINT_ARBITRARY);
+				maxWidths.push_back(SIZE_HINT_ARBITRARY);
 			}
-			widths = computeChildWidths(minWidths, preferredWidths, maxWidths, getWidth() - static_cast<int>(horizontalBorder * (getChildren().size() - 1)) - static_cast<int>(outerHorizontalBorder * 2));
 		}
-		// Now we can actually position and resize the elements
+		return computeChildWidths(minWidths, preferredWidths, maxWidths, getWidth() - static_cast<int>(horizontalBorder * (childIDs.size() - 1)) - static_cast<int>(outerHorizontalBorder * 2));
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiHorizontalListLayout::computeChildLayoutsX(const std::vector<int>& widths, std::vector<ChildLayout>& childLayouts) const
+	{
 		if (alignmentHorizontal == AlignmentHorizontal::LEFT || alignmentHorizontal == AlignmentHorizontal::CENTER) {
 			int position = outerHorizontalBorder;
 			if (alignmentHorizontal == AlignmentHorizontal::CENTER) {
-				int totalWidth = horizontalBorder * (static_cast<int>(childIDs.size()) - 1);
+				int totalWidth = horizontalBorder * (static_cast<int>(childLayouts.size()) - 1);
 				for (auto width : widths) totalWidth += width;
 				position = (getWidth() - totalWidth) / 2;
 			}
-			for (unsigned i = 0; i < childIDs.size(); ++i) {
-				GuiElement* child = getElement(childIDs[i]);
-				if (child) {
-					child->setPositionX(position);
-					child->setWidth(widths[i]);
-				}
+			for (unsigned i = 0; i < childLayouts.size(); ++i) {
+				childLayouts[i].position.x = position;
+				childLayouts[i].size.x = widths[i];
 				position += widths[i] + horizontalBorder;
 			}
 		}
 		else {
 			int position = getWidth() - horizontalBorder;
-			for (int i = static_cast<int>(childIDs.size()) - 1; i >= 0; --i) {
-				GuiElement* child = getElement(childIDs[i]);
+			for (int i = static_cast<int>(childLayouts.size()) - 1; i >= 0; --i) {
 				position -= widths[i];
-				if (child) {
-					child->setPositionX(position);
-					child->setWidth(widths[i]);
-				}
+				childLayouts[i].position.x = position;
+				childLayouts[i].size.x = widths[i];
 				position -= horizontalBorder;
 			}
 		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool GuiHorizontalListLayout::computeLayout(std::vector<ChildLayout>& childLayouts) const
+	{
+		// The widths of layouts in a group depend on all other layouts in the group
+		if (groupID != -1) return false;
+		getCurrentChildLayouts(childLayouts);
+		computeChildLayoutsY(childLayouts);
+		// The width hints of a child can depend on its height. If a height changes, enforceLayout()
+		// has to apply the heights before the widths are computed from the hints
+		for (const auto& childLayout : childLayouts) {
+			const GuiElement* child = getElement(childLayout.childID);
+			if (child && child->getHeight() != childLayout.size.y) return false;
+		}
+		if (!childLayouts.empty()) computeChildLayoutsX(computeChildWidthsFromHints(), childLayouts);
+		return true;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiHorizontalListLayout::enforceLayout()
+	{
+		std::vector<ChildLayout> childLayouts;
+		if (getLayout(childLayouts)) {
+			applyLayout(childLayouts);
+			computeHeightHintsFromChildren();
+			// Compute new minWidth
+			if (!childLayouts.empty()) computeWidthHintsFromChildren();
+			return;
+		}
+		GuiHorizontalLayout::enforceLayout();
+		std::vector<int> widths;
+		if (groupID != -1 && groupExists(groupID)) {
+			GuiGroup* groupPointer = getGroup(groupID);
+			if (groupPointer != nullptr) {
+				HorizontalLayoutGroup* horizontalLayoutGroupPointer = static_cast<HorizontalLayoutGroup*>(groupPointer);
+				horizontalLayoutGroupPointer->recomputeWidths();
+				widths = horizontalLayoutGroupPointer->getWidths();
+			}
+		}
+		if (getChildren().empty()) return;
+		if (widths.empty()) widths = computeChildWidthsFromHints();
+		// Now we can actually position and resize the elements
+		getCurrentChildLayouts(childLayouts);
+		computeChildLayoutsX(widths, childLayouts);
+		for (const auto& childLayout : childLayouts) {
+			GuiElement* child = getElement(childLayout.childID);
+			if (!child) continue;
+			child->setPositionX(childLayout.position.x);
+			child->setWidth(childLayout.size.x);
+		}
 		// Compute new minWidth
 		computeWidthHintsFromChildren();
 	}
@@ -59,6 +59,11 @@ namespace SnackerEngine
 		bool shrinkWidthToChildren = false;
 		/// Helper function for enforcing the layout
 		static std::vector<int> computeChildWidths(const std::vector<int>& minWidths, const std::vector<int>& preferredWidths, const std::vector<int>& maxWidths, int width);
+		/// Computes the widths of all children from their size hints
+		std::vector<int> computeChildWidthsFromHints() const;
+		/// Computes the x position of all children from the given widths and stores them together
+		/// with the widths in childLayouts
+		void computeChildLayoutsX(const std::vector<int>& widths, std::vector<ChildLayout>& childLayouts) const;
 	protected:
 		/// Helper function that computes the minWidth of the layout from its childElements.
 		void computeWidthHintsFromChildren();
@@ -110,6 +115,9 @@ namespace SnackerEngine
 		/// layout rules, if there are any. May recursively call setLayout() on the
 		/// children as well
 		virtual void enforceLayout() override;
+		/// Computes the positions and sizes of all children. Not supported for layouts in a group, or
+		/// if the height of a child changes, since its width hints may depend on its height
+		virtual bool computeLayout(std::vector<ChildLayout>& childLayouts) const override;
 
 		//==============================================================================================
 		// Groups
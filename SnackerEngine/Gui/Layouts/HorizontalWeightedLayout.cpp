@@ -351,7 +351,7 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	GuiElement::IsCollidingResult GuiHorizontalWeightedLayout::isColliding(const Vec2i& offset) const
 	{
-		if (offset.y < 0 || offset.y > getHeight()) return IsCollidingResult::NOT_COLLIDING;
+		if (offset.x < 0 || offset.x > getWidth() || offset.y < 0 || offset.y > getHeight()) return IsCollidingResult::NOT_COLLIDING;
 		return getCollidingBorderAndOffset(offset) ? IsCollidingResult::COLLIDE_STRONG : IsCollidingResult::COLLIDE_CHILD;
 	}
 	//--------------------------------------------------------------------------------------------------
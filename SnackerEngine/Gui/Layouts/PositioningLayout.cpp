@@ -100,14 +100,13 @@ namespace SnackerEngine
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
-	void GuiPositioningLayout::enforceLayout()
+	bool GuiPositioningLayout::computeLayout(std::vector<ChildLayout>& childLayouts) const
 	{
-		const std::vector<GuiID>& children = getChildren();
-		if (children.empty()) return;
+		getCurrentChildLayouts(childLayouts);
 		const Vec2i& mySize = getSize();
-		for (GuiID childID : children) 
+		for (ChildLayout& childLayout : childLayouts)
 		{
-			GuiElement* child = getElement(childID);
+			const GuiElement* child = getElement(childLayout.childID);
 			if (!child) continue;
 			Vec2i childSize = child->getPreferredSize();
 			Vec2i childPosition{};
@@ -167,9 +166,19 @@ namespace SnackerEngine
 				childPosition.y = std::min(childPosition.y, mySize.y - bottomBorder - childSize.y);
 				childPosition.y = std::max(childPosition.y, topBorder);
 			}
-			// Enforce Layout
-			setPositionAndSizeOfChild(childID, childPosition, childSize);
+			childLayout.position = childPosition;
+			childLayout.size = childSize;
 		}
+		return true;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiPositioningLayout::enforceLayout()
+	{
+		const std::vector<GuiID>& children = getChildren();
+		if (children.empty()) return;
+		std::vector<ChildLayout> childLayouts;
+		// Enforce Layout
+		if (getLayout(childLayouts)) applyLayout(childLayouts);
 		// Check if we need to modify sizeHints
 		if (shrinkWidthToChildren) {
 			// Find smallest minWidth and largest preferredWidth and maxWidth
@@ -70,6 +70,8 @@ namespace SnackerEngine
 		/// layout rules, if there are any. May recursively call setLayout() on the
 		/// children as well
 		virtual void enforceLayout() override;
+		/// Computes the positions and sizes of all children
+		virtual bool computeLayout(std::vector<ChildLayout>& childLayouts) const override;
 	};
 	//--------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
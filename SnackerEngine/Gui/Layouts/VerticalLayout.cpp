@@ -187,33 +187,32 @@ namespace SnackerEngine
 		return index;
 	}
 	//--------------------------------------------------------------------------------------------------
-	void GuiVerticalLayout::enforceLayout()
+	void GuiVerticalLayout::computeChildLayoutsX(std::vector<ChildLayout>& childLayouts) const
 	{
-		/// Set x position and width of children
 		const auto& children = getChildren();
 		switch (verticalLayoutMode)
 		{
 		case VerticalLayoutMode::CHILD_WIDTH_RANGE:
 		{
 			for (unsigned i = 0; i < children.size(); ++i) {
-				GuiElement* child = getElement(children[i]);
+				const GuiElement* child = getElement(children[i]);
 				if (!child) continue;
 				int childWidth = child->getPreferredWidth();
 				if (childWidth < 0) childWidth = child->getMaxWidth() >= 0 ? child->getMaxWidth() : getWidth() - 2 * static_cast<int>(horizontalBorder);
 				childWidth = std::min(childWidth, getWidth() - 2 * static_cast<int>(horizontalBorder));
 				childWidth = child->clampToMinMaxWidth(childWidth);
-				child->setWidth(childWidth);
-				child->setPositionX(computeChildPositionX(child->getWidth(), alignmentsHorizontal[i]));
+				childLayouts[i].size.x = childWidth;
+				childLayouts[i].position.x = computeChildPositionX(childWidth, alignmentsHorizontal[i]);
 			}
 			break;
 		}
 		case VerticalLayoutMode::CHILD_WIDTH_TO_LAYOUT_WIDTH:
 		{
 			for (unsigned i = 0; i < children.size(); ++i) {
-				GuiElement* child = getElement(children[i]);
+				const GuiElement* child = getElement(children[i]);
 				if (!child) continue;
-				child->setWidth(child->clampToMinMaxWidth(getWidth() - 2 * static_cast<int>(horizontalBorder)));
-				child->setPositionX(computeChildPositionX(child->getWidth(), alignmentsHorizontal[i]));
+				childLayouts[i].size.x = child->clampToMinMaxWidth(getWidth() - 2 * static_cast<int>(horizontalBorder));
+				childLayouts[i].position.x = computeChildPositionX(childLayouts[i].size.x, alignmentsHorizontal[i]);
 			}
 			break;
 		}
@@ -222,7 +221,7 @@ namespace SnackerEngine
 			// Determine largest preferredWidth
 			int largestPreferredWidth = -1;
 			for (auto childID : children) {
-				GuiElement* child = getElement(childID);
+				const GuiElement* child = getElement(childID);
 				if (child) {
 					int preferredWidth = child->getPreferredWidth();
 					if (preferredWidth == SIZE_HINT_AS_LARGE_AS_POSSIBLE) {
@@ -235,14 +234,28 @@ namespace SnackerEngine
 			largestPreferredWidth = std::min(largestPreferredWidth, getWidth() - 2 * static_cast<int>(horizontalBorder));
 			if (largestPreferredWidth == SIZE_HINT_ARBITRARY) largestPreferredWidth = getWidth() - 2 * static_cast<int>(horizontalBorder);
 			for (unsigned i = 0; i < children.size(); ++i) {
-				GuiElement* child = getElement(children[i]);
+				const GuiElement* child = getElement(children[i]);
 				if (!child) continue;
-				child->setWidth(child->clampToMinMaxWidth(largestPreferredWidth));
-				child->setPositionX(computeChildPositionX(child->getWidth(), alignmentsHorizontal[i]));
+				childLayouts[i].size.x = child->clampToMinMaxWidth(largestPreferredWidth);
+				childLayouts[i].position.x = computeChildPositionX(childLayouts[i].size.x, alignmentsHorizontal[i]);
 			}
 			break;
 		}
 		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVerticalLayout::enforceLayout()
+	{
+		/// Set x position and width of children
+		std::vector<ChildLayout> childLayouts;
+		getCurrentChildLayouts(childLayouts);
+		computeChildLayoutsX(childLayouts);
+		for (const auto& childLayout : childLayouts) {
+			GuiElement* child = getElement(childLayout.childID);
+			if (!child) continue;
+			child->setWidth(childLayout.size.x);
+			child->setPositionX(childLayout.position.x);
+		}
 		computeWidthHintsFromChildren();
 	}
 	//--------------------------------------------------------------------------------------------------
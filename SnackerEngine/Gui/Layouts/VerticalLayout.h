@@ -32,8 +32,12 @@ namespace SnackerEngine
 		int computeChildPositionX(int childWidth, AlignmentHorizontal alignmentHorizontal) const;
 		/// Helper function that gets called when a child is registered
 		void onRegisterChild(AlignmentHorizontal alignmentHorizontal);
+	protected:
 		/// Computes the minWidth, preferredWidth and maxWidth of this layout from the size hints of its children
 		void computeWidthHintsFromChildren();
+		/// Computes the x position and width of all children and stores them in childLayouts, which
+		/// has one entry per child. The y position and height are left unchanged
+		void computeChildLayoutsX(std::vector<ChildLayout>& childLayouts) const;
 	public:
 		/// name of this GuiElementType for JSON parsing
 		static constexpr std::string_view typeName = "GUI_VERTICAL_LAYOUT";
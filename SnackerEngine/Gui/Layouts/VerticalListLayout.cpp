@@ -309,69 +309,102 @@ namespace SnackerEngine
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
-	void GuiVerticalListLayout::enforceLayout()
+	std::vector<int> GuiVerticalListLayout::computeChildHeightsFromHints() const
 	{
-		GuiVerticalLayout::enforceLayout();
-		std::vector<int> heights;
-		if (groupID != -1 && groupExists(groupID)) {
-			GuiGroup* groupPointer = getGroup(groupID);
-			if (groupPointer != nullptr) {
-				VerticalLayoutGroup* verticalLayoutGroupPointer = static_cast<VerticalLayoutGroup*>(groupPointer);
-				verticalLayoutGroupPointer->recomputeHeights();
-				heights = verticalLayoutGroupPointer->getHeights();
-			}
-		}
 		const auto& childIDs = getChildren();
-		if (childIDs.empty()) return;
-		if (heights.empty()) {
-			std::vector<int> minHeights;
-			std::vector<int> preferredHeights;
-			std::vector<int> maxHeights;
-			for (auto childId : childIDs) {
-				GuiElement* child = getElement(childId);
-				if (child) {
-					minHeights.push_back(child->getMinHeight());
-					if (child->getPreferredHeight() < 0) preferredHeights.push_back(child->getPreferredHeight());
-					else preferredHeights.push_back(child->clampToMinMaxHeight(child->getPreferredHeight()));
-					maxHeights.push_back(child->getMaxHeight());
-				}
-				else {
-					minHeights.push_back(0);
-					preferredHeights.push_back(SIZE_HINT_ARBITRARY);
-					maxHeights.push_back(SIZE_HINT_ARBITRARY);
-				}
+		std::vector<int> minHeights;
+		std::vector<int> preferredHeights;
+		std::vector<int> maxHeights;
+		for (auto childId : childIDs) {
+			const GuiElement* child = getElement(childId);
+			if (child) {
+				minHeights.push_back(child->getMinHeight());
+				if (child->getPreferredHeight() < 0) preferredHeights.push_back(child->getPreferredHeight());
+				else preferredHeights.push_back(child->clampToMinMaxHeight(child->getPreferredHeight()));
+				maxHeights.push_back(child->getMaxHeight());
+			}
+			else {
+				minHeights.push_back(0);
+				preferredHeights.push_back(SIZE_HINT_ARBITRARY);
+				maxHeights.push_back(SIZE_HINT_ARBITRARY);
 			}
-			heights = computeChildHeights(minHeights, preferredHeights, maxHeights, getHeight() - static_cast<int>(verticalBorder * (getChildren().size() - 1)) - static_cast<int>(outerVerticalBorder * 2));
 		}
-		// Now we can actually position and resize the elements
+		return computeChildHeights(minHeights, preferredHeights, maxHeights, getHeight() - static_cast<int>(verticalBorder * (childIDs.size() - 1)) - static_cast<int>(outerVerticalBorder * 2));
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVerticalListLayout::computeChildLayoutsY(const std::vector<int>& heights, std::vector<ChildLayout>& childLayouts) const
+	{
 		if (alignmentVertical == AlignmentVertical::TOP || alignmentVertical == AlignmentVertical::CENTER) {
 			int position = outerVerticalBorder;
 			if (alignmentVertical == AlignmentVertical::CENTER) {
-				int totalHeight = verticalBorder * (static_cast<int>(childIDs.size()) - 1);
+				int totalHeight = verticalBorder * (static_cast<int>(childLayouts.size()) - 1);
 				for (auto height : heights) totalHeight += height;
 				position = (getHeight() - totalHeight) / 2;
 			}
-			for (unsigned i = 0; i < childIDs.size(); ++i) {
-				GuiElement* child = getElement(childIDs[i]);
-				if (child) {
-					child->setPositionY(position);
-					child->setHeight(heights[i]);
-				}
+			for (unsigned i = 0; i < childLayouts.size(); ++i) {
+				childLayouts[i].position.y = position;
+				childLayouts[i].size.y = heights[i];
 				position += heights[i] + verticalBorder;
 			}
 		}
 		else {
 			int position = getHeight() - verticalBorder;
-			for (int i = static_cast<int>(childIDs.size()) - 1; i >= 0; --i) {
-				GuiElement* child = getElement(childIDs[i]);
+			for (int i = static_cast<int>(childLayouts.size()) - 1; i >= 0; --i) {
 				position -= heights[i];
-				if (child) {
-					child->setPositionY(position);
-					child->setHeight(heights[i]);
-				}
+				childLayouts[i].position.y = position;
+				childLayouts[i].size.y = heights[i];
 				position -= verticalBorder;
 			}
 		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool GuiVerticalListLayout::computeLayout(std::vector<ChildLayout>& childLayouts) const
+	{
+		// The heights of layouts in a group depend on all other layouts in the group
+		if (groupID != -1) return false;
+		getCurrentChildLayouts(childLayouts);
+		computeChildLayoutsX(childLayouts);
+		// The height hints of a child can depend on its width (eg. for text boxes). If a width changes,
+		// enforceLayout() has to apply the widths before the heights are computed from the hints
+		for (const auto& childLayout : childLayouts) {
+			const GuiElement* child = getElement(childLayout.childID);
+			if (child && child->getWidth() != childLayout.size.x) return false;
+		}
+		if (!childLayouts.empty()) computeChildLayoutsY(computeChildHeightsFromHints(), childLayouts);
+		return true;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVerticalListLayout::enforceLayout()
+	{
+		std::vector<ChildLayout> childLayouts;
+		if (getLayout(childLayouts)) {
+			applyLayout(childLayouts);
+			computeWidthHintsFromChildren();
+			// Compute new minHeight
+			if (!childLayouts.empty()) computeHeightHintsFromChildren();
+			return;
+		}
+		GuiVerticalLayout::enforceLayout();
+		std::vector<int> heights;
+		if (groupID != -1 && groupExists(groupID)) {
+			GuiGroup* groupPointer = getGroup(groupID);
+			if (groupPointer != nullptr) {
+				VerticalLayoutGroup* verticalLayoutGroupPointer = static_cast<VerticalLayoutGroup*>(groupPointer);
+				verticalLayoutGroupPointer->recomputeHeights();
+				heights = verticalLayoutGroupPointer->getHeights();
+			}
+		}
+		if (getChildren().empty()) return;
+		if (heights.empty()) heights = computeChildHeightsFromHints();
+		// Now we can actually position and resize the elements
+		getCurrentChildLayouts(childLayouts);
+		computeChildLayoutsY(heights, childLayouts);
+		for (const auto& childLayout : childLayouts) {
+			GuiElement* child = getElement(childLayout.childID);
+			if (!child) continue;
+			child->setPositionY(childLayout.position.y);
+			child->setHeight(childLayout.size.y);
+		}
 		// Compute new minHeight
 		computeHeightHintsFromChildren();
 	}
@@ -55,6 +55,11 @@ namespace SnackerEngine
 		bool shrinkHeightToChildren = false;
 		/// Helper function for enforcing the layout
 		static std::vector<int> computeChildHeights(const std::vector<int>& minHeights, const std::vector<int>& preferredHeights, const std::vector<int>& maxHeights, int height);
+		/// Computes the heights of all children from their size hints
+		std::vector<int> computeChildHeightsFromHints() const;
+		/// Computes the y position of all children from the given heights and stores them together
+		/// with the heights in childLayouts
+		void computeChildLayoutsY(const std::vector<int>& heights, std::vector<ChildLayout>& childLayouts) const;
 	protected:
 		/// Helper function that computes the minWidth of the layout from its childElements.
 		void computeHeightHintsFromChildren();
@@ -106,6 +111,9 @@ namespace SnackerEngine
 		/// layout rules, if there are any. May recursively call setLayout() on the
 		/// children as well
 		virtual void enforceLayout() override;
+		/// Computes the positions and sizes of all children. Not supported for layouts in a group, or
+		/// if the width of a child changes, since its height hints may depend on its width
+		virtual bool computeLayout(std::vector<ChildLayout>& childLayouts) const override;
 
 		//==============================================================================================
 		// Groups
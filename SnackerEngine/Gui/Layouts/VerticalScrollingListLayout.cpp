@@ -241,6 +241,7 @@ namespace SnackerEngine
 			computeScrollbarModelMatrices();
 			computeFirstAndLastVisibleElements();
 		}
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiVerticalScrollingListLayout::computeScrollbarModelMatrices()
@@ -250,6 +251,7 @@ namespace SnackerEngine
 		float scrollbarBackgroundHeight = std::max(0.0f, static_cast<float>(getHeight() - static_cast<int>(scrollbarBorderTop) - static_cast<int>(scrollbarBorderBottom)));
 		modelMatrixScrollbarBackground = Mat4f::TranslateAndScale(Vec2f(scrollbarPositionX, scrollbarBackgroundPositionY), Vec2f(static_cast<float>(scrollbarWidth), scrollbarBackgroundHeight));
 		modelMatrixScrollbar = Mat4f::TranslateAndScale(Vec2f(scrollbarPositionX, scrollbarBackgroundPositionY + (1.0f - offsetPercentage) * scrollbarBackgroundHeight - visiblePercentage * scrollbarBackgroundHeight), Vec2f(static_cast<float>(scrollbarWidth), visiblePercentage * scrollbarBackgroundHeight));
+		invalidateDraw();
 	}
 	//--------------------------------------------------------------------------------------------------
 	void GuiVerticalScrollingListLayout::computeFirstAndLastVisibleElements()
@@ -293,6 +295,7 @@ namespace SnackerEngine
 		if (drawScrollBar) {
 			const Shader& scrollbarShader = getPanelShader();
 			Mat4f translationMatrix = Mat4f::Translate(Vec3f(static_cast<float>(worldPosition.x), static_cast<float>(-worldPosition.y), 0.0f));
+			guiManager->flushQuadBatch();
 			scrollbarShader.bind();
 			guiManager->setUniformViewAndProjectionMatrices(scrollbarShader);
 			scrollbarShader.setUniform<Mat4f>("u_model", translationMatrix * modelMatrixScrollbarBackground);
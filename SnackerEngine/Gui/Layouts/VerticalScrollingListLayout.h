@@ -83,8 +83,8 @@ namespace SnackerEngine
 		/// Setters
 		void setScrollSpeed(float scrollSpeed) { this->scrollSpeed = scrollSpeed; };
 		void setTotalOffsetPercentage(float totalOffsetPercentage);
-		void setScrollbarBackgroundColor(const Color4f& scrollbarBackgroundColor) { this->scrollbarBackgroundColor = scrollbarBackgroundColor; }
-		void setScrollbarColor(const Color4f& scrollbarColor) { this->scrollbarColor = scrollbarColor; }
+		void setScrollbarBackgroundColor(const Color4f& scrollbarBackgroundColor) { this->scrollbarBackgroundColor = scrollbarBackgroundColor; invalidateDraw(); }
+		void setScrollbarColor(const Color4f& scrollbarColor) { this->scrollbarColor = scrollbarColor; invalidateDraw(); }
 		void setScrollbarBorderRight(unsigned scrollbarBorderRight);
 		void setScrollbarBorderTop(unsigned scrollbarBorderTop);
 		void setScrollbarBorderBottom(unsigned scrollbarBorderBottom);
@@ -118,6 +118,8 @@ namespace SnackerEngine
 		/// layout rules, if there are any. May recursively call setLayout() on the
 		/// children as well
 		virtual void enforceLayout() override;
+		/// The scrolling list positions its children in enforceLayout() only
+		virtual bool computeLayout(std::vector<ChildLayout>& childLayouts) const override { return false; }
 		/// Returns the mouse offset of a child element from this element. Can be
 		/// overwritten if the children are displayed at a different place than they
 		/// are (eg. in a scrolling list etc)
@@ -0,0 +1,245 @@
+#include "Gui/Layouts/VirtualListLayout.h"
+#include "Gui/GuiManager.h"
+
+#include <algorithm>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	int GuiVirtualListLayout::defaultItemHeight = 30;
+	float GuiVirtualListLayout::defaultScrollSpeed = 50.0f;
+	//--------------------------------------------------------------------------------------------------
+	int GuiVirtualListLayout::getMaxScrollOffset() const
+	{
+		return std::max(0, itemHeights.total() - getHeight());
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::updateRows()
+	{
+		GuiManager* const& guiManager = getGuiManager();
+		if (!guiManager) return;
+		scrollOffset = std::clamp(scrollOffset, 0, getMaxScrollOffset());
+		// Find the visible items
+		const std::size_t itemCount = itemHeights.size();
+		if (itemCount == 0 || getHeight() <= 0) {
+			firstVisibleItem = 0;
+			visibleItemCount = 0;
+		}
+		else {
+			firstVisibleItem = std::min(itemHeights.find(scrollOffset), itemCount - 1);
+			const std::size_t lastVisibleItem = std::min(itemHeights.find(scrollOffset + getHeight() - 1), itemCount - 1);
+			visibleItemCount = lastVisibleItem - firstVisibleItem + 1;
+		}
+		// Create new rows if necessary. Since the row of an item depends on the number of rows,
+		// all items have to be bound again afterwards
+		if (rows.size() < visibleItemCount && createRow) {
+			while (rows.size() < visibleItemCount) {
+				std::unique_ptr<GuiElement> row = createRow();
+				if (!row || !registerChild(*row)) break;
+				rows.push_back(row->getGuiID());
+				guiManager->moveElementPtr(std::move(row));
+			}
+			rowItems.assign(rows.size(), noItem);
+		}
+		visibleItemCount = std::min(visibleItemCount, rows.size());
+		// Bind the visible items and position their rows
+		for (std::size_t row = 0; row < rows.size(); ++row) {
+			// The visible item shown by this row, if there is one
+			const std::size_t item = firstVisibleItem + (row + rows.size() - firstVisibleItem % rows.size()) % rows.size();
+			if (item >= firstVisibleItem + visibleItemCount) {
+				rowItems[row] = noItem;
+				hideRow(row);
+				continue;
+			}
+			GuiElement* rowElement = getElement(rows[row]);
+			if (!rowElement) continue;
+			if (rowItems[row] != item) {
+				rowItems[row] = item;
+				if (bindRow) bindRow(*rowElement, item);
+			}
+			setPositionAndSizeOfChild(rows[row], Vec2i(0, itemHeights.prefixSum(item) - scrollOffset), Vec2i(getWidth(), itemHeights[item]));
+		}
+		invalidateDraw();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::hideRow(std::size_t row)
+	{
+		const GuiElement* rowElement = getElement(rows[row]);
+		if (rowElement) setPositionOfChild(rows[row], Vec2i(0, -rowElement->getHeight() - 1));
+	}
+	//--------------------------------------------------------------------------------------------------
+	GuiVirtualListLayout::GuiVirtualListLayout(CreateRowFunction createRow, BindRowFunction bindRow, std::size_t itemCount, int itemHeight)
+		: GuiLayout(), createRow(createRow), bindRow(bindRow), itemHeight(std::max(0, itemHeight)), itemHeights(std::vector<int>(itemCount, this->itemHeight)) {}
+	//--------------------------------------------------------------------------------------------------
+	GuiVirtualListLayout::GuiVirtualListLayout(const nlohmann::json& json, const nlohmann::json* data, std::set<std::string>* parameterNames)
+		: GuiLayout(json, data, parameterNames)
+	{
+		parseJsonOrReadFromData(itemHeight, "itemHeight", json, data, parameterNames);
+		itemHeight = std::max(0, itemHeight);
+		parseJsonOrReadFromData(scrollSpeed, "scrollSpeed", json, data, parameterNames);
+		std::size_t itemCount = 0;
+		parseJsonOrReadFromData(itemCount, "itemCount", json, data, parameterNames);
+		itemHeights.assign(std::vector<int>(itemCount, itemHeight));
+	}
+	//--------------------------------------------------------------------------------------------------
+	GuiVirtualListLayout::GuiVirtualListLayout(const GuiVirtualListLayout& other)
+		: GuiLayout(other), createRow(other.createRow), bindRow(other.bindRow), itemHeight(other.itemHeight),
+		itemHeights(other.itemHeights), rows{}, rowItems{}, firstVisibleItem(0), visibleItemCount(0),
+		scrollOffset(other.scrollOffset), scrollSpeed(other.scrollSpeed) {}
+	//--------------------------------------------------------------------------------------------------
+	GuiVirtualListLayout& GuiVirtualListLayout::operator=(const GuiVirtualListLayout& other)
+	{
+		GuiLayout::operator=(other);
+		createRow = other.createRow;
+		bindRow = other.bindRow;
+		itemHeight = other.itemHeight;
+		itemHeights = other.itemHeights;
+		rows.clear();
+		rowItems.clear();
+		firstVisibleItem = 0;
+		visibleItemCount = 0;
+		scrollOffset = other.scrollOffset;
+		scrollSpeed = other.scrollSpeed;
+		return *this;
+	}
+	//--------------------------------------------------------------------------------------------------
+	std::size_t GuiVirtualListLayout::getItemIndex(const Vec2i& offset) const
+	{
+		if (offset.y < 0 || offset.y >= getHeight()) return noItem;
+		const std::size_t itemIndex = itemHeights.find(scrollOffset + offset.y);
+		return itemIndex < itemHeights.size() ? itemIndex : noItem;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::setCreateRowFunction(CreateRowFunction createRow)
+	{
+		this->createRow = createRow;
+		registerEnforceLayoutDown();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::setBindRowFunction(BindRowFunction bindRow)
+	{
+		this->bindRow = bindRow;
+		refreshItems();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::setItemCount(std::size_t itemCount)
+	{
+		if (itemCount == itemHeights.size()) return;
+		if (itemCount < itemHeights.size()) {
+			itemHeights.truncate(itemCount);
+		}
+		else if (itemCount - itemHeights.size() > itemHeights.size()) {
+			// Building the tree again is faster than appending many items one by one
+			std::vector<int> heights(itemCount, itemHeight);
+			for (std::size_t i = 0; i < itemHeights.size(); ++i) heights[i] = itemHeights[i];
+			itemHeights.assign(heights);
+		}
+		else {
+			while (itemHeights.size() < itemCount) itemHeights.push_back(itemHeight);
+		}
+		updateRows();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::setItemHeight(std::size_t itemIndex, int height)
+	{
+		if (itemIndex >= itemHeights.size() || itemHeights[itemIndex] == height) return;
+		itemHeights.set(itemIndex, std::max(0, height));
+		updateRows();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::setItemHeight(int itemHeight)
+	{
+		this->itemHeight = std::max(0, itemHeight);
+		itemHeights.assign(std::vector<int>(itemHeights.size(), this->itemHeight));
+		updateRows();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::setScrollOffset(int scrollOffset)
+	{
+		scrollOffset = std::clamp(scrollOffset, 0, getMaxScrollOffset());
+		if (this->scrollOffset == scrollOffset) return;
+		this->scrollOffset = scrollOffset;
+		updateRows();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::scrollToItem(std::size_t itemIndex)
+	{
+		if (itemIndex >= itemHeights.size()) return;
+		setScrollOffset(itemHeights.prefixSum(itemIndex));
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::refreshItem(std::size_t itemIndex)
+	{
+		if (rows.empty() || !bindRow) return;
+		const std::size_t row = itemIndex % rows.size();
+		if (rowItems[row] != itemIndex) return;
+		GuiElement* rowElement = getElement(rows[row]);
+		if (rowElement) bindRow(*rowElement, itemIndex);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::refreshItems()
+	{
+		if (!bindRow) return;
+		for (std::size_t row = 0; row < rows.size(); ++row) {
+			if (rowItems[row] == noItem) continue;
+			GuiElement* rowElement = getElement(rows[row]);
+			if (rowElement) bindRow(*rowElement, rowItems[row]);
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::draw(const Vec2i& worldPosition)
+	{
+		if (!getGuiManager()) return;
+		drawBackground(worldPosition);
+		if (getClipChildren()) pushClippingBox(worldPosition);
+		// Only rows that show an item are drawn
+		for (std::size_t row = 0; row < rows.size(); ++row) {
+			if (rowItems[row] == noItem) continue;
+			GuiElement* rowElement = getElement(rows[row]);
+			if (rowElement) drawElement(rows[row], worldPosition + rowElement->getPosition());
+		}
+		if (getClipChildren()) popClippingBox();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::onRegister()
+	{
+		GuiLayout::onRegister();
+		signUpEvent(CallbackType::MOUSE_SCROLL_ON_ELEMENT);
+	}
+	//--------------------------------------------------------------------------------------------------
+	std::optional<unsigned> GuiVirtualListLayout::removeChild(GuiID guiElement)
+	{
+		std::optional<unsigned> index = GuiLayout::removeChild(guiElement);
+		auto it = std::find(rows.begin(), rows.end(), guiElement);
+		if (it != rows.end()) {
+			rows.erase(it);
+			// The row of an item depends on the number of rows
+			rowItems.assign(rows.size(), noItem);
+		}
+		return index;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::enforceLayout()
+	{
+		updateRows();
+	}
+	//--------------------------------------------------------------------------------------------------
+	GuiID GuiVirtualListLayout::getCollidingChild(const Vec2i& offset) const
+	{
+		if (rows.empty()) return 0;
+		const std::size_t itemIndex = getItemIndex(offset);
+		if (itemIndex == noItem) return 0;
+		const std::size_t row = itemIndex % rows.size();
+		if (rowItems[row] != itemIndex) return 0;
+		const GuiElement* rowElement = getElement(rows[row]);
+		if (!rowElement) return 0;
+		GuiID collision = GuiElement::getCollidingChild(rowElement->isColliding(offset - rowElement->getPosition()), rows[row], offset);
+		return collision > 0 ? collision : 0;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void GuiVirtualListLayout::callbackMouseScrollOnElement(const Vec2d& offset)
+	{
+		setScrollOffset(scrollOffset - static_cast<int>(offset.y * static_cast<double>(scrollSpeed)));
+	}
+	//--------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Gui/GuiLayout.h"
+#include "Utility/PrefixSumTree.h"
+
+#include <functional>
+#include <memory>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// Scrollable vertical list for very large data sets (eg. asset browsers, network peers, logs).
+	/// Instead of one child element per item, the list is bound to an item count and two callbacks:
+	/// one that creates a row element, and one that shows an item in a row. Only the items in the
+	/// visible window are bound to rows, and rows are recycled when items scroll in and out of view,
+	/// so the number of GuiElements only depends on the height of the list. The item heights are
+	/// stored in a PrefixSumTree, so finding the items at a scroll offset is O(log n).
+	/// Children are created by the list itself and should not be registered from outside
+	class GuiVirtualListLayout : public GuiLayout
+	{
+	public:
+		/// Static default Attributes
+		static int defaultItemHeight;
+		static float defaultScrollSpeed;
+		/// Function that creates a new row element
+		using CreateRowFunction = std::function<std::unique_ptr<GuiElement>()>;
+		/// Function that shows the item with the given index in the given row element
+		using BindRowFunction = std::function<void(GuiElement& row, std::size_t itemIndex)>;
+		/// Index that is used for rows that do not show an item
+		static constexpr std::size_t noItem = static_cast<std::size_t>(-1);
+	private:
+		/// The callbacks for creating rows and binding items to rows
+		CreateRowFunction createRow{};
+		BindRowFunction bindRow{};
+		/// The height of new items in pixels
+		int itemHeight = defaultItemHeight;
+		/// The heights of all items in pixels. The size of the tree is the item count
+		PrefixSumTree<int> itemHeights{};
+		/// The GuiIDs of the row elements. The item with index i is shown by the row with index
+		/// i % rows.size(), such that the visible items never share a row
+		std::vector<GuiID> rows{};
+		/// The index of the item each row shows, or noItem
+		std::vector<std::size_t> rowItems{};
+		/// The visible items are [firstVisibleItem, firstVisibleItem + visibleItemCount)
+		std::size_t firstVisibleItem = 0;
+		std::size_t visibleItemCount = 0;
+		/// Distance (in pixels) that the list is scrolled down
+		int scrollOffset = 0;
+		/// Speed when scrolling, in pixels
+		float scrollSpeed = defaultScrollSpeed;
+		/// Returns the maximum scroll offset in pixels
+		int getMaxScrollOffset() const;
+		/// Computes the visible items, binds them to rows and positions the rows. New rows are
+		/// created if there are not enough
+		void updateRows();
+		/// Moves the row with the given index above the list, such that it is neither drawn nor hit
+		void hideRow(std::size_t row);
+	public:
+		/// name of this GuiElementType for JSON parsing
+		static constexpr std::string_view typeName = "GUI_VIRTUAL_LIST_LAYOUT";
+		virtual std::string_view getTypeName() const override { return typeName; }
+		/// Default constructor
+		GuiVirtualListLayout(CreateRowFunction createRow = {}, BindRowFunction bindRow = {}, std::size_t itemCount = 0, int itemHeight = defaultItemHeight);
+		/// Constructor from JSON. The callbacks have to be set afterwards
+		GuiVirtualListLayout(const nlohmann::json& json, const nlohmann::json* data, std::set<std::string>* parameterNames);
+		/// Destructor
+		virtual ~GuiVirtualListLayout() {}
+		/// Copy constructor and assignment operator. The copy creates its own rows when it is registered
+		GuiVirtualListLayout(const GuiVirtualListLayout& other);
+		GuiVirtualListLayout& operator=(const GuiVirtualListLayout& other);
+		/// Move constructor and assignment operator
+		GuiVirtualListLayout(GuiVirtualListLayout&& other) noexcept = default;
+		GuiVirtualListLayout& operator=(GuiVirtualListLayout&& other) noexcept = default;
+		/// Getters
+		std::size_t getItemCount() const { return itemHeights.size(); }
+		int getItemHeight() const { return itemHeight; }
+		int getItemHeight(std::size_t itemIndex) const { return itemHeights[itemIndex]; }
+		int getScrollOffset() const { return scrollOffset; }
+		float getScrollSpeed() const { return scrollSpeed; }
+		std::size_t getFirstVisibleItem() const { return firstVisibleItem; }
+		std::size_t getVisibleItemCount() const { return visibleItemCount; }
+		/// Returns the number of row elements
+		std::size_t getRowCount() const { return rows.size(); }
+		/// Returns the index of the item at the given offset from the top left corner of the list,
+		/// or noItem if there is none. Runs in O(log n)
+		std::size_t getItemIndex(const Vec2i& offset) const;
+		/// Setters
+		void setCreateRowFunction(CreateRowFunction createRow);
+		void setBindRowFunction(BindRowFunction bindRow);
+		/// Sets the number of items. New items get the default item height. Rows showing items that
+		/// are still there are not bound again, call refreshItems() if their data changed
+		void setItemCount(std::size_t itemCount);
+		/// Sets the height of a single item in O(log n)
+		void setItemHeight(std::size_t itemIndex, int height);
+		/// Sets the height of all items and the height of new items
+		void setItemHeight(int itemHeight);
+		void setScrollSpeed(float scrollSpeed) { this->scrollSpeed = scrollSpeed; }
+		/// Sets the scroll offset (in pixels), clamped to the valid range
+		void setScrollOffset(int scrollOffset);
+		/// Scrolls such that the given item is at the top of the list
+		void scrollToItem(std::size_t itemIndex);
+		/// Binds the given item to its row again, if it is visible. Call this when the data of the
+		/// item changed
+		void refreshItem(std::size_t itemIndex);
+		/// Binds all visible items to their rows again
+		void refreshItems();
+	protected:
+		/// Draws this GuiElement object relative to its parent element. Will also recursively
+		/// draw all children of this element.
+		/// worldPosition:		position of the upper left corner of the guiElement in world space
+		virtual void draw(const Vec2i& worldPosition) override;
+		/// This function is called by the guiManager after registering this GuiElement object.
+		/// When this function is called, the guiManager pointer was already set.
+		/// This function can e.g. be used for registering callbacks at the guiManager
+		virtual void onRegister() override;
+		/// Removes the given child from this GuiElement object
+		virtual std::optional<unsigned> removeChild(GuiID guiElement) override;
+		/// Sets the position and size of the children of this element according to
+		/// layout rules, if there are any. May register children and/or parent for
+		/// enforcing layouts as well
+		virtual void enforceLayout() override;
+		/// Returns the first colliding child which collides with the given offset vector. Only the
+		/// row of the item at the offset is tested
+		virtual GuiID getCollidingChild(const Vec2i& offset) const override;
+
+		//==============================================================================================
+		// Events
+		//==============================================================================================
+
+		/// Callback function for scrolling the mouse wheel. Parameter the same as in Scene.h
+		virtual void callbackMouseScrollOnElement(const Vec2d& offset) override;
+	};
+	//--------------------------------------------------------------------------------------------------
+}
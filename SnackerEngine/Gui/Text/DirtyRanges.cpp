@@ -0,0 +1,44 @@
+#include "Gui/Text/DirtyRanges.h"
+
+#include <algorithm>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	void DirtyRangeList::add(const unsigned int& begin, const unsigned int& end)
+	{
+		if (begin >= end) return;
+		// Find the first range that ends at or after begin. All ranges before it stay untouched
+		auto first = std::lower_bound(ranges.begin(), ranges.end(), begin,
+			[](const DirtyRange& range, const unsigned int& index) { return range.end < index; });
+		// Find the first range that starts after end. All ranges in [first, last) are merged
+		auto last = first;
+		DirtyRange merged{ begin, end };
+		while (last != ranges.end() && last->begin <= end) {
+			merged.begin = std::min(merged.begin, last->begin);
+			merged.end = std::max(merged.end, last->end);
+			++last;
+		}
+		if (first == last) {
+			ranges.insert(first, merged);
+		}
+		else {
+			*first = merged;
+			ranges.erase(first + 1, last);
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	unsigned int DirtyRangeList::getDirtyCount() const
+	{
+		unsigned int result = 0;
+		for (const auto& range : ranges) result += range.size();
+		return result;
+	}
+	//--------------------------------------------------------------------------------------------------
+	DirtyRange DirtyRangeList::getBoundingRange() const
+	{
+		if (ranges.empty()) return DirtyRange{ 0, 0 };
+		return DirtyRange{ ranges.front().begin, ranges.back().end };
+	}
+	//--------------------------------------------------------------------------------------------------
+}
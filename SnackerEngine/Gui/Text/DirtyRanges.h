@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// A half open range [begin, end) of indices (e.g. lines or vertices) that changed
+	struct DirtyRange
+	{
+		unsigned int begin;
+		unsigned int end;
+		/// Returns the number of indices in this range
+		unsigned int size() const { return end - begin; }
+		bool operator==(const DirtyRange& other) const = default;
+	};
+	//--------------------------------------------------------------------------------------------------
+	/// Collection of dirty ranges. The ranges are kept sorted, overlapping and adjacent ranges are
+	/// merged. Does not depend on OpenGL, which makes it possible to check which parts of e.g. a
+	/// vertex buffer would be updated without a GL context.
+	class DirtyRangeList
+	{
+		/// The sorted and disjoint ranges
+		std::vector<DirtyRange> ranges{};
+	public:
+		/// Marks all indices in [begin, end) as dirty. Empty ranges are ignored
+		void add(const unsigned int& begin, const unsigned int& end);
+		/// Removes all ranges
+		void clear() { ranges.clear(); }
+		/// Returns true if no index is dirty
+		bool empty() const { return ranges.empty(); }
+		/// Returns the sorted and disjoint dirty ranges
+		const std::vector<DirtyRange>& getRanges() const { return ranges; }
+		/// Returns the number of dirty indices
+		unsigned int getDirtyCount() const;
+		/// Returns the smallest range containing all dirty ranges. Returns an empty range if nothing is dirty
+		DirtyRange getBoundingRange() const;
+	};
+	//--------------------------------------------------------------------------------------------------
+}
@@ -105,19 +105,7 @@ namespace SnackerEngine
 	//------------------------------------------------------------------------------------------------------
 	double Font::getAdvance(Unicode first, Unicode second) const
 	{
-		if (!FontManager::isValidGlyph(*this, first)) {
-			first = FontManager::getFontData(*this).missingCharacterReplacement;
-			if (!FontManager::isValidGlyph(*this, first)) return 0.0;
-		}
-		if (!FontManager::isValidGlyph(*this, second)) {
-			second = FontManager::getFontData(*this).missingCharacterReplacement;
-			if (!FontManager::isValidGlyph(*this, second)) return 0.0;
-		}
-		double result;
-		if (FontManager::getFontData(*this).fontGeometry.getAdvance(result, first, second)) {
-			return result;
-		}
-		return FontManager::getFontData(*this).fontGeometry.getGlyph(first)->getAdvance();
+		return FontManager::getAdvance(*this, first, second);
 	}
 	//------------------------------------------------------------------------------------------------------
 	double Font::getPixelRange() const
@@ -155,6 +143,21 @@ namespace SnackerEngine
 		return FontManager::getFontData(*this).msdfTexture;
 	}
 	//------------------------------------------------------------------------------------------------------
+	unsigned int Font::getGlyphVersion() const
+	{
+		return FontManager::getFontData(*this).glyphVersion;
+	}
+	//------------------------------------------------------------------------------------------------------
+	bool Font::hasPendingGlyphs() const
+	{
+		return !FontManager::getFontData(*this).pendingCharacters.empty();
+	}
+	//------------------------------------------------------------------------------------------------------
+	bool Font::isPendingGlyph(const Unicode& codepoint) const
+	{
+		return FontManager::getFontData(*this).pendingCharacters.contains(codepoint);
+	}
+	//------------------------------------------------------------------------------------------------------
 	Font::~Font()
 	{
 		FontManager::decreaseReferenceCount(*this);
@@ -52,6 +52,14 @@ namespace SnackerEngine
 		double getDescender() const;
 		/// Returns the msdf texture
 		Texture getMsdfTexture() const;
+		/// Returns a number that changes every time glyphs that were generated in the background are added to 
+		/// the atlas
+		unsigned int getGlyphVersion() const;
+		/// Returns true if glyphs of this font are currently generated in the background
+		bool hasPendingGlyphs() const;
+		/// Returns true if the glyph with the given codepoint is currently generated in the background. Until
+		/// it is added to the atlas, the missing character glyph is used instead
+		bool isPendingGlyph(const Unicode& codepoint) const;
 		/// Destructor
 		~Font();
 	};
@@ -2,8 +2,10 @@
 
 #include "Graphics\Texture.h"
 #include "AssetManager\FontManager.h"
+#include "Gui\Text\GlyphCache.h"
 
 #include <msdf-atlas-gen.h>
+#include <cstdint>
 
 namespace SnackerEngine
 {
@@ -33,6 +35,10 @@ namespace SnackerEngine
         bool valid{};
         /// File path of the font
         std::string path{};
+        /// Full path of the font atlas cache file. Empty if the font is not cached
+        std::string cachePath{};
+        /// Key of the font atlas cache, computed from the font file and the msdf generation parameters
+        std::uint64_t cacheKey{};
         /// parameters used in msdf generation
         double maxCornerAngle{};
         double glyphScale{};
@@ -46,9 +52,17 @@ namespace SnackerEngine
         std::vector<msdf_atlas::GlyphGeometry> glyphs{};
         /// Font geometry object, used to access specific glyphs
         msdf_atlas::FontGeometry fontGeometry{};
+        /// Cache of glyph metrics and kerning pairs, used for fast text layout
+        GlyphCache glyphCache{};
         /// Set of Unicode symbols that are represented by the "missing" symbol,
         /// ie. symbols that could not be loaded with this font
         std::unordered_set<Unicode> missingCharacters{};
+        /// Set of Unicode symbols that are currently generated by the glyph worker threads
+        std::unordered_set<Unicode> pendingCharacters{};
+        /// Unique index of this font, used to discard glyphs generated for an earlier font with the same FontID
+        std::size_t loadIndex{};
+        /// Is increased every time glyphs generated in the background are added to the atlas
+        unsigned int glyphVersion{};
         /// Destructor. Deletes the texture from the GPU if it was loaded.
         ~FontData();
 
@@ -2,6 +2,9 @@
 
 #include "Math/Vec.h"
 
+#include <algorithm>
+#include <cmath>
+
 /// Forward declaration of msdf_atlas::GlyphGeometry
 namespace msdf_atlas {
 	class GlyphGeometry;
@@ -33,4 +36,31 @@ namespace SnackerEngine
 		bool isWhitespace;
 	};
 	//------------------------------------------------------------------------------------------------------
+	/// Compact per glyph instance used for instanced text rendering (see InstancedTextMesh). Instead of
+	/// four vertices and six indices per character (88 bytes), each visible glyph is stored as a single
+	/// 24 byte instance. The vertex shader moves and scales one shared unit quad to the glyph rectangle
+	struct GlyphInstance
+	{
+		/// Bottom left corner of the glyph rectangle
+		Vec2f position;
+		/// Width and height of the glyph rectangle
+		Vec2f size;
+		/// Rectangle of the glyph in the MSDF texture (left, bottom, right, top) in pixels, stored as
+		/// fixed point numbers with texCoordPrecision steps per pixel. Used as normalized attributes
+		unsigned short texRect[4];
+		/// Number of fixed point steps per pixel. Texture coordinates up to 8191 pixels can be stored
+		static constexpr double texCoordPrecision = 8.0;
+		/// Constructs an instance from the given glyph rectangle and the texture coordinates of the glyph
+		static GlyphInstance create(const double& left, const double& bottom, const double& right, const double& top, const Glyph& glyph)
+		{
+			const auto toFixedPoint = [](const double& texCoord) {
+				return static_cast<unsigned short>(std::clamp(std::round(texCoord * texCoordPrecision), 0.0, 65535.0));
+			};
+			return GlyphInstance{ Vec2f(static_cast<float>(left), static_cast<float>(bottom)),
+				Vec2f(static_cast<float>(right - left), static_cast<float>(top - bottom)),
+				{ toFixedPoint(glyph.texLeft), toFixedPoint(glyph.texBottom), toFixedPoint(glyph.texRight), toFixedPoint(glyph.texTop) } };
+		}
+	};
+	static_assert(sizeof(GlyphInstance) == 24, "GlyphInstance should be tightly packed!");
+	//------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "Gui/Text/GlyphCache.h"
+
+#include <algorithm>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	void GlyphCache::setKerningRange(Entry& entry) const
+	{
+		auto begin = std::lower_bound(kerningPairs.begin(), kerningPairs.end(), entry.glyphIndex,
+			[](const KerningPair& pair, const int& glyphIndex) { return pair.first < glyphIndex; });
+		auto end = std::upper_bound(begin, kerningPairs.end(), entry.glyphIndex,
+			[](const int& glyphIndex, const KerningPair& pair) { return glyphIndex < pair.first; });
+		entry.kerningBegin = static_cast<unsigned int>(begin - kerningPairs.begin());
+		entry.kerningEnd = static_cast<unsigned int>(end - kerningPairs.begin());
+	}
+	//------------------------------------------------------------------------------------------------------
+	const GlyphCache::Entry& GlyphCache::insert(const Unicode& codepoint, const Glyph& glyph, const int& glyphIndex)
+	{
+		Entry* entry = nullptr;
+		if (codepoint < 0x10000) {
+			std::unique_ptr<Page>& page = pages[codepoint / pageSize];
+			if (!page) page = std::make_unique<Page>();
+			entry = &(*page)[codepoint % pageSize];
+		}
+		else {
+			entry = &supplementaryEntries[codepoint];
+		}
+		entry->glyph = glyph;
+		entry->glyphIndex = glyphIndex;
+		entry->cached = true;
+		setKerningRange(*entry);
+		return *entry;
+	}
+	//------------------------------------------------------------------------------------------------------
+	double GlyphCache::getKerning(const Entry& first, const Entry& second) const
+	{
+		// Most glyphs have only a few kerning pairs, so the range is usually tiny
+		auto begin = kerningPairs.begin() + first.kerningBegin;
+		auto end = kerningPairs.begin() + first.kerningEnd;
+		auto it = std::lower_bound(begin, end, second.glyphIndex,
+			[](const KerningPair& pair, const int& glyphIndex) { return pair.second < glyphIndex; });
+		if (it != end && it->second == second.glyphIndex) return it->value;
+		return 0.0;
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GlyphCache::setKerning(const std::map<std::pair<int, int>, double>& kerning)
+	{
+		// std::map is already sorted by (first, second)
+		kerningPairs.clear();
+		kerningPairs.reserve(kerning.size());
+		for (const auto& [pair, value] : kerning) {
+			kerningPairs.push_back({ pair.first, pair.second, value });
+		}
+		// The kerning ranges of all cached glyphs are now invalid
+		clearGlyphs();
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GlyphCache::clearGlyphs()
+	{
+		for (auto& page : pages) page.reset();
+		supplementaryEntries.clear();
+	}
+	//------------------------------------------------------------------------------------------------------
+	void GlyphCache::clear()
+	{
+		clearGlyphs();
+		kerningPairs.clear();
+	}
+	//------------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Gui/Text/Glyph.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <map>
+#include <unordered_map>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	using Unicode = unsigned int;
+	//------------------------------------------------------------------------------------------------------
+	/// Per font cache of glyph metrics and kerning, such that text layout does not have to go through
+	/// the hash maps of msdf_atlas::FontGeometry for every character.
+	/// Glyphs of the basic multilingual plane (BMP) are stored in directly indexed pages of 256 codepoints,
+	/// which are allocated on demand (the first page contains ASCII). All other codepoints are stored in
+	/// a hash map. Kerning pairs are stored in a flat array sorted by glyph index pairs, where each cached
+	/// glyph knows the range of pairs in which it is the first glyph.
+	/// The cache does not load glyphs itself, it is filled and invalidated by the FontManager.
+	class GlyphCache
+	{
+	public:
+		/// A cached glyph
+		struct Entry
+		{
+			/// The glyph metrics
+			Glyph glyph{};
+			/// Index of the glyph in the font file, used for kerning lookups
+			int glyphIndex{ -1 };
+			/// Range [kerningBegin, kerningEnd) of kerning pairs where this glyph is the first glyph
+			unsigned int kerningBegin{};
+			unsigned int kerningEnd{};
+			/// Set to true if this entry stores a glyph
+			bool cached{};
+		};
+	private:
+		/// Number of codepoints in each page
+		static constexpr unsigned int pageSize = 256;
+		/// Number of pages needed to cover the BMP
+		static constexpr unsigned int pageCount = 0x10000 / pageSize;
+		/// A page of directly indexed glyphs
+		using Page = std::array<Entry, pageSize>;
+		/// A kerning pair. The pairs are sorted by (first, second)
+		struct KerningPair
+		{
+			int first;
+			int second;
+			double value;
+		};
+		/// Pages for the BMP, nullptr if no glyph of this page was cached yet
+		std::array<std::unique_ptr<Page>, pageCount> pages{};
+		/// Glyphs outside of the BMP
+		std::unordered_map<Unicode, Entry> supplementaryEntries{};
+		/// Sorted kerning pairs
+		std::vector<KerningPair> kerningPairs{};
+		/// Computes the kerning range of the given entry
+		void setKerningRange(Entry& entry) const;
+	public:
+		/// Default constructor
+		GlyphCache() = default;
+		/// Move constructor and assignment operator
+		GlyphCache(GlyphCache&& other) noexcept = default;
+		GlyphCache& operator=(GlyphCache&& other) noexcept = default;
+		/// Returns the cached entry with the given codepoint, or nullptr if it is not cached
+		const Entry* find(const Unicode& codepoint) const
+		{
+			if (codepoint < 0x10000) {
+				const Page* page = pages[codepoint / pageSize].get();
+				if (!page) return nullptr;
+				const Entry& entry = (*page)[codepoint % pageSize];
+				return entry.cached ? &entry : nullptr;
+			}
+			auto it = supplementaryEntries.find(codepoint);
+			return it == supplementaryEntries.end() ? nullptr : &it->second;
+		}
+		/// Stores the given glyph under the given codepoint and returns the new entry
+		const Entry& insert(const Unicode& codepoint, const Glyph& glyph, const int& glyphIndex);
+		/// Returns the kerning between the two glyphs, which has to be added to the advance of the first glyph
+		double getKerning(const Entry& first, const Entry& second) const;
+		/// Replaces the kerning table. The keys are pairs of glyph indices (see msdf_atlas::FontGeometry::getKerning())
+		void setKerning(const std::map<std::pair<int, int>, double>& kerning);
+		/// Removes all cached glyphs. Should be called whenever the atlas changes
+		void clearGlyphs();
+		/// Removes all cached glyphs and kerning pairs
+		void clear();
+	};
+	//------------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,80 @@
+#include "Gui/Text/InstancedTextMesh.h"
+#include "AssetManager/MeshManager.h"
+#include "Graphics/Renderer.h"
+
+#include <algorithm>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	const Mesh& InstancedTextMesh::getUnitQuad()
+	{
+		if (!unitQuad.isValid()) {
+			// Same order of corners as the vertices of the regular text model
+			std::vector<Vec2f> vertices{ Vec2f(0.0f, 0.0f), Vec2f(0.0f, 1.0f), Vec2f(1.0f, 1.0f), Vec2f(1.0f, 0.0f) };
+			std::vector<unsigned int> indices{ 0, 1, 2, 2, 3, 0 };
+			VertexBufferLayout layout;
+			layout.push<Vec2f>(1);
+			unitQuad = MeshManager::createMesh<Vec2f>(layout, vertices, indices);
+		}
+		return unitQuad;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void InstancedTextMesh::upload()
+	{
+		instanceCount = static_cast<unsigned int>(instances.size());
+		if (instanceCount == 0) return;
+		if (instanceCount > capacity) {
+			// Grow geometrically, such that texts that are edited don't need a new buffer for every character
+			const std::size_t usedInstances = instances.size();
+			capacity = std::max(instanceCount, capacity * 2);
+			instances.resize(capacity);
+			const Mesh& quad = getUnitQuad();
+			instanceBuffer = VertexBuffer(VertexBuffer::VertexBufferStorageType::DYNAMIC);
+			instanceBuffer.setDataAndFinalize(instances);
+			instances.resize(usedInstances);
+			// The vertex buffer of the unit quad has to be bound when the VertexArray object is finalized
+			quad.getVertexBuffer().bind();
+			VertexBufferLayout quadLayout;
+			quadLayout.push<Vec2f>(1);
+			vertexArray = VertexArray(quadLayout, quad.getVertexBuffer());
+			vertexArray.bindInstanceBuffer(instanceBuffer, getInstanceLayout());
+			VertexArray::unbind();
+			return;
+		}
+		instanceBuffer.changeSubData(instances.data(), instanceCount, 0);
+	}
+	//--------------------------------------------------------------------------------------------------
+	VertexBufferLayout InstancedTextMesh::getInstanceLayout()
+	{
+		VertexBufferLayout layout;
+		layout.push<Vec2f>(1);
+		layout.push<Vec2f>(1);
+		layout.push<unsigned short>(4);
+		return layout;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void InstancedTextMesh::update(const DynamicText& text)
+	{
+		text.computeGlyphInstances(instances);
+		upload();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void InstancedTextMesh::setInstances(const std::vector<GlyphInstance>& instances)
+	{
+		this->instances = instances;
+		upload();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void InstancedTextMesh::draw() const
+	{
+		if (instanceCount == 0) return;
+		Renderer::drawInstanced(vertexArray, getUnitQuad().getIndexBuffer(), instanceCount);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void InstancedTextMesh::terminate()
+	{
+		unitQuad = Mesh();
+	}
+	//--------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Gui/Text/Text.h"
+#include "Graphics/Mesh.h"
+
+#include <vector>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// GPU side of instanced text rendering. Stores the glyph instances of a text (see GlyphInstance)
+	/// in an instance buffer and draws all of them with a single instanced draw call of one shared
+	/// unit quad. Has to be drawn with the shader "shaders/gui/instancedText.shader", which takes
+	/// the same uniforms as the regular text shader.
+	/// Compared to the regular text model, whitespace needs no storage and each visible glyph uses
+	/// 24 bytes instead of 88 bytes, which reduces memory usage and upload bandwidth
+	class InstancedTextMesh
+	{
+		/// Unit quad shared by all InstancedTextMesh objects. Created on first use
+		inline static Mesh unitQuad{};
+		/// Returns the unit quad, creates it if necessary
+		static const Mesh& getUnitQuad();
+		/// VertexArray object combining the vertex buffer of the unit quad with the instance buffer
+		VertexArray vertexArray{};
+		/// Buffer storing the glyph instances
+		VertexBuffer instanceBuffer{ VertexBuffer::VertexBufferStorageType::DYNAMIC };
+		/// Number of instances that fit into the instance buffer
+		unsigned int capacity = 0;
+		/// Number of instances that are drawn
+		unsigned int instanceCount = 0;
+		/// The instances that were uploaded last. Kept such that its memory can be reused
+		std::vector<GlyphInstance> instances{};
+		/// Uploads the instances vector, recreates the buffers if they are too small
+		void upload();
+	public:
+		/// Default constructor
+		InstancedTextMesh() = default;
+		/// Move constructor and assignment operator
+		InstancedTextMesh(InstancedTextMesh&& other) noexcept = default;
+		InstancedTextMesh& operator=(InstancedTextMesh&& other) noexcept = default;
+		/// Returns the layout of a single GlyphInstance
+		static VertexBufferLayout getInstanceLayout();
+		/// Computes the glyph instances of the given text and uploads them to the GPU
+		void update(const DynamicText& text);
+		/// Uploads the given glyph instances to the GPU
+		void setInstances(const std::vector<GlyphInstance>& instances);
+		/// Draws all instances. The text shader and material should already be bound
+		void draw() const;
+		/// Returns the number of instances that are drawn
+		unsigned int getInstanceCount() const { return instanceCount; }
+		/// Returns the size of the instance buffer on the GPU in bytes
+		unsigned int getSizeInBytes() const { return capacity * static_cast<unsigned int>(sizeof(GlyphInstance)); }
+		/// Releases the shared unit quad. Has to be called before the MeshManager is terminated
+		static void terminate();
+	};
+	//--------------------------------------------------------------------------------------------------
+}
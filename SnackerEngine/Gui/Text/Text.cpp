@@ -2,8 +2,11 @@
 #include "core/Log.h"
 #include "AssetManager/MeshManager.h"
 #include "Gui/Text/Unicode.h"
+#include "Gui/Text/TextLayoutCache.h"
 
+#include <algorithm>
 #include <optional>
+#include <limits>
 #include <sstream>
 
 namespace SnackerEngine
@@ -40,14 +43,31 @@ namespace SnackerEngine
 		const double& fontSize;
 		/// The line height of the text in pt
 		double lineHeight;
-		/// Vector of characters
-		std::vector<StaticText::Character>& characters;
+		/// Buffer of characters
+		StaticText::CharacterBuffer& characters;
 		/// Vector of lines
 		std::vector<StaticText::Line>& lines;
+		/// Lines of the previous layout, starting at the line with index previousLinesOffset. If this is set,
+		/// parsing stops as soon as a new line starts at the same character as the corresponding previous
+		/// line, since all following lines are then laid out exactly as before (see checkConvergence())
+		const std::vector<StaticText::Line>* previousLines = nullptr;
+		std::size_t previousLinesOffset = 0;
+		/// Only characters before this index were changed. The line breaks can only converge at lines
+		/// that start after this index
+		unsigned int convergenceIndex = std::numeric_limits<unsigned int>::max();
+		/// Is set to false while a word that is too long for a single line is parsed, because its
+		/// characters were already moved and need to be parsed completely
+		bool convergenceAllowed = true;
+		/// Is set to true as soon as the line breaks converged. Parsing stops in this case
+		bool converged = false;
 
 		/// Constructor
-		ParseData(Font& font, const Vec2d& currentBaseline, const Unicode& lastCodepoint, const double& textWidth, const double& fontSize, double lineHeightMultiplier, std::vector<StaticText::Character>& characters, std::vector<StaticText::Line>& lines);
+		ParseData(Font& font, const Vec2d& currentBaseline, const Unicode& lastCodepoint, const double& textWidth, const double& fontSize, double lineHeightMultiplier, StaticText::CharacterBuffer& characters, std::vector<StaticText::Line>& lines);
 
+		/// Decodes the given UTF8 text into a codepoint buffer that is reused between parses (one buffer
+		/// per thread). If the text is not valid UTF8, a warning is printed and only the valid part at
+		/// the beginning of the text is returned
+		static const std::vector<Unicode>& decodeText(const std::string& text);
 		/// Checks if the given x position still is inside the maximum allowed line width
 		bool isInsideTextWidth(const double& x) const;
 		/// Goes to the next line, changing currentBaseline. Does not set lastCodepoint to zero!
@@ -55,6 +75,10 @@ namespace SnackerEngine
 		/// Goes to the next line, changing currentBaseline. Does not set lastCodepoint to zero!
 		/// firstCharacterOnNewlineIndex is the index of the first character of the new line
 		virtual void goToNextLine(const unsigned int& firstCharacterOnNewlineIndex);
+		/// Checks if the line that was just started (at firstCharacterOnNewlineIndex) starts at the same character
+		/// as the corresponding line in previousLines. In this case the line breaks converged, converged is set
+		/// to true and true is returned
+		bool checkConvergence(const unsigned int& firstCharacterOnNewlineIndex);
 		/// Advances currentBaseline by using kerning from lastCodepoint to the given codepoint. 
 		/// Does not update lastCodepoint
 		void advanceBaselineWithKerning(const Unicode& newCodepoint);
@@ -73,10 +97,9 @@ namespace SnackerEngine
 		/// Reads in and pushes glyphs until a whitespace character is found. Also advances the baseline
 		/// accordingly. Does not check if a new line is necessary. This function can be used for parsing whole
 		/// words. After this function is called the baseline is at the beginning of the last glyph. 
-		/// Advances the index into the utf8 string as well.
-		/// If false is returned, an error occured during parsing and an warning message was printed.
+		/// Advances the index into the codepoints vector as well.
 		/// Also adds all glyphs to the back of the dynamicTextCharacters vector
-		bool pushGlyphsUntilWhitespace(unsigned& indexIntoUTF8String, const std::string& text);
+		bool pushGlyphsUntilWhitespace(unsigned& indexIntoCodepoints, const std::vector<Unicode>& codepoints);
 		/// Reads in and pushes glyphs until a whitespace character is found. Also advances the baseline
 		/// accordingly. Does not check if a new line is necessary. This function can be used for parsing whole
 		/// words. After this function is called the baseline is at the beginning of the last glyph. 
@@ -88,7 +111,7 @@ namespace SnackerEngine
 		/// new line if necessary. Does not care about word boundaries.
 		/// If false is returned, an error occured during parsing and an warning message was printed.
 		/// Assumes that the lines vector has at least one entry and is properly set up.
-		bool parseCharacterByCharacter(const unsigned& beginIndexIntoUTF8String, const unsigned& endIndexIntoUTF8String, const std::string& text);
+		bool parseCharacterByCharacter(const unsigned& beginIndexIntoCodepoints, const unsigned& endIndexIntoCodepoints, const std::vector<Unicode>& codepoints);
 		/// Parses the text character by character, starting from beginIndex (inclusive) until 
 		/// endIndex is reached (exclusive). Updates the baseline accordingly and jumps to a 
 		/// new line if necessary. Does not care about word boundaries.
@@ -100,7 +123,7 @@ namespace SnackerEngine
 		/// new line if necessary.
 		/// If false is returned, an error occured during parsing and an warning message was printed.
 		/// Assumes that the lines vector has at least one entry and is properly set up.
-		bool parseWordByWord(const unsigned& beginIndexIntoUTF8String, const unsigned endIndexIntoUTF8String, const std::string& text);
+		bool parseWordByWord(const unsigned& beginIndexIntoCodepoints, const unsigned endIndexIntoCodepoints, const std::vector<Unicode>& codepoints);
 		/// Parses the text word by word, starting from beginIndex (inclusive) until 
 		/// endIndex is reached (exclusive). Updates the baseline accordingly and jumps to a 
 		/// new line if necessary.
@@ -109,15 +132,25 @@ namespace SnackerEngine
 		bool parseWordByWord(const unsigned& beginIndexIntoCharactersVector, const unsigned endIndexIntoCharactersVector);
 		/// Constructs the model from the characters and lines vectors. At this time a last alignment pass
 		/// is made that shifts the text based on the alignment mode. Returns the Model and the right border
-		/// of the text in pt.
-		std::pair<Model, double> alignAndConstructModel(AlignmentHorizontal alignment, std::vector<Vec4f>& vertices, std::vector<unsigned int>& indices);
+		/// of the text in pt. If createModel is set to false, only the right border is computed.
+		std::pair<Model, double> alignAndConstructModel(AlignmentHorizontal alignment, std::vector<Vec4f>& vertices, std::vector<unsigned int>& indices, bool createModel = true);
 	};
 	//--------------------------------------------------------------------------------------------------
-	ParseData::ParseData(Font& font, const Vec2d& currentBaseline, const Unicode& lastCodepoint, const double& textWidth, const double& fontSize, double lineHeightMultiplier, std::vector<StaticText::Character>& characters, std::vector<StaticText::Line>& lines)
+	ParseData::ParseData(Font& font, const Vec2d& currentBaseline, const Unicode& lastCodepoint, const double& textWidth, const double& fontSize, double lineHeightMultiplier, StaticText::CharacterBuffer& characters, std::vector<StaticText::Line>& lines)
 		: font(font), currentBaseline(currentBaseline), lastCodepoint(lastCodepoint), textWidth(textWidth), 
 		fontSize(fontSize), lineHeight( font.getLineHeight() * lineHeightMultiplier ),
 		characters(characters), lines(lines) {}
 	//--------------------------------------------------------------------------------------------------
+	const std::vector<Unicode>& ParseData::decodeText(const std::string& text)
+	{
+		thread_local std::vector<Unicode> codepoints;
+		codepoints.clear();
+		if (decodeUTF8(text, codepoints) != text.size()) {
+			warningLogger << LOGGER::BEGIN << "text was not formatted properly (can only read UTF-8 formatting)" << LOGGER::ENDL;
+		}
+		return codepoints;
+	}
+	//--------------------------------------------------------------------------------------------------
 	bool ParseData::isInsideTextWidth(const double& x) const
 	{
 		return (textWidth == 0.0) || (x * fontSize <= textWidth);
@@ -147,6 +180,19 @@ namespace SnackerEngine
 			firstCharacterOnNewlineIndex });
 	}
 	//--------------------------------------------------------------------------------------------------
+	bool ParseData::checkConvergence(const unsigned int& firstCharacterOnNewlineIndex)
+	{
+		// In single line mode no new lines are created
+		if (!previousLines || !convergenceAllowed || textWidth == 0.0) return false;
+		// The line break has to come after the last changed character
+		if (firstCharacterOnNewlineIndex <= convergenceIndex) return false;
+		const std::size_t lineIndex = lines.size() - 1;
+		if (lineIndex < previousLinesOffset || lineIndex - previousLinesOffset >= previousLines->size()) return false;
+		const StaticText::Line& previousLine = (*previousLines)[lineIndex - previousLinesOffset];
+		converged = previousLine.beginIndex == firstCharacterOnNewlineIndex && previousLine.baselineY == lines.back().baselineY;
+		return converged;
+	}
+	//--------------------------------------------------------------------------------------------------
 	void ParseData::advanceBaselineWithKerning(const Unicode& newCodepoint)
 	{
 		currentBaseline.x += font.getAdvance(lastCodepoint, newCodepoint);
@@ -203,37 +249,33 @@ namespace SnackerEngine
 		}
 	}
 	//--------------------------------------------------------------------------------------------------
-	bool ParseData::pushGlyphsUntilWhitespace(unsigned& indexIntoUTF8String, const std::string& text)
+	bool ParseData::pushGlyphsUntilWhitespace(unsigned& indexIntoCodepoints, const std::vector<Unicode>& codepoints)
 	{
 		// Save the index of the last parsed glyph st. we can return the correct index at the end
 		// (and not the index of the whitespace character coming after the word!)
-		unsigned lastIndexIntoUTF8String = indexIntoUTF8String;
+		unsigned lastIndexIntoCodepoints = indexIntoCodepoints;
 		// Go through the text character by character
-		while (indexIntoUTF8String < text.size())
+		while (indexIntoCodepoints < codepoints.size())
 		{
-			auto codepoint = getNextCodepointUTF8(text, indexIntoUTF8String);
-			if (!codepoint) {
-				warningLogger << LOGGER::BEGIN << "text was not formatted properly (can only read UTF-8 formatting)" << LOGGER::ENDL;
-				return false;
-			}
+			const Unicode codepoint = codepoints[indexIntoCodepoints++];
 			// Check if the parsed character is whitespace, in which case we return
-			if (isWhiteSpace(codepoint.value())) {
-				indexIntoUTF8String = lastIndexIntoUTF8String;
+			if (isWhiteSpace(codepoint)) {
+				indexIntoCodepoints = lastIndexIntoCodepoints;
 				return true;
 			}
 			// We treat every character that is not a whitespace character equal: put it into the current line.
 			// We don't check if we need a new line!
 			if (lastCodepoint != 0) {
 				// Advance to next glyph
-				advanceBaselineWithKerning(codepoint.value());
+				advanceBaselineWithKerning(codepoint);
 			}
-			Glyph glyph = font.getGlyph(codepoint.value());
+			Glyph glyph = font.getGlyph(codepoint);
 			// Add the new glyph
-			pushGlyph(glyph, codepoint.value());
+			pushGlyph(glyph, codepoint);
 			// Update lastCodepoint
-			lastCodepoint = codepoint.value();
+			lastCodepoint = codepoint;
 			// Update the lastIndex
-			lastIndexIntoUTF8String = indexIntoUTF8String;
+			lastIndexIntoCodepoints = indexIntoCodepoints;
 		}
 		return true;
 	}
@@ -265,19 +307,15 @@ namespace SnackerEngine
 		return true;
 	}
 	//--------------------------------------------------------------------------------------------------
-	bool ParseData::parseCharacterByCharacter(const unsigned& beginIndexIntoUTF8String, const unsigned& endIndexIntoUTF8String, const std::string& text)
+	bool ParseData::parseCharacterByCharacter(const unsigned& beginIndexIntoCodepoints, const unsigned& endIndexIntoCodepoints, const std::vector<Unicode>& codepoints)
 	{
 		// Go through the text character by character
-		unsigned indexIntoUTF8String = beginIndexIntoUTF8String;
-		while (indexIntoUTF8String < endIndexIntoUTF8String)
+		unsigned indexIntoCodepoints = beginIndexIntoCodepoints;
+		while (indexIntoCodepoints < endIndexIntoCodepoints)
 		{
-			auto codepoint = getNextCodepointUTF8(text, indexIntoUTF8String);
-			if (!codepoint) {
-				warningLogger << LOGGER::BEGIN << "text was not formatted properly (can only read UTF-8 formatting)" << LOGGER::ENDL;
-				return false;
-			}
+			const Unicode codepoint = codepoints[indexIntoCodepoints++];
 			// First check if the parsed codepoint was a newline character
-			if (isNewline(codepoint.value())) {
+			if (isNewline(codepoint)) {
 				pushNewlineGlyph();
 				goToNextLine();
 				lastCodepoint = 0;
@@ -287,29 +325,29 @@ namespace SnackerEngine
 			// if it doesn't fit put it on the next line!
 			if (lastCodepoint != 0) {
 				// Advance to next glyph
-				advanceBaselineWithKerning(codepoint.value());
+				advanceBaselineWithKerning(codepoint);
 			}
 			// Obtain glyph
-			Glyph glyph = font.getGlyph(codepoint.value());
+			Glyph glyph = font.getGlyph(codepoint);
 			// Check if we need a new line
 			if (!isInsideTextWidth(currentBaseline.x + glyph.right) && !characters.empty() && lastCodepoint != 0) {
 				goToNextLine();
 				// Special rule: If the first character on a new line is a space character, we dont 
 				// want to advance the next character!
-				if (isSpaceCharacter(codepoint.value())) {
+				if (isSpaceCharacter(codepoint)) {
 					lastCodepoint = 0;
 				}
 				else {
 					// Update lastCodepoint
-					lastCodepoint = codepoint.value();
+					lastCodepoint = codepoint;
 				}
 			}
 			else {
 				// Update lastCodepoint
-				lastCodepoint = codepoint.value();
+				lastCodepoint = codepoint;
 			}
 			// Add the new glyph
-			pushGlyph(glyph, codepoint.value());
+			pushGlyph(glyph, codepoint);
 		}
 		// Finalize the lines vector
 		lines.back().endIndex = static_cast<unsigned int>(characters.size()) - 1;
@@ -328,6 +366,7 @@ namespace SnackerEngine
 				editNewlineGlyph(indexIntoCharactersVector);
 				indexIntoCharactersVector++;
 				goToNextLine(indexIntoCharactersVector);
+				if (checkConvergence(indexIntoCharactersVector)) return true;
 				lastCodepoint = 0;
 				continue;
 			}
@@ -342,6 +381,7 @@ namespace SnackerEngine
 			// Check if we need a new line
 			if (!isInsideTextWidth(currentBaseline.x + glyph.right) && !characters.empty() && lastCodepoint != 0) {
 				goToNextLine(indexIntoCharactersVector);
+				if (checkConvergence(indexIntoCharactersVector)) return true;
 				// Special rule: If the first character on a new line is a space character, we dont 
 				// want to advance the next character!
 				if (isSpaceCharacter(character.codepoint)) {
@@ -356,6 +396,12 @@ namespace SnackerEngine
 				// Update lastCodepoint
 				lastCodepoint = character.codepoint;
 			}
+			// Special rule: If we start parsing at a space character at the beginning of a line that was not
+			// started by a newline character, we dont want to advance the next character (same as above)
+			if (indexIntoCharactersVector == beginIndexIntoCharactersVector && indexIntoCharactersVector > 0 && isSpaceCharacter(character.codepoint) &&
+				!isNewline(characters[static_cast<std::size_t>(indexIntoCharactersVector) - 1].codepoint)) {
+				lastCodepoint = 0;
+			}
 			// Add the new glyph
 			editGlyph(glyph, indexIntoCharactersVector);
 			// Advance to next character
@@ -366,55 +412,51 @@ namespace SnackerEngine
 		return true;
 	}
 	//--------------------------------------------------------------------------------------------------
-	bool ParseData::parseWordByWord(const unsigned& beginIndexIntoUTF8String, const unsigned endIndexIntoUTF8String, const std::string& text)
+	bool ParseData::parseWordByWord(const unsigned& beginIndexIntoCodepoints, const unsigned endIndexIntoCodepoints, const std::vector<Unicode>& codepoints)
 	{
-		unsigned indexIntoUTF8String = beginIndexIntoUTF8String;
+		unsigned indexIntoCodepoints = beginIndexIntoCodepoints;
 		// Go through the text secharacter by character
-		while (indexIntoUTF8String < text.size()) {
+		while (indexIntoCodepoints < codepoints.size()) {
 			/// Before we parse the next codepoint, we need to save the index into the UTF8 string, because we might
 			/// need to backtrack if the parsed word does not fit into the current line
-			unsigned int previousIndexIntoUTF8String = indexIntoUTF8String;
+			unsigned int previousIndexIntoCodepoints = indexIntoCodepoints;
 			// Now we can parse the next character
-			auto codepoint = getNextCodepointUTF8(text, indexIntoUTF8String);
-			if (!codepoint) {
-				warningLogger << LOGGER::BEGIN << "text was not formatted properly (can only read UTF-8 formatting)" << LOGGER::ENDL;
-				return false;
-			}
+			const Unicode codepoint = codepoints[indexIntoCodepoints++];
 			// First check if the parsed codepoint was a newline character
-			if (isNewline(codepoint.value())) {
+			if (isNewline(codepoint)) {
 				pushNewlineGlyph();
 				goToNextLine();
 				lastCodepoint = 0;
 				continue;
 			}
 			// Next, check if we have a whitespace character
-			if (isWhiteSpace(codepoint.value())) {
+			if (isWhiteSpace(codepoint)) {
 				/// Whitespaces are treated equally as in the CHARACTERS case: Try to put it on the current line,
 				/// if it doesn't fit put it on the next line!
 				if (lastCodepoint != 0) {
 					// Advance to next glyph
-					advanceBaselineWithKerning(codepoint.value());
+					advanceBaselineWithKerning(codepoint);
 				}
-				Glyph glyph = font.getGlyph(codepoint.value());
+				Glyph glyph = font.getGlyph(codepoint);
 				// Check if we need a new line
 				if (!isInsideTextWidth(currentBaseline.x + glyph.right) && lastCodepoint != 0) {
 					goToNextLine();
 					// Special rule: If the first character on a new line is a space character, we dont 
 					// want to advance the next character!
-					if (isSpaceCharacter(codepoint.value())) {
+					if (isSpaceCharacter(codepoint)) {
 						lastCodepoint = 0;
 					}
 					else {
 						// Update lastCodepoint
-						lastCodepoint = codepoint.value();
+						lastCodepoint = codepoint;
 					}
 				}
 				else {
 					// Update lastCodepoint
-					lastCodepoint = codepoint.value();
+					lastCodepoint = codepoint;
 				}
 				// Add the new glyph
-				pushGlyph(glyph, codepoint.value());
+				pushGlyph(glyph, codepoint);
 			}
 			else {
 				/// We have a non-whitespace character. First: save some additional information that is necessary when
@@ -428,25 +470,25 @@ namespace SnackerEngine
 				// Now: place the character we just read in at the correct position
 				if (lastCodepoint != 0) {
 					// Advance to next glyph
-					advanceBaselineWithKerning(codepoint.value());
+					advanceBaselineWithKerning(codepoint);
 				}
-				Glyph glyph = font.getGlyph(codepoint.value());
+				Glyph glyph = font.getGlyph(codepoint);
 				// Check if we need a new line
 				if (!isInsideTextWidth(currentBaseline.x + glyph.right) && !characters.empty() && lastCodepoint != 0) {
 					goToNextLine();
 					previousBaselineX = currentBaseline.x;
-					lastCodepoint = codepoint.value();
+					lastCodepoint = codepoint;
 					previouseLastCodepoint = 0;
 				}
 				else {
 					// Update lastCodepoint
-					lastCodepoint = codepoint.value();
+					lastCodepoint = codepoint;
 				}
 				// Add the new glyph
-				pushGlyph(glyph, codepoint.value());
+				pushGlyph(glyph, codepoint);
 				/// Now, we want to read the remaining word.
 				// First try to just parse the word in the current line
-				pushGlyphsUntilWhitespace(indexIntoUTF8String, text);
+				pushGlyphsUntilWhitespace(indexIntoCodepoints, codepoints);
 				// Now, we can have three cases:
 				double rightPositionX = currentBaseline.x + font.getGlyph(lastCodepoint).right;
 				if (isInsideTextWidth(rightPositionX)) {
@@ -459,8 +501,8 @@ namespace SnackerEngine
 					goToNextLine();
 					lastCodepoint = 0;
 					// Now we can read in the word again, but this time it will fit.
-					indexIntoUTF8String = previousIndexIntoUTF8String;
-					pushGlyphsUntilWhitespace(indexIntoUTF8String, text);
+					indexIntoCodepoints = previousIndexIntoCodepoints;
+					pushGlyphsUntilWhitespace(indexIntoCodepoints, codepoints);
 				}
 				else
 				{
@@ -470,7 +512,7 @@ namespace SnackerEngine
 					characters.resize(charactersSize);
 					currentBaseline.x = previousBaselineX;
 					lastCodepoint = previouseLastCodepoint;
-					parseCharacterByCharacter(previousIndexIntoUTF8String, indexIntoUTF8String, text);
+					parseCharacterByCharacter(previousIndexIntoCodepoints, indexIntoCodepoints, codepoints);
 				}
 			}
 		}
@@ -492,6 +534,7 @@ namespace SnackerEngine
 				editNewlineGlyph(indexIntoCharactersVector);
 				indexIntoCharactersVector++;
 				goToNextLine(indexIntoCharactersVector);
+				if (checkConvergence(indexIntoCharactersVector)) return true;
 				lastCodepoint = 0;
 				continue;
 			}
@@ -507,6 +550,7 @@ namespace SnackerEngine
 				// Check if we need a new line
 				if (!isInsideTextWidth(currentBaseline.x + glyph.right) && lastCodepoint != 0) {
 					goToNextLine(indexIntoCharactersVector);
+					if (checkConvergence(indexIntoCharactersVector)) return true;
 					// Special rule: If the first character on a new line is a space character, we dont 
 					// want to advance the next character!
 					if (isSpaceCharacter(character.codepoint)) {
@@ -549,6 +593,7 @@ namespace SnackerEngine
 				// Check if we need a new line
 				if (!isInsideTextWidth(currentBaseline.x + glyph.right) && !characters.empty() && lastCodepoint!=0) {
 					goToNextLine(indexIntoCharactersVector);
+					if (checkConvergence(indexIntoCharactersVector)) return true;
 					previousBaselineX = currentBaseline.x;
 					lastCodepoint = character.codepoint;
 					previouseLastCodepoint = 0;
@@ -577,6 +622,8 @@ namespace SnackerEngine
 					// Now we can read in the word again, but this time it will fit.
 					indexIntoCharactersVector = previousIndexIntoCharactersVector;
 					editGlyphsUntilWhitespace(indexIntoCharactersVector);
+					// The word was moved, so we can only stop after it was read in again
+					if (checkConvergence(previousIndexIntoCharactersVector)) return true;
 				}
 				else
 				{
@@ -586,20 +633,20 @@ namespace SnackerEngine
 					characters.resize(charactersSize);
 					currentBaseline.x = previousBaselineX;
 					lastCodepoint = previouseLastCodepoint;
+					// The characters of the word were already moved, so we can't stop in the middle of it
+					const bool wasConvergenceAllowed = convergenceAllowed;
+					convergenceAllowed = false;
 					parseCharacterByCharacter(previousIndexIntoCharactersVector, indexIntoCharactersVector);
+					convergenceAllowed = wasConvergenceAllowed;
 				}
 			}
 		}
 		return true;
 	}
 	//--------------------------------------------------------------------------------------------------
-	std::pair<Model, double> ParseData::alignAndConstructModel(AlignmentHorizontal alignment, std::vector<Vec4f>& vertices, std::vector<unsigned int>& indices)
+	std::pair<Model, double> ParseData::alignAndConstructModel(AlignmentHorizontal alignment, std::vector<Vec4f>& vertices, std::vector<unsigned int>& indices, bool createModel)
 	{
 		if (characters.empty()) return std::make_pair(Model(), 0.0);
-		vertices.clear();
-		indices.clear();
-		vertices.reserve(characters.size() * 4);
-		indices.reserve(characters.size() * 6);
 		double longestLineWidth = 0.0;
 		double right = 0.0;
 		for (auto& line : lines) {
@@ -610,30 +657,18 @@ namespace SnackerEngine
 				right = characters[line.endIndex].right;
 			}
 		}
+		if (!createModel) return std::make_pair(Model(), right);
+		vertices.clear();
+		indices.clear();
+		vertices.reserve(characters.size() * 4);
+		indices.reserve(characters.size() * 6);
 		for (unsigned int lineIndex = 0; lineIndex < lines.size(); ++lineIndex) {
 			const auto& line = lines[lineIndex];
 			if (line.beginIndex >= characters.size() || line.endIndex >= characters.size()) {
 				continue;
 			}
 			// Determine horizontal offset of the current line
-			double horizontalOffset = 0.0;
-			switch (alignment)
-			{
-			case AlignmentHorizontal::LEFT: break;
-			case AlignmentHorizontal::CENTER:
-			{
-				double lineWidth = characters[line.endIndex].right - characters[line.beginIndex].left;
-				horizontalOffset = (longestLineWidth - lineWidth) / 2.0;
-				break;
-			}
-			case AlignmentHorizontal::RIGHT:
-			{
-				double lineWidth = characters[line.endIndex].right;
-				horizontalOffset = longestLineWidth - lineWidth;
-				break;
-			}
-			default: break;
-			}
+			const double horizontalOffset = StaticText::computeHorizontalOffset(alignment, characters, line, longestLineWidth);
 			// Go through line and push indices and vertices
 			for (unsigned int i = line.beginIndex; i <= line.endIndex; ++i) {
 				StaticText::Character& c = characters[i];
@@ -673,70 +708,108 @@ namespace SnackerEngine
 		return std::make_pair(Model(mesh), right);
 	}
 	//--------------------------------------------------------------------------------------------------
-	Model StaticText::parseTextCharacters(const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment)
+	std::pair<Model, double> StaticText::parseTextCharacters(CharacterBuffer& characters, std::vector<Line>& lines, const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment)
 	{
 		// Create ParseDynamicTextData object
-		std::vector<Character> characters;
-		std::vector<Line> lines;
+		characters.clear();
+		lines.clear();
 		lines.push_back({ 0.0, 0, 0 });
 		Font tempFont(font);
 		ParseData data{ tempFont, Vec2d{}, Unicode{0}, textWidth, fontSize, lineHeightMultiplier, characters, lines };
 		// Parse the text
-		data.parseCharacterByCharacter(0, static_cast<unsigned int>(text.size()), text);
+		const std::vector<Unicode>& codepoints = ParseData::decodeText(text);
+		data.parseCharacterByCharacter(0, static_cast<unsigned int>(codepoints.size()), codepoints);
 		// Finalize the lines vector
 		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
 		// Construct model
 		std::vector<Vec4f> vertices;
 		std::vector<unsigned int> indices;
-		return data.alignAndConstructModel(alignment, vertices, indices).first;
+		return data.alignAndConstructModel(alignment, vertices, indices);
 	}
 	//--------------------------------------------------------------------------------------------------
-	Model StaticText::parseTextWordByWord(const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment)
+	std::pair<Model, double> StaticText::parseTextWordByWord(CharacterBuffer& characters, std::vector<Line>& lines, const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment)
 	{
 		// Create ParseDynamicTextData object
-		std::vector<Character> characters;
-		std::vector<Line> lines;
+		characters.clear();
+		lines.clear();
 		lines.push_back({ 0.0, 0, 0 });
 		Font tempFont(font);
 		ParseData data{ tempFont, Vec2d{}, Unicode{0}, textWidth, fontSize, lineHeightMultiplier, characters, lines };
 		// Parse the text
-		data.parseWordByWord(0, static_cast<unsigned int>(text.size()), text);
+		const std::vector<Unicode>& codepoints = ParseData::decodeText(text);
+		data.parseWordByWord(0, static_cast<unsigned int>(codepoints.size()), codepoints);
 		// Finalize the lines vector
 		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
 		// Construct model
 		std::vector<Vec4f> vertices;
 		std::vector<unsigned int> indices;
-		return data.alignAndConstructModel(alignment, vertices, indices).first;
+		return data.alignAndConstructModel(alignment, vertices, indices);
 	}
 	//--------------------------------------------------------------------------------------------------
-	Model StaticText::parseTextSingleLine(const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment)
+	std::pair<Model, double> StaticText::parseTextSingleLine(CharacterBuffer& characters, std::vector<Line>& lines, const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment)
 	{
 		// Create ParseDynamicTextData object
-		std::vector<Character> characters;
-		std::vector<Line> lines;
+		characters.clear();
+		lines.clear();
 		lines.push_back({ 0.0, 0, 0 });
 		Font tempFont(font);
 		ParseData data{ tempFont, Vec2d{}, Unicode{0}, 0.0, fontSize, lineHeightMultiplier, characters, lines };
 		// Parse the text
-		data.parseCharacterByCharacter(0, static_cast<unsigned int>(text.size()), text);
+		const std::vector<Unicode>& codepoints = ParseData::decodeText(text);
+		data.parseCharacterByCharacter(0, static_cast<unsigned int>(codepoints.size()), codepoints);
 		// Finalize the lines vector
 		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
 		// Construct model
 		std::vector<Vec4f> vertices;
 		std::vector<unsigned int> indices;
 		data.textWidth = textWidth;
-		return data.alignAndConstructModel(alignment, vertices, indices).first;
+		return data.alignAndConstructModel(alignment, vertices, indices);
 	}
 	//--------------------------------------------------------------------------------------------------
 	void StaticText::constructModel(const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, const ParseMode& parseMode, AlignmentHorizontal alignment)
 	{
+		// Texts with the same parameters share their layout and model
+		TextLayoutKey key{ text, font.fontID, fontSize, lineHeightMultiplier, textWidth, parseMode, alignment };
+		const bool cacheable = TextLayoutCache::isCacheable(key);
+		if (cacheable) {
+			const TextLayoutCache::TextLayout* layout = TextLayoutCache::find(key);
+			if (layout) {
+				model = layout->model;
+				return;
+			}
+		}
+		CharacterBuffer characters;
+		std::vector<Line> lines;
+		std::pair<Model, double> result{};
 		switch (parseMode)
 		{
-		case SnackerEngine::StaticText::ParseMode::WORD_BY_WORD: model = parseTextWordByWord(text, font, fontSize, lineHeightMultiplier, textWidth, alignment); break;
-		case SnackerEngine::StaticText::ParseMode::CHARACTERS: model = parseTextCharacters(text, font, fontSize, lineHeightMultiplier, textWidth, alignment); break;
-		case SnackerEngine::StaticText::ParseMode::SINGLE_LINE: model = parseTextSingleLine(text, font, fontSize, lineHeightMultiplier, textWidth, alignment); break;
+		case SnackerEngine::StaticText::ParseMode::WORD_BY_WORD: result = parseTextWordByWord(characters, lines, text, font, fontSize, lineHeightMultiplier, textWidth, alignment); break;
+		case SnackerEngine::StaticText::ParseMode::CHARACTERS: result = parseTextCharacters(characters, lines, text, font, fontSize, lineHeightMultiplier, textWidth, alignment); break;
+		case SnackerEngine::StaticText::ParseMode::SINGLE_LINE: result = parseTextSingleLine(characters, lines, text, font, fontSize, lineHeightMultiplier, textWidth, alignment); break;
 		default: break;
 		}
+		model = result.first;
+		if (cacheable && !hasPendingGlyphs(font, characters)) {
+			TextLayoutCache::insert(key, TextLayoutCache::TextLayout{ font, model,
+				std::vector<Character>(characters.begin(), characters.end()), std::move(lines), result.second });
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	double StaticText::computeHorizontalOffset(AlignmentHorizontal alignment, const CharacterBuffer& characters, const Line& line, double longestLineWidth)
+	{
+		switch (alignment)
+		{
+		case AlignmentHorizontal::CENTER: return (longestLineWidth - (characters[line.endIndex].right - characters[line.beginIndex].left)) / 2.0;
+		case AlignmentHorizontal::RIGHT: return longestLineWidth - characters[line.endIndex].right;
+		default: return 0.0;
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool StaticText::hasPendingGlyphs(const Font& font, const CharacterBuffer& characters)
+	{
+		// Usually no glyphs are generated in the background, so the characters don't have to be checked
+		if (!font.hasPendingGlyphs()) return false;
+		return std::any_of(characters.begin(), characters.end(), [&font](const Character& character) { return font.isPendingGlyph(character.codepoint); });
 	}
 	//--------------------------------------------------------------------------------------------------
 	StaticText::StaticText()
@@ -769,13 +842,14 @@ namespace SnackerEngine
 		lines.push_back({ 0.0, 0, 0 });
 		ParseData data{ font, Vec2d{}, Unicode{0}, textWidth, fontSize, lineHeightMultiplier, characters, lines };
 		// Parse the text
-		data.parseCharacterByCharacter(0, static_cast<unsigned int>(text.size()), text);
+		const std::vector<Unicode>& codepoints = ParseData::decodeText(text);
+		data.parseCharacterByCharacter(0, static_cast<unsigned int>(codepoints.size()), codepoints);
 		// Finalize the lines vector
 		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
 		// Construct model
 		std::vector<Vec4f> vertices;
 		std::vector<unsigned int> indices;
-		auto result = data.alignAndConstructModel(alignment, vertices, indices);
+		auto result = data.alignAndConstructModel(alignment, vertices, indices, modelEnabled);
 		right = result.second;
 		return result.first;
 	}
@@ -788,13 +862,14 @@ namespace SnackerEngine
 		lines.push_back({ 0.0, 0, 0 });
 		ParseData data{ font, Vec2d{}, Unicode{0}, textWidth, fontSize, lineHeightMultiplier, characters, lines };
 		// Parse the text
-		data.parseWordByWord(0, static_cast<unsigned int>(text.size()), text);
+		const std::vector<Unicode>& codepoints = ParseData::decodeText(text);
+		data.parseWordByWord(0, static_cast<unsigned int>(codepoints.size()), codepoints);
 		// Finalize the lines vector
 		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
 		// Construct model
 		std::vector<Vec4f> vertices;
 		std::vector<unsigned int> indices;
-		auto result = data.alignAndConstructModel(alignment, vertices, indices);
+		auto result = data.alignAndConstructModel(alignment, vertices, indices, modelEnabled);
 		right = result.second;
 		return result.first;
 	}
@@ -807,14 +882,15 @@ namespace SnackerEngine
 		lines.push_back({ 0.0, 0, 0 });
 		ParseData data{ font, Vec2d{}, Unicode{0}, 0.0, fontSize, lineHeightMultiplier, characters, lines };
 		// Parse the text
-		data.parseCharacterByCharacter(0, static_cast<unsigned int>(text.size()), text);
+		const std::vector<Unicode>& codepoints = ParseData::decodeText(text);
+		data.parseCharacterByCharacter(0, static_cast<unsigned int>(codepoints.size()), codepoints);
 		// Finalize the lines vector
 		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
 		// Construct model
 		std::vector<Vec4f> vertices;
 		std::vector<unsigned int> indices;
 		data.textWidth = textWidth;
-		auto result = data.alignAndConstructModel(alignment, vertices, indices);
+		auto result = data.alignAndConstructModel(alignment, vertices, indices, modelEnabled);
 		right = result.second;
 		return result.first;
 	}
@@ -824,6 +900,24 @@ namespace SnackerEngine
 		//infoLogger << LOGGER::BEGIN << "Reconstructing text model." <<
 		//	" text: " << text <<
 		//	", textWidth: " << textWidth << LOGGER::ENDL;
+		// Texts with the same parameters share their layout and model
+		TextLayoutKey key{ text, font.fontID, fontSize, lineHeightMultiplier, textWidth, parseMode, alignment };
+		const bool cacheable = TextLayoutCache::isCacheable(key);
+		if (cacheable) {
+			const TextLayoutCache::TextLayout* layout = TextLayoutCache::find(key);
+			if (layout) {
+				// Texts without a model only use the layout
+				model = modelEnabled ? layout->model : Model();
+				characters.clear();
+				characters.insert(0, layout->characters.begin(), layout->characters.end());
+				lines = layout->lines;
+				right = layout->right;
+				// Cached layouts never contain placeholders
+				glyphVersion = font.getGlyphVersion();
+				pendingCodepoints.clear();
+				return;
+			}
+		}
 		switch (parseMode)
 		{
 		case SnackerEngine::StaticText::ParseMode::WORD_BY_WORD: model = parseTextWordByWord(); break;
@@ -831,6 +925,12 @@ namespace SnackerEngine
 		case SnackerEngine::StaticText::ParseMode::SINGLE_LINE: model = parseTextSingleLine(); break;
 		default: break;
 		}
+		updatePendingCodepoints();
+		// Only layouts with a model are cached, such that they can be used by all texts
+		if (cacheable && modelEnabled && pendingCodepoints.empty()) {
+			TextLayoutCache::insert(key, TextLayoutCache::TextLayout{ font, model,
+				std::vector<Character>(characters.begin(), characters.end()), lines, right });
+		}
 	}
 	//--------------------------------------------------------------------------------------------------
 	DynamicText::DynamicText() 
@@ -847,14 +947,18 @@ namespace SnackerEngine
 	}
 	//--------------------------------------------------------------------------------------------------
 	DynamicText::DynamicText(const DynamicText& other) noexcept
-		: DynamicText(other.text, other.font, other.fontSize, other.textWidth, other.lineHeightMultiplier, other.parseMode, other.alignment) {}
+		: DynamicText(other.text, other.font, other.fontSize, other.textWidth, other.lineHeightMultiplier, other.parseMode, other.alignment) 
+	{
+		if (!other.modelEnabled) setModelEnabled(false);
+	}
 	//--------------------------------------------------------------------------------------------------
 	DynamicText::DynamicText(DynamicText&& other) noexcept
 		: StaticText(std::move(other)), font(std::move(other.font)), fontSize(std::move(other.fontSize)),
 		lineHeightMultiplier{ std::move(other.lineHeightMultiplier) }, textWidth(std::move(other.textWidth)), text(std::move(other.text)),
 		parseMode(std::move(other.parseMode)), alignment(std::move(other.alignment)), 
 		right(std::move(other.right)), characters(std::move(other.characters)), 
-		lines(std::move(other.lines))
+		lines(std::move(other.lines)), glyphVersion(other.glyphVersion), modelEnabled(other.modelEnabled),
+		pendingCodepoints(std::move(other.pendingCodepoints))
 	{
 		other.text = "";
 		other.characters.clear();
@@ -870,6 +974,7 @@ namespace SnackerEngine
 		textWidth = other.textWidth;
 		parseMode = other.parseMode;
 		alignment = other.alignment;
+		modelEnabled = other.modelEnabled;
 		right = 0.0;
 		characters.clear();
 		lines.clear();
@@ -890,6 +995,9 @@ namespace SnackerEngine
 		right = std::move(other.right);
 		characters = std::move(other.characters);
 		lines = std::move(other.lines);
+		glyphVersion = other.glyphVersion;
+		pendingCodepoints = std::move(other.pendingCodepoints);
+		modelEnabled = other.modelEnabled;
 		other.text = "";
 		other.characters.clear();
 		other.lines.clear();
@@ -946,6 +1054,49 @@ namespace SnackerEngine
 		return alignment;
 	}
 	//--------------------------------------------------------------------------------------------------
+	void DynamicText::updatePendingCodepoints()
+	{
+		glyphVersion = font.getGlyphVersion();
+		pendingCodepoints.clear();
+		if (!font.hasPendingGlyphs()) return;
+		for (const Character& character : characters) {
+			if (font.isPendingGlyph(character.codepoint) && std::find(pendingCodepoints.begin(), pendingCodepoints.end(), character.codepoint) == pendingCodepoints.end()) {
+				pendingCodepoints.push_back(character.codepoint);
+			}
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool DynamicText::hasOutdatedGlyphs() const
+	{
+		if (pendingCodepoints.empty() || font.getGlyphVersion() == glyphVersion) return false;
+		return std::any_of(pendingCodepoints.begin(), pendingCodepoints.end(), [this](const Unicode& codepoint) { return !font.isPendingGlyph(codepoint); });
+	}
+	//--------------------------------------------------------------------------------------------------
+	void DynamicText::computeGlyphInstances(std::vector<GlyphInstance>& instances) const
+	{
+		instances.clear();
+		if (characters.empty()) return;
+		instances.reserve(characters.size());
+		Font tempFont(font);
+		double longestLineWidth = 0.0;
+		for (const auto& line : lines) {
+			if (line.beginIndex >= characters.size() || line.endIndex >= characters.size()) continue;
+			longestLineWidth = std::max(longestLineWidth, characters[line.endIndex].right - characters[line.beginIndex].left);
+		}
+		for (const auto& line : lines) {
+			if (line.beginIndex >= characters.size() || line.endIndex >= characters.size()) continue;
+			// Determine horizontal offset of the current line
+			const double horizontalOffset = computeHorizontalOffset(alignment, characters, line, longestLineWidth);
+			for (unsigned int i = line.beginIndex; i <= line.endIndex; ++i) {
+				const Character& c = characters[i];
+				if (isWhiteSpace(c.codepoint)) continue;
+				const Glyph glyph = tempFont.getGlyph(c.codepoint);
+				instances.push_back(GlyphInstance::create(c.left + horizontalOffset, glyph.bottom + line.baselineY,
+					c.right + horizontalOffset, glyph.top + line.baselineY, glyph));
+			}
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
 	double DynamicText::getTop() const
 	{
 		return font.getAscender() * fontSize;
@@ -1022,6 +1173,15 @@ namespace SnackerEngine
 		if (recompute) constructModel();
 	}
 	//--------------------------------------------------------------------------------------------------
+	void DynamicText::setModelEnabled(bool modelEnabled, bool recompute)
+	{
+		if (this->modelEnabled == modelEnabled) return;
+		this->modelEnabled = modelEnabled;
+		// The layout stays valid, so the model can be released right away
+		if (!modelEnabled) model = Model();
+		else if (recompute) constructModel();
+	}
+	//--------------------------------------------------------------------------------------------------
 	void DynamicText::recompute()
 	{
 		constructModel();
@@ -1042,13 +1202,14 @@ namespace SnackerEngine
 		lines.push_back({ 0.0, 0, 0 });
 		ParseData data{ font, Vec2d{}, Unicode{0}, textWidth, fontSize, lineHeightMultiplier, characters, lines };
 		// Parse the text
-		data.parseCharacterByCharacter(0, static_cast<unsigned int>(text.size()), text);
+		const std::vector<Unicode>& codepoints = ParseData::decodeText(text);
+		data.parseCharacterByCharacter(0, static_cast<unsigned int>(codepoints.size()), codepoints);
 		// Finalize the lines vector
 		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
 		// Construct model
-		auto result = data.alignAndConstructModel(alignment, vertices, indices);
-		right = result.second;
-		return result.first;
+		resetVertexSlots();
+		updateVertices(0, static_cast<unsigned int>(lines.size()));
+		return createDynamicModel();
 	}
 	//--------------------------------------------------------------------------------------------------
 	Model EditableText::parseTextWordByWord()
@@ -1059,79 +1220,127 @@ namespace SnackerEngine
 		lines.push_back({ 0.0, 0, 0 });
 		ParseData data{ font, Vec2d{}, Unicode{0}, textWidth, fontSize, lineHeightMultiplier, characters, lines };
 		// Parse the text
-		data.parseWordByWord(0, static_cast<unsigned int>(text.size()), text);
+		const std::vector<Unicode>& codepoints = ParseData::decodeText(text);
+		data.parseWordByWord(0, static_cast<unsigned int>(codepoints.size()), codepoints);
 		// Finalize the lines vector
 		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
 		// Construct model
-		auto result = data.alignAndConstructModel(alignment, vertices, indices);
-		right = result.second;
-		return result.first;
+		resetVertexSlots();
+		updateVertices(0, static_cast<unsigned int>(lines.size()));
+		return createDynamicModel();
 	}
 	//--------------------------------------------------------------------------------------------------
-	Model EditableText::parseTextCharactersFrom(const unsigned int& lineIndex)
+	Model EditableText::parseTextSingleLine()
 	{
 		// Create ParseDynamicTextData object
-		lines.resize(lineIndex);
-		if (lineIndex == 0) lines.push_back({ 0.0, 0, 0 });
-		else lines.push_back({ lines.back().baselineY - getLineHeight(), lines.back().endIndex + 1, lines.back().endIndex + 1});
-		ParseData data{ font, Vec2d(0.0, lines.back().baselineY), Unicode{0}, textWidth, fontSize, lineHeightMultiplier, characters, lines};
+		characters.clear();
+		lines.clear();
+		lines.push_back({ 0.0, 0, 0 });
+		ParseData data{ font, Vec2d{}, Unicode{0}, 0.0, fontSize, lineHeightMultiplier, characters, lines };
 		// Parse the text
-		data.parseCharacterByCharacter(lines.back().beginIndex, static_cast<unsigned int>(characters.size()));
+		const std::vector<Unicode>& codepoints = ParseData::decodeText(text);
+		data.parseCharacterByCharacter(0, static_cast<unsigned int>(codepoints.size()), codepoints);
 		// Finalize the lines vector
 		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
 		// Construct model
-		auto result = data.alignAndConstructModel(alignment, vertices, indices);
-		right = result.second;
-		return result.first;
+		resetVertexSlots();
+		updateVertices(0, static_cast<unsigned int>(lines.size()));
+		return createDynamicModel();
+	}
+	//--------------------------------------------------------------------------------------------------
+	DirtyRange EditableText::parseTextCharactersFrom(const unsigned int& lineIndex, const unsigned int& convergenceIndex)
+	{
+		// go one line back: characters at the beginning of the edited line may now fit into the previous line
+		unsigned int newLineIndex = lineIndex;
+		if (newLineIndex > 0) newLineIndex--;
+		// Save the previous layout of the following lines, such that we can stop as soon as the line breaks converge
+		std::vector<Line> previousLines(lines.begin() + std::min(static_cast<std::size_t>(newLineIndex), lines.size()), lines.end());
+		// Create ParseDynamicTextData object
+		lines.resize(newLineIndex);
+		if (newLineIndex == 0) lines.push_back({ 0.0, 0, 0 });
+		else lines.push_back({ lines.back().baselineY - getLineHeight(), lines.back().endIndex + 1, lines.back().endIndex + 1});
+		ParseData data{ font, Vec2d(0.0, lines.back().baselineY), Unicode{0}, textWidth, fontSize, lineHeightMultiplier, characters, lines};
+		data.previousLines = &previousLines;
+		data.previousLinesOffset = newLineIndex;
+		data.convergenceIndex = convergenceIndex;
+		// Parse the text
+		data.parseCharacterByCharacter(lines.back().beginIndex, static_cast<unsigned int>(characters.size()));
+		return finishLayoutFrom(data.converged, previousLines, newLineIndex);
 	}
 	//--------------------------------------------------------------------------------------------------
-	Model EditableText::parseTextSingleLineFrom(const unsigned int& lineIndex)
+	DirtyRange EditableText::parseTextSingleLineFrom(const unsigned int& lineIndex, const unsigned int& convergenceIndex)
 	{
 		// Create ParseDynamicTextData object
 		lines.resize(lineIndex);
 		if (lineIndex == 0) lines.push_back({ 0.0, 0, 0 });
 		else lines.push_back({ lines.back().baselineY - getLineHeight(), lines.back().endIndex + 1, lines.back().endIndex + 1 });
 		ParseData data{ font, Vec2d(0.0, lines.back().baselineY), Unicode{0}, 0.0, fontSize, lineHeightMultiplier, characters, lines };
-		// Parse the text
+		// Parse the text. All characters after the edit move, so there is nothing to converge to
 		data.parseCharacterByCharacter(lines.back().beginIndex, static_cast<unsigned int>(characters.size()));
-		// Finalize the lines vector
-		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
-		// Construct model
-		data.textWidth = textWidth;
-		auto result = data.alignAndConstructModel(alignment, vertices, indices);
-		right = result.second;
-		return result.first;
+		return finishLayoutFrom(false, {}, lineIndex);
 	}
 	//--------------------------------------------------------------------------------------------------
-	Model EditableText::parseTextWordByWordFrom(const unsigned int& lineIndex)
+	DirtyRange EditableText::parseTextWordByWordFrom(const unsigned int& lineIndex, const unsigned int& convergenceIndex)
 	{
 		// go one line back to catch certain edge cases
 		unsigned int newLineIndex = lineIndex;
 		if (newLineIndex > 0) newLineIndex--;
+		// Save the previous layout of the following lines, such that we can stop as soon as the line breaks converge
+		std::vector<Line> previousLines(lines.begin() + std::min(static_cast<std::size_t>(newLineIndex), lines.size()), lines.end());
 		// Create ParseDynamicTextData object
 		lines.resize(newLineIndex);
 		if (newLineIndex == 0) lines.push_back({ 0.0, 0, 0 });
 		else lines.push_back({ lines.back().baselineY - getLineHeight(), lines.back().endIndex + 1, lines.back().endIndex + 1 });
 		ParseData data{ font, Vec2d(0.0, lines.back().baselineY), Unicode{0}, textWidth, fontSize, lineHeightMultiplier, characters, lines };
+		data.previousLines = &previousLines;
+		data.previousLinesOffset = newLineIndex;
+		data.convergenceIndex = convergenceIndex;
 		// Parse the text
 		data.parseWordByWord(lines.back().beginIndex, static_cast<unsigned int>(characters.size()));
-		// Finalize the lines vector
-		lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
-		// Construct model
-		auto result = data.alignAndConstructModel(alignment, vertices, indices);
-		right = result.second;
-		return result.first;
+		return finishLayoutFrom(data.converged, previousLines, newLineIndex);
+	}
+	//--------------------------------------------------------------------------------------------------
+	DirtyRange EditableText::finishLayoutFrom(const bool& converged, const std::vector<Line>& previousLines, const unsigned int& beginLineIndex)
+	{
+		if (!converged) {
+			// Finalize the lines vector
+			lines.back().endIndex = static_cast<unsigned int>(characters.size() - 1);
+			// All lines after beginLineIndex are new
+			removeLineExtents(beginLineIndex, static_cast<unsigned int>(lineExtents.size()));
+			lineExtents.resize(lines.size());
+			return DirtyRange{ beginLineIndex, static_cast<unsigned int>(lines.size()) };
+		}
+		// The last line starts at the same character as the previous line with the same index, 
+		// all following lines are therefore the same as before
+		const unsigned int endLineIndex = static_cast<unsigned int>(lines.size() - 1);
+		lines.pop_back();
+		lines.insert(lines.end(), previousLines.begin() + (endLineIndex - beginLineIndex), previousLines.end());
+		// The number of lines did not change, only the extents of the new lines have to be replaced
+		removeLineExtents(beginLineIndex, endLineIndex);
+		lineExtents.resize(lines.size());
+		return DirtyRange{ beginLineIndex, endLineIndex };
 	}
 	//--------------------------------------------------------------------------------------------------
 	void EditableText::constructModelFrom(const unsigned int& lineIndex)
 	{
+		constructModelFrom(lineIndex, std::numeric_limits<unsigned int>::max());
+	}
+	//--------------------------------------------------------------------------------------------------
+	void EditableText::constructModelFrom(const unsigned int& lineIndex, const unsigned int& convergenceIndex)
+	{
+		dirtyLineRanges.clear();
+		DirtyRange lineRange{ 0, 0 };
 		switch (parseMode)
 		{
-		case SnackerEngine::StaticText::ParseMode::WORD_BY_WORD: model = parseTextWordByWordFrom(lineIndex); break;
-		case SnackerEngine::StaticText::ParseMode::CHARACTERS: model = parseTextCharactersFrom(lineIndex); break;
-		case SnackerEngine::StaticText::ParseMode::SINGLE_LINE: model = parseTextSingleLineFrom(lineIndex); break;
+		case SnackerEngine::StaticText::ParseMode::WORD_BY_WORD: lineRange = parseTextWordByWordFrom(lineIndex, convergenceIndex); break;
+		case SnackerEngine::StaticText::ParseMode::CHARACTERS: lineRange = parseTextCharactersFrom(lineIndex, convergenceIndex); break;
+		case SnackerEngine::StaticText::ParseMode::SINGLE_LINE: lineRange = parseTextSingleLineFrom(lineIndex, convergenceIndex); break;
 		default: break;
 		}
+		updateVertices(lineRange.begin, lineRange.end);
+		compactVertexSlots();
+		uploadDirtyVertices();
+		updatePendingCodepoints();
 		setCursorPos(cursorPosIndex);
 	}
 	//--------------------------------------------------------------------------------------------------
@@ -1144,19 +1353,246 @@ namespace SnackerEngine
 		case SnackerEngine::StaticText::ParseMode::SINGLE_LINE: model = parseTextSingleLine(); break;
 		default: break;
 		}
+		updatePendingCodepoints();
 		setCursorPos(cursorPosIndex);
 	}
 	//--------------------------------------------------------------------------------------------------
 	void EditableText::constructTextFromCharacters()
 	{
-		std::vector<char> chars;
-		for (const auto& character : characters) {
-			appendUnicodeCharacter(chars, character.codepoint);
+		// Compute the final size first, such that the text is only resized once
+		const auto segments = { characters.getFirstSegment(), characters.getSecondSegment() };
+		std::size_t length = 0;
+		for (const auto& segment : segments) {
+			for (std::size_t i = 0; i < segment.second; ++i) {
+				length += getLengthUTF8(segment.first[i].codepoint);
+			}
+		}
+		text.resize(length);
+		char* out = text.data();
+		for (const auto& segment : segments) {
+			for (std::size_t i = 0; i < segment.second; ++i) {
+				out = writeCodepointUTF8(out, segment.first[i].codepoint);
+			}
 		}
-		text = std::string(chars.begin(), chars.end());
 		textIsUpToDate = true;
 	}
 	//--------------------------------------------------------------------------------------------------
+	unsigned int EditableText::allocateVertexSlot()
+	{
+		if (!freeVertexSlots.empty()) {
+			const unsigned int slot = freeVertexSlots.back();
+			freeVertexSlots.pop_back();
+			return slot;
+		}
+		const unsigned int slot = vertexSlotCount++;
+		if (static_cast<std::size_t>(vertexSlotCount) * 4 > vertices.size()) {
+			// Grow geometrically, since the vertex buffer has to be created again every time this happens
+			vertices.resize(std::max(vertices.size() * 2, static_cast<std::size_t>(vertexSlotCount) * 4), Vec4f(0.0f));
+		}
+		return slot;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void EditableText::freeVertexSlot(const unsigned int& slot)
+	{
+		const std::size_t firstVertex = static_cast<std::size_t>(slot) * 4;
+		std::fill(vertices.begin() + firstVertex, vertices.begin() + firstVertex + 4, Vec4f(0.0f));
+		dirtyVertexRanges.add(static_cast<unsigned int>(firstVertex), static_cast<unsigned int>(firstVertex + 4));
+		freeVertexSlots.push_back(slot);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void EditableText::resetVertexSlots()
+	{
+		freeVertexSlots.clear();
+		vertexSlotCount = static_cast<unsigned int>(characters.size());
+		for (unsigned int i = 0; i < vertexSlotCount; ++i) {
+			characters[i].vertexSlot = i;
+		}
+		vertices.assign(static_cast<std::size_t>(vertexSlotCount) * 4, Vec4f(0.0f));
+		longestLineWidth = 0.0;
+		lineExtents.assign(lines.size(), std::make_pair(0.0, 0.0));
+		sortedLineExtents.clear();
+		dirtyLineRanges.clear();
+		dirtyVertexRanges.clear();
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool EditableText::compactVertexSlots()
+	{
+		const std::size_t slotCapacity = vertices.size() / 4;
+		if (slotCapacity < minCompactedVertexSlotCount || characters.size() * minVertexSlotUsageDivisor > slotCapacity) return false;
+		freeVertexSlots.clear();
+		vertexSlotCount = static_cast<unsigned int>(characters.size());
+		for (unsigned int i = 0; i < vertexSlotCount; ++i) {
+			characters[i].vertexSlot = i;
+		}
+		// Keep some unused slots, such that the next insertions don't create the vertex buffer again
+		vertices.assign(static_cast<std::size_t>(vertexSlotCount) * 2 * 4, Vec4f(0.0f));
+		writeVertices(DirtyRange{ 0, static_cast<unsigned int>(lines.size()) });
+		return true;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void EditableText::removeLineExtents(const unsigned int& beginLineIndex, const unsigned int& endLineIndex)
+	{
+		const std::size_t end = std::min(static_cast<std::size_t>(endLineIndex), lineExtents.size());
+		for (std::size_t i = beginLineIndex; i < end; ++i) {
+			auto it = sortedLineExtents.find(lineExtents[i]);
+			if (it != sortedLineExtents.end()) sortedLineExtents.erase(it);
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	void EditableText::updateVertices(const unsigned int& beginLineIndex, const unsigned int& endLineIndex)
+	{
+		DirtyRange lineRange{ std::min(beginLineIndex, static_cast<unsigned int>(lines.size())), std::min(endLineIndex, static_cast<unsigned int>(lines.size())) };
+		// Measure the lines that were laid out again. The extents of all other lines did not change
+		lineExtents.resize(lines.size());
+		for (unsigned int lineIndex = lineRange.begin; lineIndex < lineRange.end; ++lineIndex) {
+			const auto& line = lines[lineIndex];
+			std::pair<double, double> extent(0.0, 0.0);
+			if (line.beginIndex < characters.size() && line.endIndex < characters.size()) {
+				extent = std::make_pair(characters[line.endIndex].right - characters[line.beginIndex].left, characters[line.endIndex].right);
+			}
+			lineExtents[lineIndex] = extent;
+			sortedLineExtents.insert(extent);
+		}
+		// The longest line is needed for alignment and for the right border
+		double longestLineWidth = 0.0;
+		right = 0.0;
+		if (!sortedLineExtents.empty() && sortedLineExtents.rbegin()->first > 0.0) {
+			longestLineWidth = sortedLineExtents.rbegin()->first;
+			right = sortedLineExtents.rbegin()->second;
+		}
+		// If the alignment depends on the longest line and it changed, all lines move
+		if (alignment != AlignmentHorizontal::LEFT && longestLineWidth != this->longestLineWidth) {
+			lineRange = DirtyRange{ 0, static_cast<unsigned int>(lines.size()) };
+		}
+		this->longestLineWidth = longestLineWidth;
+		dirtyLineRanges.add(lineRange.begin, lineRange.end);
+		writeVertices(lineRange);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void EditableText::writeVertices(const DirtyRange& lineRange)
+	{
+		for (unsigned int lineIndex = lineRange.begin; lineIndex < lineRange.end; ++lineIndex) {
+			const auto& line = lines[lineIndex];
+			if (line.beginIndex >= characters.size() || line.endIndex >= characters.size()) {
+				continue;
+			}
+			// Determine horizontal offset of the current line
+			const double horizontalOffset = computeHorizontalOffset(alignment, characters, line, longestLineWidth);
+			// Write the four vertices of each character into its slot
+			for (unsigned int i = line.beginIndex; i <= line.endIndex; ++i) {
+				const Character& c = characters[i];
+				const unsigned int firstVertex = c.vertexSlot * 4;
+				Vec4f* characterVertices = &vertices[firstVertex];
+				if (!isWhiteSpace(c.codepoint)) {
+					Glyph glyph = font.getGlyph(c.codepoint);
+					glyph.bottom += line.baselineY;
+					glyph.top += line.baselineY;
+					characterVertices[0] = Vec4f(static_cast<float>(c.left + horizontalOffset), static_cast<float>(glyph.bottom), static_cast<float>(glyph.texLeft), static_cast<float>(glyph.texBottom));
+					characterVertices[1] = Vec4f(static_cast<float>(c.left + horizontalOffset), static_cast<float>(glyph.top), static_cast<float>(glyph.texLeft), static_cast<float>(glyph.texTop));
+					characterVertices[2] = Vec4f(static_cast<float>(c.right + horizontalOffset), static_cast<float>(glyph.top), static_cast<float>(glyph.texRight), static_cast<float>(glyph.texTop));
+					characterVertices[3] = Vec4f(static_cast<float>(c.right + horizontalOffset), static_cast<float>(glyph.bottom), static_cast<float>(glyph.texRight), static_cast<float>(glyph.texBottom));
+				}
+				else {
+					std::fill(characterVertices, characterVertices + 4, Vec4f(0.0f));
+				}
+				dirtyVertexRanges.add(firstVertex, firstVertex + 4);
+			}
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	Model EditableText::createDynamicModel()
+	{
+		meshVertexCount = vertices.size();
+		dirtyVertexRanges.clear();
+		uploadedVertexRanges.clear();
+		if (vertices.empty()) return Model();
+		// All slots use the same index pattern, free slots and whitespace are degenerate triangles
+		const unsigned int slotCount = static_cast<unsigned int>(vertices.size() / 4);
+		indices.resize(static_cast<std::size_t>(slotCount) * 6);
+		for (unsigned int slot = 0; slot < slotCount; ++slot) {
+			const unsigned int firstVertex = slot * 4;
+			unsigned int* slotIndices = &indices[static_cast<std::size_t>(slot) * 6];
+			slotIndices[0] = firstVertex; slotIndices[1] = firstVertex + 1; slotIndices[2] = firstVertex + 2;
+			slotIndices[3] = firstVertex + 2; slotIndices[4] = firstVertex + 3; slotIndices[5] = firstVertex;
+		}
+		uploadedVertexRanges.add(0, static_cast<unsigned int>(vertices.size()));
+		// Create layout and model
+		VertexBufferLayout layout;
+		layout.push<Vec2f>(1);
+		layout.push<Vec2f>(1);
+		Mesh mesh = MeshManager::createMesh<Vec4f>(layout, vertices, indices, VertexBuffer::VertexBufferStorageType::DYNAMIC);
+		return Model(mesh);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void EditableText::uploadDirtyVertices()
+	{
+		if (vertices.size() != meshVertexCount || model.getMeshes().empty()) {
+			// The vertex buffer is too small (or does not exist yet) and has to be created again
+			model = createDynamicModel();
+			return;
+		}
+		std::swap(uploadedVertexRanges, dirtyVertexRanges);
+		dirtyVertexRanges.clear();
+		if (uploadedVertexRanges.empty()) return;
+		VertexBuffer& vertexBuffer = model.getMeshes().front().getVertexBuffer();
+		if (uploadedVertexRanges.getRanges().size() > maxVertexUploadsPerUpdate) {
+			// Many small ranges: One larger upload is cheaper than many small ones
+			const DirtyRange range = uploadedVertexRanges.getBoundingRange();
+			vertexBuffer.changeSubData(&vertices[range.begin], range.size(), range.begin * static_cast<unsigned int>(sizeof(Vec4f)));
+		}
+		else {
+			for (const auto& range : uploadedVertexRanges.getRanges()) {
+				vertexBuffer.changeSubData(&vertices[range.begin], range.size(), range.begin * static_cast<unsigned int>(sizeof(Vec4f)));
+			}
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	void EditableText::insertCharacters(const unsigned int& index, const std::vector<Character>& newCharacters)
+	{
+		if (newCharacters.empty()) return;
+		const unsigned int count = static_cast<unsigned int>(newCharacters.size());
+		const unsigned int lineIndex = lines.empty() ? 0 : getLineNumber(index);
+		characters.insert(index, newCharacters.begin(), newCharacters.end());
+		// Every new character gets its own vertex slot
+		for (unsigned int i = index; i < index + count; ++i) {
+			characters[i].vertexSlot = allocateVertexSlot();
+		}
+		if (lines.empty()) return;
+		// The line the characters were inserted into grows, all following lines are shifted
+		lines[lineIndex].endIndex += count;
+		for (std::size_t i = static_cast<std::size_t>(lineIndex) + 1; i < lines.size(); ++i) {
+			lines[i].beginIndex += count;
+			lines[i].endIndex += count;
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	void EditableText::eraseCharacters(const unsigned int& beginIndex, const unsigned int& endIndex)
+	{
+		if (beginIndex > endIndex || beginIndex >= characters.size()) return;
+		const unsigned int lastIndex = std::min(endIndex, static_cast<unsigned int>(characters.size() - 1));
+		const unsigned int count = lastIndex - beginIndex + 1;
+		for (unsigned int i = beginIndex; i <= lastIndex; ++i) {
+			freeVertexSlot(characters[i].vertexSlot);
+		}
+		characters.erase(beginIndex, static_cast<std::size_t>(lastIndex) + 1);
+		if (lines.empty()) return;
+		const unsigned int firstLineIndex = getLineNumber(beginIndex);
+		const unsigned int lastLineIndex = getLineNumber(lastIndex);
+		// The first line now ends where the last line ended. Lines in between are removed
+		lines[firstLineIndex].endIndex = lines[lastLineIndex].endIndex - count;
+		lines.erase(lines.begin() + firstLineIndex + 1, lines.begin() + lastLineIndex + 1);
+		if (lineExtents.size() > lastLineIndex) {
+			removeLineExtents(firstLineIndex + 1, lastLineIndex + 1);
+			lineExtents.erase(lineExtents.begin() + firstLineIndex + 1, lineExtents.begin() + lastLineIndex + 1);
+		}
+		// The baselines are not changed. If lines were removed, the following lines have to move up
+		// and can't be reused during the next layout (see ParseData::checkConvergence())
+		for (std::size_t i = static_cast<std::size_t>(firstLineIndex) + 1; i < lines.size(); ++i) {
+			lines[i].beginIndex -= count;
+			lines[i].endIndex -= count;
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
 	EditableText::SelectionBox EditableText::computeSelectionBox(const unsigned& startCharacterIndex, const unsigned& endCharacterIndex, const unsigned& lineIndex)
 	{
 		if (characters.empty()) return SelectionBox{};
@@ -1237,13 +1673,13 @@ namespace SnackerEngine
 	}
 	//--------------------------------------------------------------------------------------------------
 	EditableText::EditableText()
-		: DynamicText(), textIsUpToDate(true), vertices{}, indices{}, cursorPosIndex(0), selectionIndex(0), cursorPos{}, cursorWidth{}
+		: DynamicText(), textIsUpToDate(true), vertices{}, indices{}, freeVertexSlots{}, vertexSlotCount(0), meshVertexCount(0), longestLineWidth(0.0), lineExtents{}, sortedLineExtents{}, dirtyLineRanges{}, dirtyVertexRanges{}, uploadedVertexRanges{}, cursorPosIndex(0), selectionIndex(0), cursorPos{}, cursorWidth{}
 	{
 		constructModel();
 	}
 	//--------------------------------------------------------------------------------------------------
 	EditableText::EditableText(const std::string& text, const Font& font, const double& fontSize, const double& textWidth, const float& cursorWidth, double lineHeightMultiplier, const ParseMode& parseMode, AlignmentHorizontal alignment)
-		: DynamicText(text, font, fontSize, textWidth, lineHeightMultiplier, parseMode, alignment), textIsUpToDate(true), vertices{}, indices{}, cursorPosIndex(0), selectionIndex(0), cursorPos{}, cursorWidth(cursorWidth)
+		: DynamicText(text, font, fontSize, textWidth, lineHeightMultiplier, parseMode, alignment), textIsUpToDate(true), vertices{}, indices{}, freeVertexSlots{}, vertexSlotCount(0), meshVertexCount(0), longestLineWidth(0.0), lineExtents{}, sortedLineExtents{}, dirtyLineRanges{}, dirtyVertexRanges{}, uploadedVertexRanges{}, cursorPosIndex(0), selectionIndex(0), cursorPos{}, cursorWidth(cursorWidth)
 	{
 		constructModel();
 		setCursorPos(0);
@@ -1255,12 +1691,20 @@ namespace SnackerEngine
 	EditableText::EditableText(EditableText&& other) noexcept
 		: DynamicText(std::move(other)), textIsUpToDate(std::move(other.textIsUpToDate)), 
 		vertices(std::move(other.vertices)), indices(std::move(other.indices)),
+		freeVertexSlots(std::move(other.freeVertexSlots)), vertexSlotCount(other.vertexSlotCount),
+		meshVertexCount(other.meshVertexCount), longestLineWidth(other.longestLineWidth),
+		lineExtents(std::move(other.lineExtents)), sortedLineExtents(std::move(other.sortedLineExtents)),
+		dirtyLineRanges(std::move(other.dirtyLineRanges)), dirtyVertexRanges(std::move(other.dirtyVertexRanges)),
+		uploadedVertexRanges(std::move(other.uploadedVertexRanges)),
 		cursorPosIndex(std::move(other.cursorPosIndex)), cursorPos(std::move(other.cursorPos)), 
 		selectionIndex(std::move(other.selectionIndex)), cursorWidth(std::move(other.cursorWidth))
 	{
 		other.textIsUpToDate = true;
 		other.vertices.clear();
 		other.indices.clear();
+		other.freeVertexSlots.clear();
+		other.vertexSlotCount = 0;
+		other.meshVertexCount = 0;
 		other.cursorPosIndex = 0;
 		other.cursorPos = Vec2f();
 	}
@@ -1286,6 +1730,15 @@ namespace SnackerEngine
 		textIsUpToDate = std::move(other.textIsUpToDate);
 		vertices = std::move(other.vertices);
 		indices = std::move(other.indices);
+		freeVertexSlots = std::move(other.freeVertexSlots);
+		vertexSlotCount = other.vertexSlotCount;
+		meshVertexCount = other.meshVertexCount;
+		longestLineWidth = other.longestLineWidth;
+		lineExtents = std::move(other.lineExtents);
+		sortedLineExtents = std::move(other.sortedLineExtents);
+		dirtyLineRanges = std::move(other.dirtyLineRanges);
+		dirtyVertexRanges = std::move(other.dirtyVertexRanges);
+		uploadedVertexRanges = std::move(other.uploadedVertexRanges);
 		cursorPosIndex = std::move(other.cursorPosIndex);
 		cursorPos = std::move(other.cursorPos);
 		selectionIndex = std::move(other.selectionIndex);
@@ -1293,6 +1746,9 @@ namespace SnackerEngine
 		other.textIsUpToDate = true;
 		other.vertices.clear();
 		other.indices.clear();
+		other.freeVertexSlots.clear();
+		other.vertexSlotCount = 0;
+		other.meshVertexCount = 0;
 		other.cursorPosIndex = 0;
 		other.cursorPos = Vec2f();
 		return *this;
@@ -1331,14 +1787,11 @@ namespace SnackerEngine
 			setCursorPos(0, moveSelection);
 			return;
 		}
+		// The baselines are decreasing, so the first line whose descender is below the mouse can be found
+		// with a binary search
 		double descender = font.getDescender();
-		int lineNumber = -1;
-		for (unsigned int tempLineNumber = 0; tempLineNumber < lines.size(); tempLineNumber++) {
-			if (mousePos.y >= lines[tempLineNumber].baselineY + descender) {
-				lineNumber = tempLineNumber;
-				break;
-			}
-		}
+		auto lineIt = std::partition_point(lines.begin(), lines.end(), [&](const Line& line) { return mousePos.y < line.baselineY + descender; });
+		int lineNumber = lineIt == lines.end() ? -1 : static_cast<int>(lineIt - lines.begin());
 		if (lineNumber == -1) {
 			setCursorPos(static_cast<unsigned int>(characters.size()) + 1, moveSelection);
 			return;
@@ -1477,8 +1930,9 @@ namespace SnackerEngine
 			unsigned endIndex = std::max(cursorPosIndex, selectionIndex) - 1;
 			deleteCharacters(std::min(cursorPosIndex, selectionIndex), endIndex);
 		}
-		characters.insert(characters.begin() + cursorPosIndex, { codepoint, 0.0, 0.0 });
-		constructModelFrom(getLineNumber(cursorPosIndex));
+		const unsigned int lineIndex = getLineNumber(cursorPosIndex);
+		insertCharacters(cursorPosIndex, { Character{ codepoint, 0.0, 0.0 } });
+		constructModelFrom(lineIndex, cursorPosIndex + 1);
 		textIsUpToDate = false;
 		setCursorPos(cursorPosIndex + 1);
 		setSelectionIndexToCursor();
@@ -1486,20 +1940,23 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	void EditableText::inputAtCursor(const std::string& text)
 	{
-		unsigned position = 0;
-		unsigned startingCursorPosIndex = cursorPosIndex;
 		if (isSelecting()) {
 			// If we have a selection, delete characters first
 			unsigned endIndex = std::max(cursorPosIndex, selectionIndex) - 1;
 			deleteCharacters(std::min(cursorPosIndex, selectionIndex), endIndex);
 		}
-		while (position < text.size()) {
-			std::optional<Unicode> codepoint = getNextCodepointUTF8(text, position);
-			if (!codepoint.has_value()) return;
-			characters.insert(characters.begin() + cursorPosIndex, { codepoint.value(), 0.0, 0.0});
-			cursorPosIndex++;
+		// Decode the whole string first, such that the characters can be inserted in one go
+		const std::vector<Unicode>& codepoints = ParseData::decodeText(text);
+		std::vector<Character> newCharacters;
+		newCharacters.reserve(codepoints.size());
+		for (const Unicode& codepoint : codepoints) {
+			newCharacters.push_back({ codepoint, 0.0, 0.0 });
 		}
-		constructModelFrom(getLineNumber(startingCursorPosIndex));
+		if (newCharacters.empty()) return;
+		const unsigned int lineIndex = getLineNumber(cursorPosIndex);
+		insertCharacters(cursorPosIndex, newCharacters);
+		cursorPosIndex += static_cast<unsigned int>(newCharacters.size());
+		constructModelFrom(lineIndex, cursorPosIndex);
 		textIsUpToDate = false;
 		setCursorPos(cursorPosIndex);
 		setSelectionIndexToCursor();
@@ -1515,8 +1972,10 @@ namespace SnackerEngine
 		if (characters.empty()) return;
 		if (beginIndex > endIndex) return;
 		if (endIndex >= characters.size()) endIndex = static_cast<unsigned int>(characters.size() - 1);
-		characters.erase(characters.begin() + beginIndex, characters.begin() + endIndex + 1);
-		constructModelFrom(getLineNumber(beginIndex));
+		if (beginIndex >= characters.size()) return;
+		const unsigned int lineIndex = getLineNumber(beginIndex);
+		eraseCharacters(beginIndex, endIndex);
+		constructModelFrom(lineIndex, beginIndex);
 		textIsUpToDate = false;
 		if (cursorPosIndex > beginIndex) {
 			if (cursorPosIndex < endIndex) {
@@ -1612,6 +2071,16 @@ namespace SnackerEngine
 		return getLineHeight() * static_cast<float>(fontSize);
 	}
 	//--------------------------------------------------------------------------------------------------
+	const DirtyRangeList& EditableText::getDirtyLineRanges() const
+	{
+		return dirtyLineRanges;
+	}
+	//--------------------------------------------------------------------------------------------------
+	const DirtyRangeList& EditableText::getUploadedVertexRanges() const
+	{
+		return uploadedVertexRanges;
+	}
+	//--------------------------------------------------------------------------------------------------
 	const std::string& EditableText::getText()
 	{
 		if (textIsUpToDate) {
@@ -1625,19 +2094,20 @@ namespace SnackerEngine
 	}
 	std::string EditableText::getText(unsigned start, unsigned end)
 	{
-		std::vector<char> chars;
+		std::string result;
+		if (characters.empty()) return result;
 		start = std::min(start, static_cast<unsigned>(characters.size() - 1));
 		end = std::min(end, static_cast<unsigned>(characters.size() - 1));
+		if (start > end) return result;
+		result.reserve(static_cast<std::size_t>(end) - start + 1);
 		for (unsigned i = start; i <= end; i++) {
-			appendUnicodeCharacter(chars, characters[i].codepoint);
+			appendUnicodeCharacter(result, characters[i].codepoint);
 		}
-		if (chars.empty()) return "";
-		else return std::string(chars.begin(), chars.end());
+		return result;
 	}
 	//--------------------------------------------------------------------------------------------------
 	std::string EditableText::getSelectedText()
 	{
-		std::vector<char> chars;
 		return getText(std::min(cursorPosIndex, selectionIndex), std::max(cursorPosIndex, selectionIndex) - 1);
 	}
 	//--------------------------------------------------------------------------------------------------
@@ -4,10 +4,13 @@
 #include "Math/Vec.h"
 #include "Graphics/Model.h"
 #include "Utility\Alignment.h"
+#include "Utility\GapBuffer.h"
+#include "Gui/Text/DirtyRanges.h"
 
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <set>
 
 namespace SnackerEngine
 {
@@ -21,6 +24,8 @@ namespace SnackerEngine
 	protected:
 		/// friend declaration for data structure that is used during parsing
 		friend struct ParseData;
+		/// friend declaration for the cache that stores layouts of texts
+		friend class TextLayoutCache;
 		/// Helper struct that saves information about a single character
 		struct Character
 		{
@@ -29,6 +34,9 @@ namespace SnackerEngine
 			/// The position of the left and right edge of a character in a left aligned context
 			double left;
 			double right;
+			/// Index of the block of four vertices that is used for this character. Only used by
+			/// EditableText, where characters are not stored in vertex buffer order
+			unsigned vertexSlot = 0;
 		};
 		/// Helper struct that saves information about a single line
 		struct Line
@@ -43,6 +51,9 @@ namespace SnackerEngine
 			bool operator>(const Line& other) const;
 			bool operator==(const Line& other) const;
 		};
+		/// Storage for the characters of a text. A gap buffer is used, because most edits
+		/// (in EditableText) happen close to the cursor
+		using CharacterBuffer = GapBuffer<Character>;
 	public:
 		/// Enum to specify how text is parsed and displayed
 		enum class ParseMode
@@ -54,14 +65,21 @@ namespace SnackerEngine
 	protected:
 		/// The model used for rendering
 		Model model;
-		/// Constructs the model using the given parameters and using parse mode 'CHARACTERS'
-		Model parseTextCharacters(const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment = AlignmentHorizontal::LEFT);
+		/// Constructs the model using the given parameters and using parse mode 'CHARACTERS'. The parsed
+		/// characters and lines are stored in the given containers. Returns the model and the right border
+		std::pair<Model, double> parseTextCharacters(CharacterBuffer& characters, std::vector<Line>& lines, const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment = AlignmentHorizontal::LEFT);
 		/// Constructs the model using the given parameters and using parse mode 'WORD_BY_WORD'
-		Model parseTextWordByWord(const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment = AlignmentHorizontal::LEFT);
+		std::pair<Model, double> parseTextWordByWord(CharacterBuffer& characters, std::vector<Line>& lines, const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment = AlignmentHorizontal::LEFT);
 		/// Constructs the model from the text member variable using parse mode 'SINGLE_LINE'
-		Model parseTextSingleLine(const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment = AlignmentHorizontal::LEFT);
+		std::pair<Model, double> parseTextSingleLine(CharacterBuffer& characters, std::vector<Line>& lines, const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, AlignmentHorizontal alignment = AlignmentHorizontal::LEFT);
 		/// Constructs the model from the text member variable
 		virtual void constructModel(const std::string& text, const Font& font, const double& fontSize, double lineHeightMultiplier, const double& textWidth, const ParseMode& parseMode = ParseMode::WORD_BY_WORD, AlignmentHorizontal alignment = AlignmentHorizontal::LEFT);
+		/// Returns the distance (in pt) that the given line is moved to the right by the alignment, given the
+		/// width of the longest line of the text
+		static double computeHorizontalOffset(AlignmentHorizontal alignment, const CharacterBuffer& characters, const Line& line, double longestLineWidth);
+		/// Returns true if one of the given characters is shown as a placeholder, because its glyph is still
+		/// generated in the background. Layouts with placeholders should not be cached
+		static bool hasPendingGlyphs(const Font& font, const CharacterBuffer& characters);
 	public:
 		/// Default constructor
 		StaticText();
@@ -95,10 +113,20 @@ namespace SnackerEngine
 		AlignmentHorizontal alignment = AlignmentHorizontal::LEFT;
 		/// The right border of the text, in pt. Gets set when the model is constructed
 		double right = 0.0;
-		/// Vector of unicode characters
-		std::vector<Character> characters{};
+		/// Buffer of unicode characters
+		CharacterBuffer characters{};
 		/// Vector of lines
 		std::vector<Line> lines{};
+		/// Glyph version of the font (see Font::getGlyphVersion()) at the time the model was constructed
+		unsigned int glyphVersion = 0;
+		/// If this is set to false, only the layout (characters and lines) is computed and no model is created
+		bool modelEnabled = true;
+		/// Codepoints of the text whose glyphs were still generated in the background when the model was
+		/// constructed, ie. that are shown as placeholders. Empty most of the time
+		std::vector<Unicode> pendingCodepoints{};
+		/// Stores the current glyph version and collects the pending codepoints. Should be called after
+		/// the characters were parsed
+		void updatePendingCodepoints();
 		/// Constructs the model from the text member variable using parse mode 'CHARACTERS'
 		virtual Model parseTextCharacters();
 		/// Constructs the model from the text member variable using parse mode 'WORD_BY_WORD'
@@ -128,6 +156,14 @@ namespace SnackerEngine
 		const Model& getModel() const;
 		const ParseMode& getParseMode() const;
 		AlignmentHorizontal getAlignment() const;
+		/// Returns true if glyphs that are shown as placeholders by the model were added to the font in the
+		/// meantime. In this case, the model should be recomputed. Texts that don't wait for any glyphs
+		/// return false without looking them up
+		bool hasOutdatedGlyphs() const;
+		/// Computes one compact glyph instance for each visible character, in the same coordinates as the
+		/// vertices of the model (see GlyphInstance and InstancedTextMesh). Whitespace is skipped.
+		/// Does not access the GPU
+		void computeGlyphInstances(std::vector<GlyphInstance>& instances) const;
 		/// Returns the y coordinate of the top of the text (in pt)
 		/// The 0 coordinate is the baseline of the first character
 		double getTop() const;
@@ -142,6 +178,8 @@ namespace SnackerEngine
 		double getRight(const unsigned int& lineIndex) const;
 		/// Returns the number of characters
 		std::size_t getNumCharacters();
+		/// Returns the number of lines
+		std::size_t getNumLines() const { return lines.size(); }
 		/// Sets the contents of the text. Needs to recompute the text model.
 		/// If you want to set multiple parameters and not yet want to recompute the text model,
 		/// set recompute to false
@@ -168,6 +206,11 @@ namespace SnackerEngine
 		virtual void setParseMode(const StaticText::ParseMode& parseMode, bool recompute = true);
 		/// Sets the alignment.
 		virtual void setAlignment(AlignmentHorizontal alignment, bool recompute = true);
+		/// Sets whether a model is created. Texts that are drawn from their glyph instances (see 
+		/// computeGlyphInstances()) don't need one. Disabling the model releases it right away, enabling
+		/// it needs to recompute the text model. Should not be used with EditableText, which edits its model
+		void setModelEnabled(bool modelEnabled, bool recompute = true);
+		bool isModelEnabled() const { return modelEnabled; }
 		/// Recomputes the text model
 		virtual void recompute();
 	};
@@ -192,6 +235,34 @@ namespace SnackerEngine
 		std::vector<Vec4f> vertices;
 		/// Vector of indices
 		std::vector<unsigned int> indices;
+		/// Every character uses its own slot (block of four vertices) in the vertices vector, which is
+		/// assigned on insertion. This way, characters after an edit keep their vertices and only the
+		/// slots of characters that were laid out again need to be uploaded. Unused slots are zero and
+		/// are thus drawn as degenerate triangles.
+		std::vector<unsigned int> freeVertexSlots;
+		/// Number of slots that were handed out (including slots that are free again)
+		unsigned int vertexSlotCount;
+		/// If less than this fraction of the slots is used after an edit, the slots are compacted
+		static constexpr std::size_t minVertexSlotUsageDivisor = 4;
+		/// Slots are only compacted if there are at least this many
+		static constexpr std::size_t minCompactedVertexSlotCount = 256;
+		/// Number of vertices the vertex buffer on the GPU was created with
+		std::size_t meshVertexCount;
+		/// Width of the longest line in em. If the alignment is not LEFT and this changes, all lines move
+		double longestLineWidth;
+		/// Width and right border (in em) of every line, in the same order as the lines vector
+		std::vector<std::pair<double, double>> lineExtents;
+		/// The line extents of all lines that were measured, sorted by width. This way, the longest line
+		/// can be found after an edit without going through all lines
+		std::multiset<std::pair<double, double>> sortedLineExtents;
+		/// Lines that were laid out again during the last (incremental) layout
+		DirtyRangeList dirtyLineRanges;
+		/// Vertex ranges that changed since the last upload to the GPU
+		DirtyRangeList dirtyVertexRanges;
+		/// Vertex ranges that were uploaded to the GPU during the last call to uploadDirtyVertices()
+		DirtyRangeList uploadedVertexRanges;
+		/// If more vertex ranges are dirty, the bounding range is uploaded in a single call instead
+		static constexpr std::size_t maxVertexUploadsPerUpdate = 16;
 		/// index of the character which currently comes after the cursor
 		unsigned cursorPosIndex;
 		/// index of one end of a text selection. Text selection goes from selectionIndex to cursorPosIndex
@@ -206,18 +277,59 @@ namespace SnackerEngine
 		Model parseTextCharacters() override;
 		/// Constructs the model from the text member variable using parse mode 'WORD_BY_WORD'
 		Model parseTextWordByWord() override;
-		/// Constructs the model from the text member variable using parse mode 'CHARACTERS', starting at the line with the given index
-		Model parseTextCharactersFrom(const unsigned int& lineIndex);
-		/// Constructs the model from the text member variable using parse mode 'WORD_BY_WORD', starting at the line with the given index
-		Model parseTextWordByWordFrom(const unsigned int& lineIndex);
-		/// Constructs the model from the text member variable using parse mode 'SINGLE_LINE', starting at the line with the given index
-		Model parseTextSingleLineFrom(const unsigned int& lineIndex);
-		/// Constructs the model from the text member variable
+		/// Constructs the model from the text member variable using parse mode 'SINGLE_LINE'
+		Model parseTextSingleLine() override;
+		/// Lays out the characters again using parse mode 'CHARACTERS', starting at the line with the given index.
+		/// Stops as soon as a line after convergenceIndex starts at the same character as before, since all
+		/// following lines stay the same. Returns the range of lines that were laid out again
+		DirtyRange parseTextCharactersFrom(const unsigned int& lineIndex, const unsigned int& convergenceIndex);
+		/// Same as parseTextCharactersFrom(), but using parse mode 'WORD_BY_WORD'
+		DirtyRange parseTextWordByWordFrom(const unsigned int& lineIndex, const unsigned int& convergenceIndex);
+		/// Same as parseTextCharactersFrom(), but using parse mode 'SINGLE_LINE'. Never converges
+		DirtyRange parseTextSingleLineFrom(const unsigned int& lineIndex, const unsigned int& convergenceIndex);
+		/// Helper function for the parseTextXFrom() functions: Finalizes the lines vector after parsing. If the
+		/// line breaks converged, the remaining lines are taken over from previousLines, which stores the lines
+		/// of the previous layout starting at beginLineIndex. Returns the range of lines that were laid out again
+		DirtyRange finishLayoutFrom(const bool& converged, const std::vector<Line>& previousLines, const unsigned int& beginLineIndex);
+		/// Lays out the text again starting at the given line and updates the model. All lines are laid out
+		/// again, use this if parameters like the font size or the text width changed
 		void constructModelFrom(const unsigned int& lineIndex);
+		/// Lays out the text again starting at the given line and updates the model. Only the characters
+		/// before convergenceIndex were changed, which allows the layout to stop early
+		void constructModelFrom(const unsigned int& lineIndex, const unsigned int& convergenceIndex);
+		/// Returns a free vertex slot, growing the vertices vector if necessary
+		unsigned int allocateVertexSlot();
+		/// Marks the given vertex slot as free and sets its vertices to zero
+		void freeVertexSlot(const unsigned int& slot);
+		/// Assigns the vertex slots in character order, used after the text was laid out from scratch
+		void resetVertexSlots();
+		/// Assigns the vertex slots in character order and shrinks the vertices vector if most slots are
+		/// free, eg. after a large part of the text was deleted. Returns true if the slots were compacted
+		bool compactVertexSlots();
+		/// Removes the extents of the lines [beginLineIndex, endLineIndex) from sortedLineExtents. Has to be
+		/// called before these lines are laid out again or removed
+		void removeLineExtents(const unsigned int& beginLineIndex, const unsigned int& endLineIndex);
+		/// Measures the lines [beginLineIndex, endLineIndex), which were laid out again, and writes the
+		/// vertices of all their characters to their slots. If the longest line changed and the alignment
+		/// is not LEFT, all lines are written again. Also updates the right border. Does not need a GL context
+		void updateVertices(const unsigned int& beginLineIndex, const unsigned int& endLineIndex);
+		/// Writes the vertices of all characters in the given lines to their slots and marks them as dirty
+		void writeVertices(const DirtyRange& lineRange);
+		/// Creates a new model with a DYNAMIC vertex buffer from the vertices vector
+		Model createDynamicModel();
+		/// Uploads the dirty vertex ranges to the vertex buffer, or creates a new model if the vertex buffer is
+		/// too small
+		void uploadDirtyVertices();
 		/// Constructs the model from the text member variable
 		void constructModel() override;
 		/// Helper function to construct the text variable from the characters vector
 		void constructTextFromCharacters();
+		/// Inserts the given characters in front of the character with the given index in one go and
+		/// updates the indices stored in the lines vector accordingly. Does not recompute the model
+		void insertCharacters(const unsigned int& index, const std::vector<Character>& newCharacters);
+		/// Erases all characters in [beginIndex, endIndex] (inclusive) in one go and updates the lines
+		/// vector accordingly. Lines that are erased completely are removed. Does not recompute the model
+		void eraseCharacters(const unsigned int& beginIndex, const unsigned int& endIndex);
 		/// Helper function used in getSelectionBoxes(), which computes the selection box for two
 		/// characters [startCharacterIndex, endCharacterIndex] (inclusive) in the same line. 
 		SelectionBox computeSelectionBox(const unsigned& startCharacterIndex, const unsigned& endCharacterIndex, const unsigned& lineIndex);
@@ -284,6 +396,12 @@ namespace SnackerEngine
 		Vec2f getCursorSize() const;
 		float getCursorWidth() const;
 		float getCursorHeight() const;
+		/// Returns the lines that were laid out again during the last edit
+		const DirtyRangeList& getDirtyLineRanges() const;
+		/// Returns the vertex ranges that were uploaded to the GPU during the last edit
+		const DirtyRangeList& getUploadedVertexRanges() const;
+		/// Returns the number of vertex slots, including free slots
+		std::size_t getVertexSlotCapacity() const { return vertices.size() / 4; }
 		/// Returns the text
 		const std::string& getText() override;
 		/// Returns the text between the given two inclusive bounds
@@ -0,0 +1,70 @@
+#include "Gui/Text/TextLayoutCache.h"
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	std::size_t TextLayoutKeyHash::operator()(const TextLayoutKey& key) const
+	{
+		std::size_t hash = std::hash<std::string>()(key.text);
+		const auto combine = [&hash](const std::size_t& value) {
+			hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+		};
+		combine(std::hash<unsigned int>()(key.fontID));
+		combine(std::hash<double>()(key.fontSize));
+		combine(std::hash<double>()(key.lineHeightMultiplier));
+		combine(std::hash<double>()(key.textWidth));
+		combine(std::hash<unsigned int>()(static_cast<unsigned int>(key.parseMode)));
+		combine(std::hash<unsigned int>()(static_cast<unsigned int>(key.alignment)));
+		return hash;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void TextLayoutCache::evict(const std::size_t& maxSize)
+	{
+		while (layouts.size() > maxSize && !lruList.empty()) {
+			layouts.erase(*lruList.back());
+			lruList.pop_back();
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	const TextLayoutCache::TextLayout* TextLayoutCache::find(const TextLayoutKey& key)
+	{
+		auto it = layouts.find(key);
+		if (it == layouts.end()) {
+			missCount++;
+			return nullptr;
+		}
+		hitCount++;
+		// Move to the front of the LRU list
+		lruList.splice(lruList.begin(), lruList, it->second.lruPosition);
+		return &it->second.layout;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void TextLayoutCache::insert(const TextLayoutKey& key, TextLayout&& layout)
+	{
+		if (!isCacheable(key)) return;
+		auto it = layouts.find(key);
+		if (it != layouts.end()) {
+			it->second.layout = std::move(layout);
+			lruList.splice(lruList.begin(), lruList, it->second.lruPosition);
+			return;
+		}
+		evict(capacity - 1);
+		// The keys of an unordered_map don't move, so we can store pointers to them
+		it = layouts.emplace(key, Entry{ std::move(layout), {} }).first;
+		lruList.push_front(&it->first);
+		it->second.lruPosition = lruList.begin();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void TextLayoutCache::clear()
+	{
+		lruList.clear();
+		layouts.clear();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void TextLayoutCache::setCapacity(const std::size_t& capacity)
+	{
+		TextLayoutCache::capacity = capacity;
+		evict(capacity);
+	}
+	//--------------------------------------------------------------------------------------------------
+}
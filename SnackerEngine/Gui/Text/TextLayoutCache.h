@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Gui/Text/Text.h"
+
+#include <list>
+#include <unordered_map>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// Key of a cached text layout. Contains everything that changes the layout of a text
+	struct TextLayoutKey
+	{
+		std::string text;
+		unsigned int fontID;
+		double fontSize;
+		double lineHeightMultiplier;
+		double textWidth;
+		StaticText::ParseMode parseMode;
+		AlignmentHorizontal alignment;
+		bool operator==(const TextLayoutKey& other) const = default;
+	};
+	//--------------------------------------------------------------------------------------------------
+	/// Hash function for TextLayoutKey
+	struct TextLayoutKeyHash
+	{
+		std::size_t operator()(const TextLayoutKey& key) const;
+	};
+	//--------------------------------------------------------------------------------------------------
+	/// Content addressed cache of text layouts. Many texts (labels, numbers, menu items, ...) have the
+	/// same contents and parameters. Instead of parsing them again and creating a new mesh for each one,
+	/// they share the layout and the (reference counted) model.
+	/// The least recently used layouts are evicted once the capacity is reached. Layouts containing
+	/// placeholders for glyphs that are still generated in the background are not cached.
+	/// Note that this is a fully static class that cannot be constructed
+	class TextLayoutCache
+	{
+	public:
+		/// A cached layout
+		struct TextLayout
+		{
+			/// The font is stored such that its FontID can't be reused by a different font while the layout is cached
+			Font font;
+			/// The shared model
+			Model model;
+			/// Characters and lines, as computed by the parser
+			std::vector<StaticText::Character> characters;
+			std::vector<StaticText::Line> lines;
+			/// The right border of the text, in pt
+			double right;
+		};
+	private:
+		/// Entry of the cache
+		struct Entry
+		{
+			TextLayout layout;
+			/// Position of the key in the lruList
+			std::list<const TextLayoutKey*>::iterator lruPosition;
+		};
+		/// The cached layouts
+		inline static std::unordered_map<TextLayoutKey, Entry, TextLayoutKeyHash> layouts{};
+		/// Pointers to the keys of all cached layouts, the most recently used layout is at the front
+		inline static std::list<const TextLayoutKey*> lruList{};
+		/// Maximum number of cached layouts
+		inline static std::size_t capacity = 512;
+		/// Texts with more bytes than this are not cached (eg. long EditableTexts)
+		inline static std::size_t maxTextLength = 1024;
+		/// Statistics
+		inline static std::size_t hitCount = 0;
+		inline static std::size_t missCount = 0;
+		/// Removes the least recently used layouts until there are at most maxSize layouts
+		static void evict(const std::size_t& maxSize);
+	public:
+		/// Deleted constructor: this is a static class!
+		TextLayoutCache() = delete;
+		/// Returns true if texts with the given key should be cached
+		static bool isCacheable(const TextLayoutKey& key) { return capacity > 0 && key.text.size() <= maxTextLength; }
+		/// Returns the cached layout with the given key, or nullptr if there is none. The returned pointer is
+		/// only valid until the next call to insert()
+		static const TextLayout* find(const TextLayoutKey& key);
+		/// Stores the given layout. If the cache is full, the least recently used layout is evicted
+		static void insert(const TextLayoutKey& key, TextLayout&& layout);
+		/// Removes all layouts. Has to be called before the managers are terminated, since the cache
+		/// holds references to models and fonts
+		static void clear();
+		/// Sets the maximum number of cached layouts. Setting it to zero disables the cache
+		static void setCapacity(const std::size_t& capacity);
+		static std::size_t getCapacity() { return capacity; }
+		/// Sets the maximum length (in bytes) of texts that are cached
+		static void setMaxTextLength(const std::size_t& maxTextLength) { TextLayoutCache::maxTextLength = maxTextLength; }
+		/// Returns the number of cached layouts
+		static std::size_t getSize() { return layouts.size(); }
+		/// Returns the number of successful and unsuccessful calls to find()
+		static std::size_t getHitCount() { return hitCount; }
+		static std::size_t getMissCount() { return missCount; }
+	};
+	//--------------------------------------------------------------------------------------------------
+}
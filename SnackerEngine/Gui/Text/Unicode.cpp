@@ -1,5 +1,14 @@
 #include "Gui/Text/Unicode.h"
 #include <vector>
+#include <bit>
+#include <cstring>
+#include <cstdint>
+
+// SSE2 is always available on x64
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SNACKER_ENGINE_UNICODE_SSE2
+#endif
 
 namespace SnackerEngine
 {
@@ -38,61 +47,159 @@ namespace SnackerEngine
 	}
 	*/
 	//--------------------------------------------------------------------------------------------------
-	std::string encodeUTF8(const std::vector<Unicode>& codepoints)
+	namespace
 	{
-		std::vector<char> chars;
-		for (const auto& codepoint : codepoints)
+		/// Returns the number of ASCII bytes at the start of the given range. Checks 16 (or 8) bytes at a time
+		std::size_t countLeadingASCII(const unsigned char* begin, const unsigned char* end)
 		{
-			if (codepoint < 128) {
-				// one UTF8 character
-				chars.push_back(static_cast<char>(codepoint));
+			const unsigned char* c = begin;
+#ifdef SNACKER_ENGINE_UNICODE_SSE2
+			while (end - c >= 16) {
+				const int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(c)));
+				if (mask != 0) return (c - begin) + std::countr_zero(static_cast<unsigned int>(mask));
+				c += 16;
+			}
+#else
+			while (end - c >= 8) {
+				std::uint64_t chunk;
+				std::memcpy(&chunk, c, 8);
+				if (chunk & 0x8080808080808080ull) break;
+				c += 8;
 			}
-			else if (codepoint < 2048) {
-				// two UTF8 characters
-				chars.push_back(static_cast<char>(0b11000000) | static_cast<char>((0b11111000000 & codepoint) >> 6));
-				chars.push_back(static_cast<char>(0b10000000) | static_cast<char>(0b111111 & codepoint));
+#endif
+			while (c < end && *c < 0x80) ++c;
+			return c - begin;
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	std::size_t decodeUTF8(std::string_view text, std::vector<Unicode>& codepoints)
+	{
+		const unsigned char* const begin = reinterpret_cast<const unsigned char*>(text.data());
+		const unsigned char* const end = begin + text.size();
+		// Every byte produces at most one codepoint
+		const std::size_t offset = codepoints.size();
+		codepoints.resize(offset + text.size());
+		Unicode* out = codepoints.data() + offset;
+		const unsigned char* c = begin;
+		while (c < end) {
+#ifdef SNACKER_ENGINE_UNICODE_SSE2
+			// ASCII fast path: Widen 16 bytes at a time to 32 bit codepoints
+			const __m128i zero = _mm_setzero_si128();
+			while (end - c >= 16) {
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c));
+				const int mask = _mm_movemask_epi8(chunk);
+				if (mask != 0) {
+					// Copy the ASCII prefix of the chunk
+					const unsigned int asciiCount = std::countr_zero(static_cast<unsigned int>(mask));
+					for (unsigned int i = 0; i < asciiCount; ++i) *out++ = *c++;
+					break;
+				}
+				const __m128i low = _mm_unpacklo_epi8(chunk, zero);
+				const __m128i high = _mm_unpackhi_epi8(chunk, zero);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(low, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(low, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16(high, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(high, zero));
+				c += 16;
+				out += 16;
 			}
-			else if (codepoint < 65536) {
-				// three UTF8 characters
-				chars.push_back(static_cast<char>(0b11100000) | static_cast<char>((0b1111000000000000 & codepoint) >> 12));
-				chars.push_back(static_cast<char>(0b10000000) | static_cast<char>((0b111111000000 & codepoint) >> 6));
-				chars.push_back(static_cast<char>(0b10000000) | static_cast<char>(0b111111 & codepoint));
+			if (c == end) break;
+#endif
+			// Scalar path: decode until the next ASCII character, since non-latin scripts rarely
+			// contain ASCII characters other than spaces and punctuation
+			do {
+				Unicode codepoint;
+				const unsigned int length = decodeCodepointUTF8(c, static_cast<std::size_t>(end - c), codepoint);
+				if (length == 0) {
+					codepoints.resize(out - codepoints.data());
+					return c - begin;
+				}
+				*out++ = codepoint;
+				c += length;
+			} while (c < end && *c >= 0x80);
+		}
+		codepoints.resize(out - codepoints.data());
+		return c - begin;
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool isValidUTF8(std::string_view text)
+	{
+		const unsigned char* c = reinterpret_cast<const unsigned char*>(text.data());
+		const unsigned char* const end = c + text.size();
+		while (c < end) {
+			c += countLeadingASCII(c, end);
+			// Validate the non-ASCII run
+			while (c < end && *c >= 0x80) {
+				Unicode codepoint;
+				const unsigned int length = decodeCodepointUTF8(c, static_cast<std::size_t>(end - c), codepoint);
+				if (length == 0) return false;
+				c += length;
 			}
-			else {
-				// four UTF8 characters
-				chars.push_back(static_cast<char>(0b11100000) | static_cast<char>((0b111000000000000000000 & codepoint) >> 18));
-				chars.push_back(static_cast<char>(0b10000000) | static_cast<char>((0b111111000000000000 & codepoint) >> 12));
-				chars.push_back(static_cast<char>(0b10000000) | static_cast<char>((0b111111000000 & codepoint) >> 6));
-				chars.push_back(static_cast<char>(0b10000000) | static_cast<char>(0b111111 & codepoint));
+		}
+		return true;
+	}
+	//--------------------------------------------------------------------------------------------------
+	std::string encodeUTF8(const std::vector<Unicode>& codepoints)
+	{
+		std::string result;
+		encodeUTF8(codepoints.data(), codepoints.size(), result);
+		return result;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void encodeUTF8(const Unicode* codepoints, const std::size_t& count, std::string& textUTF8)
+	{
+		// Compute the final size first, such that the string is only resized once
+		std::size_t length = 0;
+		for (std::size_t i = 0; i < count; ++i) length += getLengthUTF8(codepoints[i]);
+		const std::size_t offset = textUTF8.size();
+		textUTF8.resize(offset + length);
+		char* out = textUTF8.data() + offset;
+		std::size_t i = 0;
+		while (i < count) {
+#ifdef SNACKER_ENGINE_UNICODE_SSE2
+			// ASCII fast path: Narrow 16 codepoints at a time. All values are below 0x80, so the
+			// saturating packs don't change them
+			while (count - i >= 16) {
+				const __m128i* in = reinterpret_cast<const __m128i*>(codepoints + i);
+				const __m128i a = _mm_loadu_si128(in);
+				const __m128i b = _mm_loadu_si128(in + 1);
+				const __m128i c = _mm_loadu_si128(in + 2);
+				const __m128i d = _mm_loadu_si128(in + 3);
+				const __m128i nonASCII = _mm_set1_epi32(~0x7F);
+				const __m128i combined = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), nonASCII);
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(combined, _mm_setzero_si128())) != 0xFFFF) break;
+				const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), packed);
+				i += 16;
+				out += 16;
 			}
+			if (i == count) break;
+#endif
+			// Scalar path: encode until the next ASCII character
+			do {
+				out = writeCodepointUTF8(out, codepoints[i]);
+				++i;
+			} while (i < count && codepoints[i] >= 0x80);
 		}
-		return std::string(chars.begin(), chars.end());
 	}
 	//--------------------------------------------------------------------------------------------------
 	void appendUnicodeCharacter(std::vector<char>& charsUTF8, const Unicode& codepoint)
 	{
-		if (codepoint < 128) {
+		char buffer[4];
+		const char* end = writeCodepointUTF8(buffer, codepoint);
+		charsUTF8.insert(charsUTF8.end(), static_cast<const char*>(buffer), end);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void appendUnicodeCharacter(std::string& textUTF8, const Unicode& codepoint)
+	{
+		if (codepoint < 0x80) {
 			// one UTF8 character
-			charsUTF8.push_back(static_cast<char>(codepoint));
-		}
-		else if (codepoint < 2048) {
-			// two UTF8 characters
-			charsUTF8.push_back(static_cast<char>(0b11000000) | static_cast<char>((0b11111000000 & codepoint) >> 6));
-			charsUTF8.push_back(static_cast<char>(0b10000000) | static_cast<char>(0b111111 & codepoint));
-		}
-		else if (codepoint < 65536) {
-			// three UTF8 characters
-			charsUTF8.push_back(static_cast<char>(0b11100000) | static_cast<char>((0b1111000000000000 & codepoint) >> 12));
-			charsUTF8.push_back(static_cast<char>(0b10000000) | static_cast<char>((0b111111000000 & codepoint) >> 6));
-			charsUTF8.push_back(static_cast<char>(0b10000000) | static_cast<char>(0b111111 & codepoint));
-		}
-		else {
-			// four UTF8 characters
-			charsUTF8.push_back(static_cast<char>(0b11100000) | static_cast<char>((0b111000000000000000000 & codepoint) >> 18));
-			charsUTF8.push_back(static_cast<char>(0b10000000) | static_cast<char>((0b111111000000000000 & codepoint) >> 12));
-			charsUTF8.push_back(static_cast<char>(0b10000000) | static_cast<char>((0b111111000000 & codepoint) >> 6));
-			charsUTF8.push_back(static_cast<char>(0b10000000) | static_cast<char>(0b111111 & codepoint));
+			textUTF8.push_back(static_cast<char>(codepoint));
+			return;
 		}
+		char buffer[4];
+		const char* end = writeCodepointUTF8(buffer, codepoint);
+		textUTF8.append(buffer, static_cast<std::size_t>(end - buffer));
 	}
 	//--------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
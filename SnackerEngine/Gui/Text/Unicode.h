@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <vector>
 #include <cwctype>
@@ -11,40 +12,67 @@ namespace SnackerEngine
 	//--------------------------------------------------------------------------------------------------
 	using Unicode = unsigned int;
 	//--------------------------------------------------------------------------------------------------
-	/// Helper function that returns the next codepoint and advances the position.
-	/// The string should be encoded in UTF8 format
-	inline std::optional<Unicode> getNextCodepointUTF8(const std::string& text, unsigned int& position)
+	/// Decodes a single UTF8 encoded codepoint starting at c, where remaining is the number of bytes that
+	/// can be read. Returns the length of the sequence in bytes, or zero if the sequence is invalid
+	/// (unexpected or missing continuation bytes, overlong encodings, surrogates and codepoints above U+10FFFF)
+	inline unsigned int decodeCodepointUTF8(const unsigned char* c, const std::size_t& remaining, Unicode& codepoint)
 	{
-		const char* c = &text.at(position);
-		if (!(*c & 0b10000000)) {
-			position++;
-			return static_cast<Unicode>(*c & 0b01111111);
+		if (c[0] < 0x80) {
+			codepoint = c[0];
+			return 1;
 		}
-		// At least two chars
-		if ((*c & 0b11100000) == 0b11000000) {
-			position += 2;
-			return (static_cast<Unicode>(*c & 0b00011111) << 6) |
-				static_cast<Unicode>(*(c + 1) & 0b00111111);
+		// Continuation bytes can't start a sequence, 0xC0 and 0xC1 would be overlong
+		if (c[0] < 0xC2) return 0;
+		if (c[0] < 0xE0) {
+			if (remaining < 2 || (c[1] & 0xC0) != 0x80) return 0;
+			codepoint = (static_cast<Unicode>(c[0] & 0x1F) << 6) |
+				static_cast<Unicode>(c[1] & 0x3F);
+			return 2;
 		}
-		// At least three chars
-		if ((*c & 0b11110000) == 0b11100000) {
-			position += 3;
-			return (static_cast<Unicode>(*c & 0b00001111) << 11) |
-				(static_cast<Unicode>(*(c + 1) & 0b00111111) << 6) |
-				static_cast<Unicode>(*(c + 2) & 0b00111111);
+		if (c[0] < 0xF0) {
+			if (remaining < 3 || (c[1] & 0xC0) != 0x80 || (c[2] & 0xC0) != 0x80) return 0;
+			codepoint = (static_cast<Unicode>(c[0] & 0x0F) << 12) |
+				(static_cast<Unicode>(c[1] & 0x3F) << 6) |
+				static_cast<Unicode>(c[2] & 0x3F);
+			if (codepoint < 0x800 || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) return 0;
+			return 3;
 		}
-		// Four chars
-		if ((*c & 0b11111000) == 0b11110000) {
-			position += 4;
-			return (static_cast<Unicode>(*c & 0b00000111) << 15) |
-				(static_cast<Unicode>(*(c + 1) & 0b00111111) << 12) |
-				(static_cast<Unicode>(*(c + 2) & 0b00111111) << 6) |
-				static_cast<Unicode>(*(c + 3) & 0b00111111);
+		if (c[0] < 0xF5) {
+			if (remaining < 4 || (c[1] & 0xC0) != 0x80 || (c[2] & 0xC0) != 0x80 || (c[3] & 0xC0) != 0x80) return 0;
+			codepoint = (static_cast<Unicode>(c[0] & 0x07) << 18) |
+				(static_cast<Unicode>(c[1] & 0x3F) << 12) |
+				(static_cast<Unicode>(c[2] & 0x3F) << 6) |
+				static_cast<Unicode>(c[3] & 0x3F);
+			if (codepoint < 0x10000 || codepoint > 0x10FFFF) return 0;
+			return 4;
 		}
+		return 0;
+	}
+	//--------------------------------------------------------------------------------------------------
+	/// Helper function that returns the next codepoint and advances the position.
+	/// The string should be encoded in UTF8 format. Returns an empty optional if the position is
+	/// out of range or the sequence at the position is invalid. For decoding whole texts, use decodeUTF8()
+	inline std::optional<Unicode> getNextCodepointUTF8(const std::string& text, unsigned int& position)
+	{
+		if (position >= text.size()) return {};
+		Unicode codepoint;
+		const unsigned int length = decodeCodepointUTF8(reinterpret_cast<const unsigned char*>(text.data()) + position, text.size() - position, codepoint);
 		// Invalid Codepoint
-		return {};
+		if (length == 0) return {};
+		position += length;
+		return codepoint;
 	}
 	//--------------------------------------------------------------------------------------------------
+	/// Decodes the given UTF8 encoded text and appends the codepoints to the given buffer. The buffer
+	/// can be reused between calls, such that no allocations are necessary once it is large enough.
+	/// Runs of ASCII characters are decoded 16 bytes at a time. Decoding stops at the first invalid
+	/// sequence (see decodeCodepointUTF8()). Returns the number of bytes that were decoded, which is
+	/// text.size() if the whole text is valid
+	std::size_t decodeUTF8(std::string_view text, std::vector<Unicode>& codepoints);
+	//--------------------------------------------------------------------------------------------------
+	/// Returns true if the given text is valid UTF8. ASCII runs are checked 16 bytes at a time
+	bool isValidUTF8(std::string_view text);
+	//--------------------------------------------------------------------------------------------------
 	/// Helper function that returns true if the given codepoint is considered a whitespace character
 	inline bool isWhiteSpace(const Unicode& codepoint)
 	{
@@ -81,8 +109,50 @@ namespace SnackerEngine
 	/// Converts a vector of unciode characters to an UTF8 encoded string
 	std::string encodeUTF8(const std::vector<Unicode>& codepoints);
 	//--------------------------------------------------------------------------------------------------
+	/// Appends the UTF8 representation of the given codepoints to the given string. The string is resized
+	/// only once, and runs of ASCII characters are encoded 16 codepoints at a time
+	void encodeUTF8(const Unicode* codepoints, const std::size_t& count, std::string& textUTF8);
+	//--------------------------------------------------------------------------------------------------
+	/// Returns the number of bytes of the UTF8 representation of the given codepoint. Codepoints
+	/// above U+10FFFF are encoded as the replacement character U+FFFD
+	inline unsigned int getLengthUTF8(const Unicode& codepoint)
+	{
+		if (codepoint < 0x80) return 1;
+		if (codepoint < 0x800) return 2;
+		if (codepoint < 0x10000 || codepoint > 0x10FFFF) return 3;
+		return 4;
+	}
+	//--------------------------------------------------------------------------------------------------
+	/// Writes the UTF8 representation of the given codepoint to dest, which needs space for
+	/// getLengthUTF8(codepoint) bytes. Returns a pointer to the byte after the written bytes
+	inline char* writeCodepointUTF8(char* dest, Unicode codepoint)
+	{
+		if (codepoint < 0x80) {
+			*dest++ = static_cast<char>(codepoint);
+		}
+		else if (codepoint < 0x800) {
+			*dest++ = static_cast<char>(0xC0 | (codepoint >> 6));
+			*dest++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+		}
+		else if (codepoint < 0x10000 || codepoint > 0x10FFFF) {
+			if (codepoint > 0x10FFFF) codepoint = 0xFFFD;
+			*dest++ = static_cast<char>(0xE0 | (codepoint >> 12));
+			*dest++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+			*dest++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+		}
+		else {
+			*dest++ = static_cast<char>(0xF0 | (codepoint >> 18));
+			*dest++ = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+			*dest++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+			*dest++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+		}
+		return dest;
+	}
+	//--------------------------------------------------------------------------------------------------
 	/// Appends the UTF8 representation of the given codepoint to the chars vector
 	void appendUnicodeCharacter(std::vector<char>& charsUTF8, const Unicode& codepoint);
+	/// Appends the UTF8 representation of the given codepoint to the given string
+	void appendUnicodeCharacter(std::string& textUTF8, const Unicode& codepoint);
 	//--------------------------------------------------------------------------------------------------
 	/// Returns true if the given unicode character is an alphabetic character
 	inline bool isAlpha(const Unicode& codepoint) 
@@ -0,0 +1,246 @@
+#include "Gui/Text/VirtualizedText.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::splitParagraphs(std::size_t begin)
+	{
+		while (true) {
+			std::size_t end = text.find('\n', begin);
+			if (end == std::string::npos) end = text.size();
+			paragraphs.push_back({ begin, end, false, nullptr });
+			lineCounts.push_back(estimateLineCount(paragraphs.back()));
+			if (end == text.size()) break;
+			begin = end + 1;
+		}
+	}
+	//--------------------------------------------------------------------------------------------------
+	unsigned int VirtualizedText::estimateLineCount(const Paragraph& paragraph) const
+	{
+		const std::size_t bytes = paragraph.end - paragraph.begin;
+		if (bytes == 0 || parseMode == StaticText::ParseMode::SINGLE_LINE || textWidth <= 0.0 || measuredBytes == 0) return 1;
+		// Assume that the paragraph wraps like the paragraphs that were already laid out
+		const double bytesPerLine = static_cast<double>(measuredBytes) / static_cast<double>(measuredLines);
+		return std::max(1u, static_cast<unsigned int>(std::ceil(static_cast<double>(bytes) / bytesPerLine)));
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::layoutParagraph(const std::size_t& index)
+	{
+		Paragraph& paragraph = paragraphs[index];
+		unsigned int lineCount = 1;
+		if (paragraph.end > paragraph.begin) {
+			if (!paragraph.text) {
+				paragraph.text = std::make_unique<DynamicText>(text.substr(paragraph.begin, paragraph.end - paragraph.begin),
+					font, fontSize, textWidth, lineHeightMultiplier, parseMode, alignment);
+			}
+			else {
+				paragraph.text->recompute();
+			}
+			lineCount = std::max(1u, static_cast<unsigned int>(paragraph.text->getNumLines()));
+		}
+		if (!paragraph.measured) {
+			paragraph.measured = true;
+			measuredBytes += paragraph.end - paragraph.begin;
+			measuredLines += lineCount;
+		}
+		if (lineCounts[index] != lineCount) lineCounts.set(index, lineCount);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::invalidateLayout()
+	{
+		measuredBytes = 0;
+		measuredLines = 0;
+		std::vector<unsigned int> estimates;
+		estimates.reserve(paragraphs.size());
+		for (auto& paragraph : paragraphs) {
+			paragraph.text = nullptr;
+			paragraph.measured = false;
+			estimates.push_back(estimateLineCount(paragraph));
+		}
+		lineCounts.assign(estimates);
+		visibleBegin = 0;
+		visibleEnd = 0;
+	}
+	//--------------------------------------------------------------------------------------------------
+	VirtualizedText::VirtualizedText(const std::string& text, const Font& font, const double& fontSize, const double& textWidth, double lineHeightMultiplier, const StaticText::ParseMode& parseMode, AlignmentHorizontal alignment)
+		: text(text), font(font), fontSize(fontSize), textWidth(textWidth), lineHeightMultiplier(lineHeightMultiplier), parseMode(parseMode), alignment(alignment)
+	{
+		splitParagraphs(0);
+	}
+	//--------------------------------------------------------------------------------------------------
+	double VirtualizedText::getLineHeight() const
+	{
+		return font.getLineHeight() * lineHeightMultiplier * fontSize;
+	}
+	//--------------------------------------------------------------------------------------------------
+	double VirtualizedText::getTop() const
+	{
+		return font.getAscender() * fontSize;
+	}
+	//--------------------------------------------------------------------------------------------------
+	double VirtualizedText::getBottom() const
+	{
+		return getBaseline(std::max(getNumLines(), 1u) - 1) + font.getDescender() * fontSize;
+	}
+	//--------------------------------------------------------------------------------------------------
+	double VirtualizedText::getBaseline(const unsigned int& lineIndex) const
+	{
+		return -static_cast<double>(lineIndex) * getLineHeight();
+	}
+	//--------------------------------------------------------------------------------------------------
+	unsigned int VirtualizedText::getLineIndex(const double& y) const
+	{
+		// Same rule as in EditableText::computeCursorPosFromMousePos(): The line at y is the first line
+		// whose descender is below y
+		const double lineHeight = getLineHeight();
+		const unsigned int lineCount = getNumLines();
+		if (lineHeight <= 0.0 || lineCount == 0) return 0;
+		const double lineIndex = std::ceil((font.getDescender() * fontSize - y) / lineHeight);
+		if (lineIndex <= 0.0) return 0;
+		return static_cast<unsigned int>(std::min(lineIndex, static_cast<double>(lineCount - 1)));
+	}
+	//--------------------------------------------------------------------------------------------------
+	std::size_t VirtualizedText::getParagraphIndex(const unsigned int& lineIndex) const
+	{
+		if (paragraphs.empty()) return 0;
+		return std::min(lineCounts.find(lineIndex), paragraphs.size() - 1);
+	}
+	//--------------------------------------------------------------------------------------------------
+	std::pair<std::size_t, std::size_t> VirtualizedText::getParagraphRange(const std::size_t& paragraphIndex) const
+	{
+		if (paragraphIndex >= paragraphs.size()) return std::make_pair(text.size(), text.size());
+		return std::make_pair(paragraphs[paragraphIndex].begin, paragraphs[paragraphIndex].end);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::setText(const std::string& text)
+	{
+		this->text = text;
+		paragraphs.clear();
+		lineCounts.clear();
+		measuredBytes = 0;
+		measuredLines = 0;
+		visibleBegin = 0;
+		visibleEnd = 0;
+		splitParagraphs(0);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::appendText(const std::string& text)
+	{
+		if (text.empty()) return;
+		if (paragraphs.empty()) {
+			// Default constructed texts don't have a paragraph yet
+			this->text += text;
+			splitParagraphs(0);
+			return;
+		}
+		// The last paragraph continues with the new text
+		const std::size_t lastIndex = paragraphs.size() - 1;
+		Paragraph& last = paragraphs[lastIndex];
+		if (last.measured) {
+			measuredBytes -= last.end - last.begin;
+			measuredLines -= lineCounts[lastIndex];
+		}
+		const std::size_t begin = last.begin;
+		paragraphs.pop_back();
+		lineCounts.truncate(lastIndex);
+		visibleEnd = std::min(visibleEnd, paragraphs.size());
+		visibleBegin = std::min(visibleBegin, visibleEnd);
+		this->text += text;
+		splitParagraphs(begin);
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::setFont(const Font& font)
+	{
+		this->font = font;
+		invalidateLayout();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::setFontSize(const double& fontSize)
+	{
+		if (this->fontSize == fontSize) return;
+		this->fontSize = fontSize;
+		invalidateLayout();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::setTextWidth(const double& textWidth)
+	{
+		if (this->textWidth == textWidth) return;
+		this->textWidth = textWidth;
+		// In single line mode the line breaks don't depend on the text width
+		if (parseMode != StaticText::ParseMode::SINGLE_LINE) invalidateLayout();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::setLineHeightMultiplier(double lineHeightMultiplier)
+	{
+		if (this->lineHeightMultiplier == lineHeightMultiplier) return;
+		this->lineHeightMultiplier = lineHeightMultiplier;
+		invalidateLayout();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::setParseMode(const StaticText::ParseMode& parseMode)
+	{
+		if (this->parseMode == parseMode) return;
+		this->parseMode = parseMode;
+		invalidateLayout();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::setAlignment(AlignmentHorizontal alignment)
+	{
+		if (this->alignment == alignment) return;
+		this->alignment = alignment;
+		invalidateLayout();
+	}
+	//--------------------------------------------------------------------------------------------------
+	void VirtualizedText::setVisibleRange(const double& top, const double& bottom)
+	{
+		if (paragraphs.empty()) return;
+		// Find the first and last visible line, including the margin
+		const unsigned int firstLine = getLineIndex(top);
+		const unsigned int lastLine = getLineIndex(bottom);
+		std::size_t begin = getParagraphIndex(firstLine > marginLines ? firstLine - marginLines : 0);
+		// Laying out a paragraph may change its line count and move the following paragraphs,
+		// so the end of the window is found while laying out
+		const unsigned int endLine = lastLine + marginLines + 1;
+		std::size_t end = begin;
+		while (end < paragraphs.size() && getFirstLine(end) < endLine) {
+			const Paragraph& paragraph = paragraphs[end];
+			const bool hasModel = paragraph.text || paragraph.end == paragraph.begin;
+			// Glyphs that were generated in the background may be available now
+			if (!paragraph.measured || !hasModel || (paragraph.text && paragraph.text->hasOutdatedGlyphs())) layoutParagraph(end);
+			++end;
+		}
+		// Release the models of all paragraphs that left the window
+		for (std::size_t i = visibleBegin; i < visibleEnd; ++i) {
+			if (i < begin || i >= end) paragraphs[i].text = nullptr;
+		}
+		visibleBegin = begin;
+		visibleEnd = end;
+	}
+	//--------------------------------------------------------------------------------------------------
+	std::vector<VirtualizedText::VisibleParagraph> VirtualizedText::getVisibleParagraphs() const
+	{
+		std::vector<VisibleParagraph> result;
+		if (visibleBegin >= visibleEnd) return result;
+		const double lineHeight = getLineHeight();
+		unsigned int firstLine = getFirstLine(visibleBegin);
+		for (std::size_t i = visibleBegin; i < visibleEnd; ++i) {
+			const Paragraph& paragraph = paragraphs[i];
+			if (paragraph.text) {
+				// Align the paragraph inside the text width
+				double offsetX = 0.0;
+				if (textWidth > 0.0) {
+					const double paragraphWidth = paragraph.text->getRight() - paragraph.text->getLeft();
+					if (alignment == AlignmentHorizontal::CENTER) offsetX = (textWidth - paragraphWidth) / 2.0;
+					else if (alignment == AlignmentHorizontal::RIGHT) offsetX = textWidth - paragraphWidth;
+				}
+				result.push_back({ paragraph.text.get(), firstLine, Vec2d(offsetX, -static_cast<double>(firstLine) * lineHeight) });
+			}
+			firstLine += lineCounts[i];
+		}
+		return result;
+	}
+	//--------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Gui/Text/Text.h"
+#include "Utility\PrefixSumTree.h"
+
+#include <memory>
+#include <vector>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// Text that is laid out lazily, which is meant for very long texts (eg. log viewers with hundreds
+	/// of thousands of lines) of which only a small window is visible at a time.
+	/// The text is split into paragraphs at newline characters. A paragraph is only laid out (and its
+	/// model created) when it comes into the visible window (see setVisibleRange()). Models of paragraphs
+	/// that leave the window (plus a margin) are released again. Paragraphs that were never laid out
+	/// use an estimated number of lines. The number of lines of each paragraph is stored in a prefix
+	/// sum tree, such that the paragraph at a given height can be found in O(log n).
+	/// All lines have the same height, the coordinates are the same as for DynamicText: y = 0 is the
+	/// baseline of the first line, and the y axis points up
+	class VirtualizedText
+	{
+	public:
+		/// A paragraph with a model, as returned by getVisibleParagraphs()
+		struct VisibleParagraph
+		{
+			/// The laid out text of the paragraph
+			const DynamicText* text;
+			/// Index of the first line of the paragraph in the whole text
+			unsigned int firstLine;
+			/// Offset of the paragraph in pt. The y coordinate is the baseline of its first line, the
+			/// x coordinate is the offset due to the horizontal alignment
+			Vec2d offset;
+		};
+	private:
+		/// A paragraph of the text, without the trailing newline
+		struct Paragraph
+		{
+			/// Range [begin, end) of the paragraph in the text, in bytes
+			std::size_t begin;
+			std::size_t end;
+			/// Set to true once the paragraph was laid out and its line count is exact
+			bool measured;
+			/// The laid out paragraph, nullptr if the paragraph is not in the visible window
+			std::unique_ptr<DynamicText> text;
+		};
+		/// The whole text
+		std::string text{};
+		/// Text parameters, same as for DynamicText
+		Font font{};
+		double fontSize = 0.0;
+		double textWidth = 0.0;
+		double lineHeightMultiplier = 1.0;
+		StaticText::ParseMode parseMode = StaticText::ParseMode::WORD_BY_WORD;
+		AlignmentHorizontal alignment = AlignmentHorizontal::LEFT;
+		/// All paragraphs, in order
+		std::vector<Paragraph> paragraphs{};
+		/// Number of lines of each paragraph (exact or estimated)
+		PrefixSumTree<unsigned int> lineCounts{};
+		/// Total bytes and lines of all measured paragraphs, used to estimate the line count of the others
+		std::size_t measuredBytes = 0;
+		std::size_t measuredLines = 0;
+		/// Range [visibleBegin, visibleEnd) of paragraphs that currently have a model
+		std::size_t visibleBegin = 0;
+		std::size_t visibleEnd = 0;
+		/// Number of lines above and below the visible window that are laid out in advance
+		unsigned int marginLines = 32;
+		/// Splits the text starting at the given byte offset into paragraphs and appends them
+		void splitParagraphs(std::size_t begin);
+		/// Returns the estimated number of lines of a paragraph that was not laid out yet
+		unsigned int estimateLineCount(const Paragraph& paragraph) const;
+		/// Lays out the paragraph with the given index and updates its line count
+		void layoutParagraph(const std::size_t& index);
+		/// Releases the models of all paragraphs and resets all line counts to estimates. Should be
+		/// called when a parameter changes that influences the layout
+		void invalidateLayout();
+	public:
+		/// Default constructor
+		VirtualizedText() = default;
+		/// Constructor using a string and various parameters, see DynamicText
+		VirtualizedText(const std::string& text, const Font& font, const double& fontSize, const double& textWidth, double lineHeightMultiplier = 1.0, const StaticText::ParseMode& parseMode = StaticText::ParseMode::WORD_BY_WORD, AlignmentHorizontal alignment = AlignmentHorizontal::LEFT);
+		/// Move constructor and assignment operator
+		VirtualizedText(VirtualizedText&& other) noexcept = default;
+		VirtualizedText& operator=(VirtualizedText&& other) noexcept = default;
+		/// Getters
+		const std::string& getText() const { return text; }
+		const Font& getFont() const { return font; }
+		double getFontSize() const { return fontSize; }
+		double getTextWidth() const { return textWidth; }
+		unsigned int getMarginLines() const { return marginLines; }
+		std::size_t getNumParagraphs() const { return paragraphs.size(); }
+		/// Returns the distance between the baselines of two lines, in pt
+		double getLineHeight() const;
+		/// Returns the number of lines. Contains estimates for paragraphs that were not laid out yet
+		unsigned int getNumLines() const { return lineCounts.total(); }
+		/// Returns the y coordinate of the top and bottom of the text (in pt), see DynamicText
+		double getTop() const;
+		double getBottom() const;
+		double getTextHeight() const { return getTop() - getBottom(); }
+		/// Returns the y coordinate of the baseline of the given line (in pt)
+		double getBaseline(const unsigned int& lineIndex) const;
+		/// Returns the index of the line at the given y coordinate (in pt) in O(log n)
+		unsigned int getLineIndex(const double& y) const;
+		/// Returns the index of the paragraph containing the given line in O(log n)
+		std::size_t getParagraphIndex(const unsigned int& lineIndex) const;
+		/// Returns the index of the first line of the given paragraph in O(log n)
+		unsigned int getFirstLine(const std::size_t& paragraphIndex) const { return lineCounts.prefixSum(paragraphIndex); }
+		/// Returns the byte range [begin, end) of the given paragraph in the text
+		std::pair<std::size_t, std::size_t> getParagraphRange(const std::size_t& paragraphIndex) const;
+		/// Sets the contents of the text. All paragraphs have to be laid out again
+		void setText(const std::string& text);
+		/// Appends to the text. Only the last paragraph has to be laid out again
+		void appendText(const std::string& text);
+		/// Setters. Changing any of these invalidates the layout of all paragraphs
+		void setFont(const Font& font);
+		void setFontSize(const double& fontSize);
+		void setTextWidth(const double& textWidth);
+		void setLineHeightMultiplier(double lineHeightMultiplier);
+		void setParseMode(const StaticText::ParseMode& parseMode);
+		void setAlignment(AlignmentHorizontal alignment);
+		void setMarginLines(const unsigned int& marginLines) { this->marginLines = marginLines; }
+		/// Sets the visible window, given by the y coordinates of its top and bottom (in pt). Lays out
+		/// all paragraphs in the window (plus marginLines above and below) and releases the models of all
+		/// other paragraphs. Laying out paragraphs can change the line count, so the caller should check
+		/// getNumLines() afterwards if it depends on it (eg. for scrollbars)
+		void setVisibleRange(const double& top, const double& bottom);
+		/// Returns all paragraphs that currently have a model, in order
+		std::vector<VisibleParagraph> getVisibleParagraphs() const;
+	};
+	//--------------------------------------------------------------------------------------------------
+}
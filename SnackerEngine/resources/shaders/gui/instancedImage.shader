@@ -0,0 +1,33 @@
+#shader vertex
+#version 330 core
+
+// Corner of the shared unit quad
+layout(location = 0) in vec2 a_corner;
+// Per quad instance (see GuiQuadBatch::QuadInstance). Only position and size are used
+layout(location = 1) in vec2 a_position;
+layout(location = 2) in vec2 a_size;
+
+uniform mat4 u_view;
+uniform mat4 u_projection;
+
+out vec2 v_texCoord;
+
+void main()
+{
+	v_texCoord = a_corner;
+	gl_Position = u_projection * u_view * vec4(a_position + a_corner * a_size, 0.0, 1.0);
+}
+
+#shader fragment
+#version 330 core
+
+in vec2 v_texCoord;
+
+uniform sampler2D u_texture;
+
+out vec4 color;
+
+void main()
+{
+	color = texture(u_texture, v_texCoord);
+}
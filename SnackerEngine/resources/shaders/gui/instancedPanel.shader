@@ -0,0 +1,63 @@
+#shader vertex
+#version 330 core
+
+// Corner of the shared unit quad
+layout(location = 0) in vec2 a_corner;
+// Per quad instance (see GuiQuadBatch::QuadInstance)
+layout(location = 1) in vec2 a_position;
+layout(location = 2) in vec2 a_size;
+layout(location = 3) in vec4 a_color;
+layout(location = 4) in vec4 a_borderColor;
+// Radii of the top left, top right, bottom right and bottom left corner
+layout(location = 5) in vec4 a_roundedCorners;
+layout(location = 6) in float a_borderThickness;
+
+uniform mat4 u_view;
+uniform mat4 u_projection;
+
+// Position relative to the center of the quad in pixels
+out vec2 v_position;
+flat out vec2 v_halfSize;
+flat out vec4 v_color;
+flat out vec4 v_borderColor;
+flat out vec4 v_roundedCorners;
+flat out float v_borderThickness;
+
+void main()
+{
+	v_halfSize = 0.5 * a_size;
+	v_position = a_corner * a_size - v_halfSize;
+	v_color = a_color;
+	v_borderColor = a_borderColor;
+	v_roundedCorners = a_roundedCorners;
+	v_borderThickness = a_borderThickness;
+	gl_Position = u_projection * u_view * vec4(a_position + a_corner * a_size, 0.0, 1.0);
+}
+
+#shader fragment
+#version 330 core
+
+in vec2 v_position;
+flat in vec2 v_halfSize;
+flat in vec4 v_color;
+flat in vec4 v_borderColor;
+flat in vec4 v_roundedCorners;
+flat in float v_borderThickness;
+
+out vec4 color;
+
+void main()
+{
+	// Select the radius of the corner in the current quadrant (y axis pointing up)
+	float radius = v_position.x < 0.0
+		? (v_position.y > 0.0 ? v_roundedCorners.x : v_roundedCorners.w)
+		: (v_position.y > 0.0 ? v_roundedCorners.y : v_roundedCorners.z);
+	radius = min(radius, min(v_halfSize.x, v_halfSize.y));
+	// Signed distance to the rounded rectangle, negative inside
+	vec2 q = abs(v_position) - v_halfSize + vec2(radius);
+	float dist = min(max(q.x, q.y), 0.0) + length(max(q, vec2(0.0))) - radius;
+	float opacity = clamp(0.5 - dist, 0.0, 1.0);
+	float border = v_borderThickness > 0.0 ? clamp(dist + v_borderThickness + 0.5, 0.0, 1.0) : 0.0;
+	vec4 fillColor = mix(v_color, v_borderColor, border);
+	color = vec4(fillColor.rgb, fillColor.a * opacity);
+}
@@ -0,0 +1,57 @@
+#shader vertex
+#version 330 core
+
+// Corner of the shared unit quad
+layout(location = 0) in vec2 a_corner;
+// Per glyph instance (see GlyphInstance)
+layout(location = 1) in vec2 a_position;
+layout(location = 2) in vec2 a_size;
+// Texture rectangle (left, bottom, right, top), normalized fixed point numbers
+layout(location = 3) in vec4 a_texRect;
+
+uniform mat4 u_model;
+uniform mat4 u_view;
+uniform mat4 u_projection;
+uniform ivec2 u_msdfDims;
+
+out vec2 v_texCoord;
+
+// Has to match GlyphInstance::texCoordPrecision
+const float texCoordPrecision = 8.0;
+
+void main()
+{
+	vec2 position = a_position + a_corner * a_size;
+	vec4 texRect = a_texRect * (65535.0 / texCoordPrecision);
+	v_texCoord = mix(texRect.xy, texRect.zw, a_corner) / vec2(u_msdfDims);
+	gl_Position = u_projection * u_view * u_model * vec4(position, 0.0, 1.0);
+}
+
+#shader fragment
+#version 330 core
+
+in vec2 v_texCoord;
+
+uniform sampler2D u_msdf;
+uniform vec4 u_color;
+uniform float u_pxRange;
+
+out vec4 color;
+
+float median(float r, float g, float b)
+{
+	return max(min(r, g), min(max(r, g), b));
+}
+
+void main()
+{
+	vec3 msd = texture(u_msdf, v_texCoord).rgb;
+	float sd = median(msd.r, msd.g, msd.b);
+	// Convert the signed distance to screen pixels
+	vec2 unitRange = vec2(u_pxRange) / vec2(textureSize(u_msdf, 0));
+	vec2 screenTexSize = vec2(1.0) / fwidth(v_texCoord);
+	float screenPxRange = max(0.5 * dot(unitRange, screenTexSize), 1.0);
+	float screenPxDistance = screenPxRange * (sd - 0.5);
+	float opacity = clamp(screenPxDistance + 0.5, 0.0, 1.0);
+	color = vec4(u_color.rgb, u_color.a * opacity);
+}
@@ -0,0 +1,172 @@
+#include "Test.h"
+#include "Gui/Text/DirtyRanges.h"
+#include "Gui/Text/Text.h"
+#include "Utility/GapBuffer.h"
+
+#include <cmath>
+#include <random>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// Parameters used for all texts
+		constexpr double fontSize = 16.0;
+		constexpr double textWidth = 300.0;
+		constexpr float cursorWidth = 1.0f;
+		//--------------------------------------------------------------------------------------------------
+		/// Checks that the edited text has the same lines as a text that was laid out from scratch
+		void checkSameLayoutAsFullParse(EditableText& editedText, StaticText::ParseMode parseMode, AlignmentHorizontal alignment)
+		{
+			EditableText referenceText(editedText.getText(), *getTestFont(), fontSize, textWidth, cursorWidth, 1.0, parseMode, alignment);
+			if (!TEST_CHECK_EQUAL(editedText.getNumLines(), referenceText.getNumLines())) return;
+			TEST_CHECK(std::fabs(editedText.getRight() - referenceText.getRight()) < 1.0e-6);
+			for (unsigned int i = 0; i < editedText.getNumLines(); ++i) {
+				TEST_CHECK(std::fabs(editedText.getRight(i) - referenceText.getRight(i)) < 1.0e-6);
+			}
+		}
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar dirtyRangeTest("DirtyRangeList/merges ranges", []() {
+			DirtyRangeList ranges;
+			ranges.add(10, 20);
+			ranges.add(30, 40);
+			ranges.add(5, 5);
+			TEST_CHECK(ranges.getRanges() == std::vector<DirtyRange>({ { 10, 20 }, { 30, 40 } }));
+			// Adjacent ranges are merged
+			ranges.add(20, 25);
+			TEST_CHECK(ranges.getRanges() == std::vector<DirtyRange>({ { 10, 25 }, { 30, 40 } }));
+			// A range that overlaps multiple ranges merges them all
+			ranges.add(0, 2);
+			ranges.add(24, 31);
+			TEST_CHECK(ranges.getRanges() == std::vector<DirtyRange>({ { 0, 2 }, { 10, 40 } }));
+			TEST_CHECK_EQUAL(ranges.getDirtyCount(), 32u);
+			TEST_CHECK(ranges.getBoundingRange() == DirtyRange({ 0, 40 }));
+			ranges.clear();
+			TEST_CHECK(ranges.empty());
+			TEST_CHECK(ranges.getBoundingRange() == DirtyRange({ 0, 0 }));
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar dirtyRangeRandomTest("DirtyRangeList/matches a bitmap", []() {
+			std::mt19937 random(42);
+			DirtyRangeList ranges;
+			std::vector<bool> dirty(200, false);
+			for (unsigned int i = 0; i < 500; ++i) {
+				const unsigned int begin = static_cast<unsigned int>(random() % 200);
+				const unsigned int end = std::min(200u, begin + static_cast<unsigned int>(random() % 10));
+				ranges.add(begin, end);
+				for (unsigned int j = begin; j < end; ++j) dirty[j] = true;
+				std::vector<bool> result(200, false);
+				unsigned int previousEnd = 0;
+				for (const auto& range : ranges.getRanges()) {
+					// Ranges are sorted, disjoint and not adjacent
+					TEST_CHECK(range.begin < range.end && (previousEnd == 0 || range.begin > previousEnd));
+					for (unsigned int j = range.begin; j < range.end; ++j) result[j] = true;
+					previousEnd = range.end;
+				}
+				if (!TEST_CHECK(result == dirty)) return;
+			}
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar gapBufferTest("GapBuffer/matches std::vector", []() {
+			std::mt19937 random(42);
+			GapBuffer<int> gapBuffer;
+			std::vector<int> reference;
+			for (int i = 0; i < 2000; ++i) {
+				const std::size_t index = reference.empty() ? 0 : random() % (reference.size() + 1);
+				switch (random() % 4)
+				{
+				case 0:
+				{
+					gapBuffer.insert(index, i);
+					reference.insert(reference.begin() + index, i);
+					break;
+				}
+				case 1:
+				{
+					const std::vector<int> values(random() % 8, i);
+					gapBuffer.insert(index, values.begin(), values.end());
+					reference.insert(reference.begin() + index, values.begin(), values.end());
+					break;
+				}
+				default:
+				{
+					const std::size_t end = std::min(reference.size(), index + random() % 6);
+					gapBuffer.erase(index, end);
+					reference.erase(reference.begin() + index, reference.begin() + end);
+					break;
+				}
+				}
+				if (!TEST_CHECK_EQUAL(gapBuffer.size(), reference.size())) return;
+			}
+			TEST_CHECK(std::equal(gapBuffer.begin(), gapBuffer.end(), reference.begin(), reference.end()));
+			const auto first = gapBuffer.getFirstSegment();
+			const auto second = gapBuffer.getSecondSegment();
+			TEST_CHECK_EQUAL(first.second + second.second, reference.size());
+			TEST_CHECK(std::equal(first.first, first.first + first.second, reference.begin()));
+			TEST_CHECK(std::equal(second.first, second.first + second.second, reference.begin() + first.second));
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar editTest("EditableText/incremental edits match a full layout", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			for (const auto parseMode : { StaticText::ParseMode::WORD_BY_WORD, StaticText::ParseMode::CHARACTERS }) {
+				for (const auto alignment : { AlignmentHorizontal::LEFT, AlignmentHorizontal::CENTER, AlignmentHorizontal::RIGHT }) {
+					std::mt19937 random(42);
+					EditableText text(generateTestProse(2000, true), *getTestFont(), fontSize, textWidth, cursorWidth, 1.0, parseMode, alignment);
+					for (unsigned int i = 1; i <= 200; ++i) {
+						const unsigned int position = static_cast<unsigned int>(random() % (text.getNumCharacters() + 1));
+						switch (random() % 4)
+						{
+						case 0: text.setCursorPos(position); text.inputAtCursor(static_cast<Unicode>('a' + random() % 26)); break;
+						case 1: text.setCursorPos(position); text.inputAtCursor(std::string("longer words ")); break;
+						case 2: text.deleteCharacters(position, position + random() % 40); break;
+						default: text.setCursorPos(position); text.inputNewlineAtCursor(); break;
+						}
+						if (i % 20 == 0) checkSameLayoutAsFullParse(text, parseMode, alignment);
+					}
+				}
+			}
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar dirtyLinesTest("EditableText/typing only updates nearby lines", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			EditableText text(generateTestProse(4000, false), *getTestFont(), fontSize, textWidth, cursorWidth);
+			const std::size_t lineCount = text.getNumLines();
+			if (!TEST_CHECK(lineCount > 20)) return;
+			// Delete first, such that the inserted character can use the free slot and the vertex
+			// buffer does not have to grow
+			text.setCursorPos(static_cast<unsigned int>(text.getNumCharacters() / 2));
+			text.deleteCharacterBeforeCursor();
+			TEST_CHECK(text.getDirtyLineRanges().getDirtyCount() < lineCount / 4);
+			TEST_CHECK(text.getUploadedVertexRanges().getDirtyCount() < text.getNumCharacters());
+			text.inputAtCursor(static_cast<Unicode>('x'));
+			TEST_CHECK(text.getDirtyLineRanges().getDirtyCount() < lineCount / 4);
+			TEST_CHECK(text.getUploadedVertexRanges().getDirtyCount() < text.getNumCharacters());
+			checkSameLayoutAsFullParse(text, StaticText::ParseMode::WORD_BY_WORD, AlignmentHorizontal::LEFT);
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar vertexSlotTest("EditableText/vertex slots are reused and shrunk", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			EditableText text(generateTestProse(4000, true), *getTestFont(), fontSize, textWidth, cursorWidth);
+			const std::size_t initialCapacity = text.getVertexSlotCapacity();
+			TEST_CHECK_EQUAL(initialCapacity, text.getNumCharacters());
+			// Freed slots are used for new characters
+			text.deleteCharacters(100, 109);
+			text.setCursorPos(100);
+			for (unsigned int i = 0; i < 10; ++i) text.inputAtCursor(static_cast<Unicode>('a' + i));
+			TEST_CHECK_EQUAL(text.getVertexSlotCapacity(), initialCapacity);
+			// After most of the text was deleted, the slots are compacted
+			text.deleteCharacters(0, static_cast<unsigned int>(text.getNumCharacters()) - 101);
+			TEST_CHECK_EQUAL(text.getNumCharacters(), 100u);
+			const std::size_t compactedCapacity = text.getVertexSlotCapacity();
+			TEST_CHECK(compactedCapacity <= 2 * text.getNumCharacters());
+			checkSameLayoutAsFullParse(text, StaticText::ParseMode::WORD_BY_WORD, AlignmentHorizontal::LEFT);
+			// Some unused slots are kept for typing
+			text.setCursorPos(50);
+			for (unsigned int i = 0; i < 50; ++i) text.inputAtCursor(static_cast<Unicode>('a' + i % 26));
+			TEST_CHECK_EQUAL(text.getVertexSlotCapacity(), compactedCapacity);
+			checkSameLayoutAsFullParse(text, StaticText::ParseMode::WORD_BY_WORD, AlignmentHorizontal::LEFT);
+			});
+		//--------------------------------------------------------------------------------------------------
+	}
+}
@@ -0,0 +1,123 @@
+#include "Test.h"
+#include "AssetManager/FontCacheFile.h"
+
+#include <sstream>
+#include <string>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		constexpr std::uint64_t testKey = 0x0123456789abcdefull;
+		//--------------------------------------------------------------------------------------------------
+		/// Returns the FNV-1a hash of the given string
+		std::uint64_t hashString(const std::string& string)
+		{
+			std::uint64_t hash = fnv1aOffsetBasis;
+			hashFNV1a(hash, string.data(), string.size());
+			return hash;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Creates glyphs with deterministic pixels. The second glyph has an empty box, like a whitespace
+		std::vector<FontCacheGlyph> createTestGlyphs()
+		{
+			std::vector<FontCacheGlyph> glyphs{ { { 'A', 3, 2 } }, { { ' ', 0, 0 } }, { { 0x25a1, 4, 5 } } };
+			for (FontCacheGlyph& glyph : glyphs) {
+				glyph.pixels.resize(static_cast<std::size_t>(glyph.record.width) * glyph.record.height * 3);
+				for (std::size_t i = 0; i < glyph.pixels.size(); ++i) glyph.pixels[i] = static_cast<unsigned char>(glyph.record.codepoint + i);
+			}
+			return glyphs;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Writes a whole cache file with the given glyphs
+		std::string writeTestFile(const std::vector<FontCacheGlyph>& glyphs, std::uint64_t key = testKey)
+		{
+			std::ostringstream stream(std::ios::binary);
+			writeFontCacheHeader(stream, key);
+			for (const FontCacheGlyph& glyph : glyphs) writeFontCacheGlyph(stream, glyph.record, glyph.pixels.data());
+			return stream.str();
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Reads a cache file from the given bytes
+		FontCacheReadResult readTestFile(const std::string& data, std::vector<FontCacheGlyph>& glyphs, std::uint64_t key = testKey)
+		{
+			std::istringstream stream(data, std::ios::binary);
+			return readFontCache(stream, key, glyphs);
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Checks that the first count glyphs are equal
+		void checkGlyphs(const std::vector<FontCacheGlyph>& glyphs, const std::vector<FontCacheGlyph>& expected, std::size_t count)
+		{
+			if (!TEST_CHECK(glyphs.size() >= count && expected.size() >= count)) return;
+			for (std::size_t i = 0; i < count; ++i) {
+				TEST_CHECK_EQUAL(glyphs[i].record.codepoint, expected[i].record.codepoint);
+				TEST_CHECK_EQUAL(glyphs[i].record.width, expected[i].record.width);
+				TEST_CHECK_EQUAL(glyphs[i].record.height, expected[i].record.height);
+				TEST_CHECK(glyphs[i].pixels == expected[i].pixels);
+			}
+		}
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar hashTest("FontCacheFile/FNV-1a matches the reference values", []() {
+			TEST_CHECK_EQUAL(hashString(""), 0xcbf29ce484222325ull);
+			TEST_CHECK_EQUAL(hashString("a"), 0xaf63dc4c8601ec8cull);
+			TEST_CHECK_EQUAL(hashString("foobar"), 0x85944171f73967e8ull);
+			// Hashing in pieces gives the same result
+			std::uint64_t hash = fnv1aOffsetBasis;
+			hashFNV1a(hash, "foo", 3);
+			hashFNV1a(hash, "bar", 3);
+			TEST_CHECK_EQUAL(hash, hashString("foobar"));
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar roundTripTest("FontCacheFile/glyphs survive a round trip", []() {
+			const std::vector<FontCacheGlyph> expected = createTestGlyphs();
+			std::vector<FontCacheGlyph> glyphs;
+			TEST_CHECK(readTestFile(writeTestFile(expected), glyphs) == FontCacheReadResult::COMPLETE);
+			if (!TEST_CHECK_EQUAL(glyphs.size(), expected.size())) return;
+			checkGlyphs(glyphs, expected, expected.size());
+			// An empty file only consists of the header
+			glyphs.clear();
+			TEST_CHECK(readTestFile(writeTestFile({}), glyphs) == FontCacheReadResult::COMPLETE);
+			TEST_CHECK(glyphs.empty());
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar invalidTest("FontCacheFile/files with a different key are invalid", []() {
+			const std::vector<FontCacheGlyph> expected = createTestGlyphs();
+			std::vector<FontCacheGlyph> glyphs;
+			TEST_CHECK(readTestFile(writeTestFile(expected), glyphs, testKey + 1) == FontCacheReadResult::INVALID);
+			std::string data = writeTestFile(expected);
+			data[0] ^= 0xff;
+			TEST_CHECK(readTestFile(data, glyphs) == FontCacheReadResult::INVALID);
+			TEST_CHECK(readTestFile(data.substr(0, sizeof(FontCacheHeader) - 1), glyphs) == FontCacheReadResult::INVALID);
+			// A record with a negative size can't be skipped
+			std::vector<FontCacheGlyph> corrupt = expected;
+			corrupt[1].record.width = -1;
+			TEST_CHECK(readTestFile(writeTestFile(corrupt), glyphs) == FontCacheReadResult::INVALID);
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar truncatedTest("FontCacheFile/truncated files keep all complete records", []() {
+			const std::vector<FontCacheGlyph> expected = createTestGlyphs();
+			const std::string data = writeTestFile(expected);
+			const std::size_t lastRecordSize = sizeof(FontCacheGlyphRecord) + expected.back().pixels.size();
+			// Cut the file inside the bitmap and inside the header of the last record
+			for (const std::size_t cut : { std::size_t(1), expected.back().pixels.size(), lastRecordSize - 1 }) {
+				std::vector<FontCacheGlyph> glyphs;
+				TEST_CHECK(readTestFile(data.substr(0, data.size() - cut), glyphs) == FontCacheReadResult::TRUNCATED);
+				if (!TEST_CHECK_EQUAL(glyphs.size(), expected.size() - 1)) continue;
+				checkGlyphs(glyphs, expected, glyphs.size());
+			}
+			// Rewriting the complete records makes the file usable for appending again
+			std::vector<FontCacheGlyph> glyphs;
+			readTestFile(data.substr(0, data.size() - 1), glyphs);
+			std::string rewritten = writeTestFile(glyphs);
+			std::ostringstream appended(std::ios::binary);
+			writeFontCacheGlyph(appended, expected.back().record, expected.back().pixels.data());
+			rewritten += appended.str();
+			glyphs.clear();
+			TEST_CHECK(readTestFile(rewritten, glyphs) == FontCacheReadResult::COMPLETE);
+			if (!TEST_CHECK_EQUAL(glyphs.size(), expected.size())) return;
+			checkGlyphs(glyphs, expected, expected.size());
+			});
+		//--------------------------------------------------------------------------------------------------
+	}
+}
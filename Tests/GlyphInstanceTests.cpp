@@ -0,0 +1,103 @@
+#include "Test.h"
+#include "Gui/Text/Text.h"
+
+#include <cmath>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// Parameters used for all texts
+		constexpr double fontSize = 16.0;
+		constexpr double textWidth = 80.0;
+		constexpr float tolerance = 1.0e-4f;
+		//--------------------------------------------------------------------------------------------------
+		/// Horizontal extent of a line of glyph instances
+		struct LineExtent
+		{
+			float left;
+			float right;
+		};
+		//--------------------------------------------------------------------------------------------------
+		/// Splits the instances into lines. Instances are computed line by line from left to right, so
+		/// a new line starts whenever an instance is left of its predecessor
+		std::vector<LineExtent> computeLineExtents(const std::vector<GlyphInstance>& instances)
+		{
+			std::vector<LineExtent> lines;
+			for (std::size_t i = 0; i < instances.size(); ++i) {
+				const float left = instances[i].position.x;
+				const float right = instances[i].position.x + instances[i].size.x;
+				if (i == 0 || left < instances[i - 1].position.x) lines.push_back({ left, right });
+				else lines.back().right = right;
+			}
+			return lines;
+		}
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar whitespaceTest("DynamicText/glyph instances skip whitespace", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			DynamicText text("Hello brave new world", *getTestFont(), fontSize, textWidth, 1.0, StaticText::ParseMode::WORD_BY_WORD);
+			std::vector<GlyphInstance> instances;
+			text.computeGlyphInstances(instances);
+			TEST_CHECK_EQUAL(instances.size(), 18u);
+			for (const GlyphInstance& instance : instances) {
+				TEST_CHECK(instance.size.x > 0.0f && instance.size.y > 0.0f);
+			}
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar alignmentTest("DynamicText/glyph instances are aligned", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			// Without whitespace, every line ends with a visible glyph
+			const std::string content = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+			std::vector<GlyphInstance> leftInstances;
+			DynamicText(content, *getTestFont(), fontSize, textWidth, 1.0, StaticText::ParseMode::CHARACTERS, AlignmentHorizontal::LEFT).computeGlyphInstances(leftInstances);
+			const std::vector<LineExtent> leftLines = computeLineExtents(leftInstances);
+			if (!TEST_CHECK(leftLines.size() > 2)) return;
+			float longestLineWidth = 0.0f;
+			for (const LineExtent& line : leftLines) {
+				TEST_CHECK(std::fabs(line.left - leftLines.front().left) < tolerance);
+				longestLineWidth = std::max(longestLineWidth, line.right - line.left);
+			}
+			for (const auto alignment : { AlignmentHorizontal::CENTER, AlignmentHorizontal::RIGHT }) {
+				std::vector<GlyphInstance> instances;
+				DynamicText(content, *getTestFont(), fontSize, textWidth, 1.0, StaticText::ParseMode::CHARACTERS, alignment).computeGlyphInstances(instances);
+				if (!TEST_CHECK_EQUAL(instances.size(), leftInstances.size())) continue;
+				// Alignment only moves glyphs horizontally
+				for (std::size_t i = 0; i < instances.size(); ++i) {
+					TEST_CHECK(std::fabs(instances[i].position.y - leftInstances[i].position.y) < tolerance);
+					TEST_CHECK(std::fabs(instances[i].size.x - leftInstances[i].size.x) < tolerance);
+				}
+				const std::vector<LineExtent> lines = computeLineExtents(instances);
+				if (!TEST_CHECK_EQUAL(lines.size(), leftLines.size())) continue;
+				for (const LineExtent& line : lines) {
+					if (alignment == AlignmentHorizontal::CENTER) {
+						TEST_CHECK(std::fabs((line.left + line.right) - (2.0f * leftLines.front().left + longestLineWidth)) < 2.0f * tolerance);
+					}
+					else {
+						TEST_CHECK(std::fabs(line.right - (leftLines.front().left + longestLineWidth)) < tolerance);
+					}
+				}
+			}
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar modelTest("DynamicText/glyph instances don't need a model", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			const std::string content = generateTestProse(500, true);
+			DynamicText text(content, *getTestFont(), fontSize, textWidth, 1.0, StaticText::ParseMode::WORD_BY_WORD, AlignmentHorizontal::CENTER);
+			std::vector<GlyphInstance> instances;
+			text.computeGlyphInstances(instances);
+			text.setModelEnabled(false);
+			text.setText(content + " more");
+			text.setText(content);
+			std::vector<GlyphInstance> instancesWithoutModel;
+			text.computeGlyphInstances(instancesWithoutModel);
+			if (!TEST_CHECK_EQUAL(instancesWithoutModel.size(), instances.size())) return;
+			for (std::size_t i = 0; i < instances.size(); ++i) {
+				TEST_CHECK(instancesWithoutModel[i].position == instances[i].position);
+				TEST_CHECK(instancesWithoutModel[i].size == instances[i].size);
+			}
+			TEST_CHECK(text.getRight() == DynamicText(content, *getTestFont(), fontSize, textWidth, 1.0, StaticText::ParseMode::WORD_BY_WORD, AlignmentHorizontal::CENTER).getRight());
+			});
+		//--------------------------------------------------------------------------------------------------
+	}
+}
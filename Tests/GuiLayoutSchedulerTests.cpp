@@ -0,0 +1,125 @@
+#include "Test.h"
+#include "Gui/GuiManager.h"
+
+#include <functional>
+#include <memory>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// GuiElement that counts how often its layout was enforced and optionally calls a function
+		/// from inside enforceLayout(), eg. to change the tree in the middle of a sweep
+		class CountingElement : public GuiElement
+		{
+		public:
+			unsigned int enforceCount = 0;
+			std::function<void()> onEnforceLayout;
+			CountingElement()
+				: GuiElement(Vec2i(0, 0), Vec2i(10, 10), ResizeMode::RESIZE_RANGE) {}
+		protected:
+			void enforceLayout() override
+			{
+				enforceCount++;
+				if (onEnforceLayout) onEnforceLayout();
+			}
+		};
+		//--------------------------------------------------------------------------------------------------
+		/// A GuiManager with a single parent element with the given number of children. Layouts that
+		/// were queued while registering the elements are already enforced. The GuiManager is
+		/// declared first, such that the elements are signed off before it is destroyed
+		struct LayoutFixture
+		{
+			GuiManager guiManager;
+			CountingElement parent;
+			std::vector<std::unique_ptr<CountingElement>> children;
+			LayoutFixture(std::size_t childCount, unsigned int startingSize = 20)
+				: guiManager(startingSize), parent{}, children{}
+			{
+				guiManager.setParallelLayouts(false);
+				guiManager.registerElement(parent);
+				for (std::size_t i = 0; i < childCount; ++i) {
+					children.push_back(std::make_unique<CountingElement>());
+					parent.registerChild(*children.back());
+				}
+				guiManager.update(0.0);
+				parent.enforceCount = 0;
+				for (auto& child : children) child->enforceCount = 0;
+			}
+		};
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar manyDirtyChildrenTest("GuiLayoutScheduler/parent of many dirty children is enforced once", []() {
+			LayoutFixture fixture(4);
+			for (auto& child : fixture.children) child->setWidth(20);
+			fixture.guiManager.update(0.0);
+			TEST_CHECK_EQUAL(fixture.parent.enforceCount, 1u);
+			for (auto& child : fixture.children) TEST_CHECK_EQUAL(child->enforceCount, 1u);
+			const GuiManager::LayoutStatistics& statistics = fixture.guiManager.getLayoutStatistics();
+			TEST_CHECK_EQUAL(statistics.layoutsEnforced, 5u);
+			TEST_CHECK_EQUAL(statistics.layoutsSkipped, 3u);
+			// Nothing is enforced if nothing changed
+			fixture.guiManager.update(0.0);
+			TEST_CHECK_EQUAL(fixture.parent.enforceCount, 1u);
+			TEST_CHECK_EQUAL(fixture.guiManager.getLayoutStatistics().layoutsEnforced, 0u);
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar downSweepSkipTest("GuiLayoutScheduler/down sweep skips layouts enforced in the up sweep", []() {
+			LayoutFixture fixture(2);
+			fixture.children[0]->setWidth(20);
+			fixture.parent.registerEnforceLayoutDown();
+			fixture.guiManager.update(0.0);
+			TEST_CHECK_EQUAL(fixture.parent.enforceCount, 1u);
+			TEST_CHECK_EQUAL(fixture.children[0]->enforceCount, 1u);
+			TEST_CHECK_EQUAL(fixture.children[1]->enforceCount, 0u);
+			const GuiManager::LayoutStatistics& statistics = fixture.guiManager.getLayoutStatistics();
+			TEST_CHECK_EQUAL(statistics.layoutsEnforced, 2u);
+			TEST_CHECK_EQUAL(statistics.layoutsSkipped, 1u);
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar requeuedTest("GuiLayoutScheduler/layouts queued again during a sweep are enforced again", []() {
+			LayoutFixture fixture(1);
+			bool requeue = true;
+			fixture.parent.onEnforceLayout = [&]() {
+				if (!requeue) return;
+				requeue = false;
+				fixture.parent.registerEnforceLayoutDown();
+			};
+			fixture.children[0]->setWidth(20);
+			fixture.guiManager.update(0.0);
+			// Once in the up sweep and once more in the down sweep
+			TEST_CHECK_EQUAL(fixture.parent.enforceCount, 2u);
+			TEST_CHECK_EQUAL(fixture.children[0]->enforceCount, 1u);
+			const GuiManager::LayoutStatistics& statistics = fixture.guiManager.getLayoutStatistics();
+			TEST_CHECK_EQUAL(statistics.layoutsEnforced, 3u);
+			TEST_CHECK_EQUAL(statistics.layoutsSkipped, 0u);
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar reusedGuiIDTest("GuiLayoutScheduler/removed elements are skipped even if their GuiID is reused", []() {
+			// All GuiIDs are in use after registering the elements, such that the GuiID of the removed
+			// element is the next one to be handed out
+			LayoutFixture fixture(2, 3);
+			const GuiID removedGuiID = fixture.children[1]->getGuiID();
+			auto replacement = std::make_unique<CountingElement>();
+			bool replace = true;
+			fixture.parent.onEnforceLayout = [&]() {
+				if (!replace) return;
+				replace = false;
+				// The queued entries of the removed element now refer to the replacement
+				fixture.children[1].reset();
+				fixture.parent.registerChild(*replacement);
+			};
+			fixture.children[0]->setWidth(20);
+			fixture.children[1]->setWidth(20);
+			fixture.guiManager.update(0.0);
+			TEST_CHECK_EQUAL(replacement->getGuiID(), removedGuiID);
+			TEST_CHECK_EQUAL(fixture.children[0]->enforceCount, 1u);
+			TEST_CHECK_EQUAL(replacement->enforceCount, 1u);
+			// Registering the replacement queues the parent again
+			TEST_CHECK_EQUAL(fixture.parent.enforceCount, 2u);
+			const GuiManager::LayoutStatistics& statistics = fixture.guiManager.getLayoutStatistics();
+			TEST_CHECK_EQUAL(statistics.layoutsEnforced, 4u);
+			TEST_CHECK_EQUAL(statistics.layoutsSkipped, 0u);
+			});
+	}
+}
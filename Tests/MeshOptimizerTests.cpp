@@ -0,0 +1,199 @@
+#include "Test.h"
+#include "AssetManager/MeshOptimizer.h"
+
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// Vertex data of a grid mesh with (size + 1) x (size + 1) vertices. Each vertex has a position,
+		/// a normal and texture coordinates
+		struct GridMesh
+		{
+			VertexBufferLayout layout;
+			std::vector<float> vertices;
+			std::vector<unsigned int> indices;
+		};
+		//--------------------------------------------------------------------------------------------------
+		/// Creates a wavy grid mesh with randomly shuffled triangles, such that the vertex cache
+		/// optimization has something to do
+		GridMesh createShuffledGrid(unsigned int size)
+		{
+			GridMesh mesh;
+			mesh.layout.push<float>(3);
+			mesh.layout.push<float>(3);
+			mesh.layout.push<float>(2);
+			for (unsigned int y = 0; y <= size; ++y) {
+				for (unsigned int x = 0; x <= size; ++x) {
+					const float u = static_cast<float>(x) / static_cast<float>(size);
+					const float v = static_cast<float>(y) / static_cast<float>(size);
+					Vec3f normal(std::sin(u * 6.0f), 1.0f, std::cos(v * 6.0f));
+					normal.normalize();
+					mesh.vertices.insert(mesh.vertices.end(), { u * 10.0f, std::sin(u * 3.0f) * std::cos(v * 3.0f), v * 10.0f,
+						normal.x, normal.y, normal.z, u, v });
+				}
+			}
+			std::vector<std::array<unsigned int, 3>> triangles;
+			for (unsigned int y = 0; y < size; ++y) {
+				for (unsigned int x = 0; x < size; ++x) {
+					const unsigned int i = y * (size + 1) + x;
+					triangles.push_back({ i, i + size + 1, i + 1 });
+					triangles.push_back({ i + 1, i + size + 1, i + size + 2 });
+				}
+			}
+			std::shuffle(triangles.begin(), triangles.end(), std::mt19937(42));
+			for (const auto& triangle : triangles) mesh.indices.insert(mesh.indices.end(), triangle.begin(), triangle.end());
+			return mesh;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Returns the triangles of the index buffer as vertex data, each triangle rotated such that the
+		/// smallest vertex comes first, sorted. Two index buffers describe the same mesh if the result is equal
+		std::vector<std::vector<float>> getSortedTriangles(const std::vector<float>& vertices, const std::vector<unsigned int>& indices, std::size_t strideInFloats)
+		{
+			std::vector<std::vector<float>> triangles;
+			for (std::size_t t = 0; t + 2 < indices.size(); t += 3) {
+				std::array<std::vector<float>, 3> corners;
+				for (std::size_t k = 0; k < 3; ++k) {
+					const auto begin = vertices.begin() + indices[t + k] * strideInFloats;
+					corners[k].assign(begin, begin + strideInFloats);
+				}
+				// Rotate instead of sorting the corners, since the winding order has to be kept
+				const std::size_t first = std::min_element(corners.begin(), corners.end()) - corners.begin();
+				std::vector<float> triangle;
+				for (std::size_t k = 0; k < 3; ++k) {
+					const auto& corner = corners[(first + k) % 3];
+					triangle.insert(triangle.end(), corner.begin(), corner.end());
+				}
+				triangles.push_back(std::move(triangle));
+			}
+			std::sort(triangles.begin(), triangles.end());
+			return triangles;
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Converts a half float back to a float
+		float halfFloatToFloat(const HalfFloat& value)
+		{
+			const float sign = (value.bits & 0x8000u) ? -1.0f : 1.0f;
+			const int exponent = (value.bits >> 10) & 0x1f;
+			const int mantissa = value.bits & 0x3ff;
+			if (exponent == 0) return sign * std::ldexp(static_cast<float>(mantissa), -24);
+			if (exponent == 31) return mantissa == 0 ? sign * INFINITY : NAN;
+			return sign * std::ldexp(static_cast<float>(mantissa + 1024), exponent - 25);
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Reads a value of type T from the byte vector and advances the offset
+		template<typename T>
+		T readBytes(const std::vector<unsigned char>& bytes, std::size_t& offset)
+		{
+			T value;
+			std::memcpy(&value, bytes.data() + offset, sizeof(T));
+			offset += sizeof(T);
+			return value;
+		}
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar vertexCacheTest("MeshOptimizer/optimizeVertexCache keeps all triangles", []() {
+			GridMesh mesh = createShuffledGrid(48);
+			const unsigned int vertexCount = static_cast<unsigned int>(mesh.vertices.size() / 8);
+			std::vector<unsigned int> indices = mesh.indices;
+			// Trailing indices that do not form a full triangle are kept at the end
+			indices.push_back(7);
+			const VertexCacheStatistics before = analyzeVertexCache(mesh.indices);
+			optimizeVertexCache(indices, vertexCount);
+			TEST_CHECK_EQUAL(indices.size(), mesh.indices.size() + 1);
+			TEST_CHECK_EQUAL(indices.back(), 7u);
+			indices.pop_back();
+			// The result has to be a permutation of the input triangles with the same winding order
+			TEST_CHECK(getSortedTriangles(mesh.vertices, indices, 8) == getSortedTriangles(mesh.vertices, mesh.indices, 8));
+			const VertexCacheStatistics after = analyzeVertexCache(indices);
+			TEST_CHECK_EQUAL(after.uniqueVertexCount, before.uniqueVertexCount);
+			// A shuffled grid has almost no vertex reuse, an optimized grid should get well below 1
+			TEST_CHECK(before.acmr > 2.0f);
+			TEST_CHECK(after.acmr < 0.8f);
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar disconnectedTest("MeshOptimizer/optimizeVertexCache with disconnected triangles", []() {
+			// Every triangle is a dead end for the cache
+			std::vector<unsigned int> indices;
+			for (unsigned int i = 0; i < 3000; ++i) indices.push_back(i);
+			std::vector<unsigned int> optimized = indices;
+			optimizeVertexCache(optimized, 3000);
+			TEST_CHECK(optimized == indices);
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar optimizeMeshTest("MeshOptimizer/optimizeMesh keeps the mesh", []() {
+			const GridMesh mesh = createShuffledGrid(32);
+			std::vector<float> vertices = mesh.vertices;
+			std::vector<unsigned int> indices = mesh.indices;
+			// Add an unreferenced vertex, which should be removed
+			vertices.insert(vertices.end(), 8, 5.0f);
+			const auto statistics = optimizeMesh(mesh.layout, vertices, indices);
+			TEST_CHECK_EQUAL(vertices.size(), mesh.vertices.size());
+			TEST_CHECK(statistics.second.acmr < statistics.first.acmr);
+			// The vertex fetch optimization references the vertices in order
+			unsigned int nextVertex = 0;
+			bool inOrder = true;
+			for (const auto& index : indices) {
+				if (index > nextVertex) inOrder = false;
+				if (index == nextVertex) nextVertex++;
+			}
+			TEST_CHECK(inOrder);
+			TEST_CHECK(getSortedTriangles(vertices, indices, 8) == getSortedTriangles(mesh.vertices, mesh.indices, 8));
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar halfFloatTest("MeshOptimizer/floatToHalfFloat", []() {
+			TEST_CHECK_EQUAL(floatToHalfFloat(0.0f).bits, 0x0000u);
+			TEST_CHECK_EQUAL(floatToHalfFloat(-0.0f).bits, 0x8000u);
+			TEST_CHECK_EQUAL(floatToHalfFloat(1.0f).bits, 0x3c00u);
+			TEST_CHECK_EQUAL(floatToHalfFloat(-2.0f).bits, 0xc000u);
+			TEST_CHECK_EQUAL(floatToHalfFloat(65504.0f).bits, 0x7bffu);
+			TEST_CHECK_EQUAL(floatToHalfFloat(1.0e6f).bits, 0x7c00u);
+			TEST_CHECK_EQUAL(floatToHalfFloat(std::ldexp(1.0f, -24)).bits, 0x0001u);
+			for (float value = -100.0f; value < 100.0f; value += 0.37f) {
+				TEST_CHECK(std::fabs(halfFloatToFloat(floatToHalfFloat(value)) - value) <= std::fabs(value) * (1.0f / 2048.0f) + 1.0e-7f);
+			}
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar quantizationTest("MeshOptimizer/quantizeVertices round trip", []() {
+			const GridMesh mesh = createShuffledGrid(8);
+			const std::vector<VertexQuantization> modes{ VertexQuantization::HALF_FLOAT, VertexQuantization::SNORM16, VertexQuantization::UNORM16 };
+			VertexBufferLayout quantizedLayout;
+			const std::vector<unsigned char> quantized = quantizeVertices(mesh.layout, mesh.vertices, modes, quantizedLayout);
+			// Positions and normals are padded to four components
+			const auto& elements = quantizedLayout.GetElements();
+			if (!TEST_CHECK_EQUAL(elements.size(), 3u)) return;
+			TEST_CHECK(elements[0].type == GL_HALF_FLOAT && elements[0].count == 4);
+			TEST_CHECK(elements[1].type == GL_SHORT && elements[1].count == 4 && elements[1].normalized);
+			TEST_CHECK(elements[2].type == GL_UNSIGNED_SHORT && elements[2].count == 2 && elements[2].normalized);
+			TEST_CHECK_EQUAL(quantizedLayout.GetStride(), 20u);
+			const std::size_t vertexCount = mesh.vertices.size() / 8;
+			if (!TEST_CHECK_EQUAL(quantized.size(), vertexCount * quantizedLayout.GetStride())) return;
+			std::size_t offset = 0;
+			for (std::size_t v = 0; v < vertexCount; ++v) {
+				const float* vertex = &mesh.vertices[v * 8];
+				for (std::size_t c = 0; c < 3; ++c) {
+					const float position = halfFloatToFloat(readBytes<HalfFloat>(quantized, offset));
+					TEST_CHECK(std::fabs(position - vertex[c]) <= std::fabs(vertex[c]) * (1.0f / 2048.0f) + 1.0e-7f);
+				}
+				TEST_CHECK_EQUAL(halfFloatToFloat(readBytes<HalfFloat>(quantized, offset)), 1.0f);
+				for (std::size_t c = 3; c < 6; ++c) {
+					const float normal = static_cast<float>(readBytes<short>(quantized, offset)) / 32767.0f;
+					TEST_CHECK(std::fabs(normal - vertex[c]) <= 0.5f / 32767.0f + 1.0e-6f);
+				}
+				TEST_CHECK_EQUAL(readBytes<short>(quantized, offset), 32767);
+				for (std::size_t c = 6; c < 8; ++c) {
+					const float textureCoordinate = static_cast<float>(readBytes<unsigned short>(quantized, offset)) / 65535.0f;
+					TEST_CHECK(std::fabs(textureCoordinate - vertex[c]) <= 0.5f / 65535.0f + 1.0e-6f);
+				}
+			}
+			});
+		//--------------------------------------------------------------------------------------------------
+	}
+}
@@ -0,0 +1,90 @@
+#include "Test.h"
+#include "Core/Engine.h"
+#include "AssetManager/FontManager.h"
+#include "Gui/Text/Font.h"
+
+#include <array>
+#include <iostream>
+#include <random>
+
+namespace
+{
+	/// Number of failed checks in the currently running test
+	unsigned int currentFailedChecks = 0;
+}
+//--------------------------------------------------------------------------------------------------
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	std::vector<Test>& TestRegistry::getTests()
+	{
+		static std::vector<Test> tests;
+		return tests;
+	}
+	//--------------------------------------------------------------------------------------------------
+	void TestRegistry::add(const std::string& name, std::function<void()> function)
+	{
+		getTests().push_back({ name, std::move(function) });
+	}
+	//--------------------------------------------------------------------------------------------------
+	int TestRegistry::run(const std::string& filter)
+	{
+		int testCount = 0;
+		int failedTestCount = 0;
+		for (const auto& test : getTests()) {
+			if (test.name.find(filter) == std::string::npos) continue;
+			currentFailedChecks = 0;
+			test.function();
+			testCount++;
+			if (currentFailedChecks > 0) failedTestCount++;
+			std::cout << (currentFailedChecks > 0 ? "[FAILED] " : "[  OK  ] ") << test.name << std::endl;
+		}
+		std::cout << testCount - failedTestCount << " of " << testCount << " tests passed" << std::endl;
+		return failedTestCount;
+	}
+	//--------------------------------------------------------------------------------------------------
+	bool TestRegistry::check(bool condition, const char* expression, const char* file, int line)
+	{
+		if (!condition) {
+			currentFailedChecks++;
+			std::cout << "    " << file << "(" << line << "): check failed: " << expression << std::endl;
+		}
+		return condition;
+	}
+	//--------------------------------------------------------------------------------------------------
+	Font* getTestFont()
+	{
+		static Font* font = []() -> Font* {
+			constexpr const char* fontPath = "fonts/Arial.ttf";
+			if (!Engine::getFullPath(fontPath).has_value()) {
+				std::cout << "    Could not find font " << fontPath << std::endl;
+				return nullptr;
+			}
+			FontManager::setAsyncGlyphGeneration(false);
+			Font* font = new Font(fontPath);
+			if (!font->isValid()) return nullptr;
+			return font;
+		}();
+		return font;
+	}
+	//--------------------------------------------------------------------------------------------------
+	std::string generateTestProse(std::size_t byteCount, bool paragraphs, unsigned int seed)
+	{
+		static const std::array<const char*, 16> words{ "the", "of", "and", "to", "in", "is", "was", "that",
+			"for", "it", "with", "as", "which", "one", "you", "were" };
+		std::mt19937 random(seed);
+		std::string text;
+		while (text.size() < byteCount) {
+			const unsigned int sentenceLength = 4 + random() % 12;
+			for (unsigned int i = 0; i < sentenceLength; ++i) {
+				std::string word = words[random() % words.size()];
+				if (i == 0) word[0] = static_cast<char>(word[0] - 'a' + 'A');
+				text += word;
+				text += i + 1 == sentenceLength ? ". " : " ";
+			}
+			if (paragraphs && random() % 6 == 0) text.back() = '\n';
+		}
+		return text;
+	}
+	//--------------------------------------------------------------------------------------------------
+}
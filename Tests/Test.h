@@ -0,0 +1,63 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace SnackerEngine
+{
+	//--------------------------------------------------------------------------------------------------
+	/// A single test. The function checks its results with TEST_CHECK() and TEST_CHECK_EQUAL()
+	struct Test
+	{
+		std::string name;
+		std::function<void()> function;
+	};
+	//--------------------------------------------------------------------------------------------------
+	/// Collection of all tests. Tests are registered by static TestRegistrar objects in the source
+	/// files of this project. Tests only use the CPU side of the engine, so no window or GPU is required.
+	/// Note that this is a fully static class that cannot be constructed
+	class TestRegistry
+	{
+		/// Returns the vector of all tests. A function local static is used, since the registrars
+		/// are constructed during static initialization of other translation units
+		static std::vector<Test>& getTests();
+	public:
+		/// Deleted constructor: this is a static class!
+		TestRegistry() = delete;
+		/// Adds a test
+		static void add(const std::string& name, std::function<void()> function);
+		/// Runs all tests whose name contains the filter and prints the failed checks.
+		/// Returns the number of tests that failed
+		static int run(const std::string& filter = "");
+		/// Records the result of a check in the currently running test. Should be called through the
+		/// TEST_CHECK() macro. Returns the condition, such that tests can stop early
+		static bool check(bool condition, const char* expression, const char* file, int line);
+	};
+	//--------------------------------------------------------------------------------------------------
+	/// Helper struct for registering tests during static initialization
+	struct TestRegistrar
+	{
+		TestRegistrar(const std::string& name, std::function<void()> function)
+		{
+			TestRegistry::add(name, std::move(function));
+		}
+	};
+	//--------------------------------------------------------------------------------------------------
+	class Font;
+	/// Returns the font used by the text tests, or nullptr if it could not be loaded (eg. because the
+	/// engine could not be initialized). Glyphs are generated synchronously, such that texts never
+	/// contain placeholder glyphs. The font is never deleted, since it would be destroyed after the
+	/// engine was terminated
+	Font* getTestFont();
+	/// Generates sentences of english words with the given number of bytes. If paragraphs is set to
+	/// false, no newlines are inserted
+	std::string generateTestProse(std::size_t byteCount, bool paragraphs, unsigned int seed = 42);
+	//--------------------------------------------------------------------------------------------------
+}
+//--------------------------------------------------------------------------------------------------
+/// Checks a condition in the currently running test. A failed check does not abort the test
+#define TEST_CHECK(condition) SnackerEngine::TestRegistry::check(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+/// Checks that two values are equal
+#define TEST_CHECK_EQUAL(a, b) SnackerEngine::TestRegistry::check((a) == (b), #a " == " #b, __FILE__, __LINE__)
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,112 @@
+#include "Test.h"
+#include "Gui/Text/TextLayoutCache.h"
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// Parameters used for all texts
+		constexpr double fontSize = 16.0;
+		constexpr double textWidth = 200.0;
+		//--------------------------------------------------------------------------------------------------
+		/// Returns a key that only differs from the other keys in its text
+		TextLayoutKey createKey(const std::string& text)
+		{
+			return TextLayoutKey{ text, 0, fontSize, 1.0, textWidth, StaticText::ParseMode::WORD_BY_WORD, AlignmentHorizontal::LEFT };
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Inserts an empty layout with the given key
+		void insertLayout(const std::string& text)
+		{
+			TextLayoutCache::insert(createKey(text), TextLayoutCache::TextLayout{ *getTestFont(), Model(), {}, {}, 0.0 });
+		}
+		//--------------------------------------------------------------------------------------------------
+		/// Returns true if a layout with the given key is cached
+		bool isCached(const std::string& text)
+		{
+			return TextLayoutCache::find(createKey(text)) != nullptr;
+		}
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar hitTest("TextLayoutCache/texts with the same parameters share their model", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			TextLayoutCache::clear();
+			const std::size_t hitCount = TextLayoutCache::getHitCount();
+			const DynamicText first("Shared label", *getTestFont(), fontSize, textWidth);
+			const DynamicText second("Shared label", *getTestFont(), fontSize, textWidth);
+			TEST_CHECK_EQUAL(TextLayoutCache::getHitCount(), hitCount + 1);
+			TEST_CHECK(second.getModel().isValid());
+			TEST_CHECK(&first.getModel().getMeshes() == &second.getModel().getMeshes());
+			TEST_CHECK_EQUAL(second.getNumLines(), first.getNumLines());
+			TEST_CHECK_EQUAL(second.getRight(), first.getRight());
+			// A different parameter is a different layout
+			const DynamicText third("Shared label", *getTestFont(), fontSize + 1.0, textWidth);
+			TEST_CHECK_EQUAL(TextLayoutCache::getHitCount(), hitCount + 1);
+			TextLayoutCache::clear();
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar modelDisabledTest("TextLayoutCache/hits don't create models for texts without a model", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			TextLayoutCache::clear();
+			const DynamicText cached("Cached label", *getTestFont(), fontSize, textWidth);
+			DynamicText text("Other label", *getTestFont(), fontSize, textWidth);
+			text.setModelEnabled(false);
+			const std::size_t hitCount = TextLayoutCache::getHitCount();
+			text.setText("Cached label");
+			TEST_CHECK_EQUAL(TextLayoutCache::getHitCount(), hitCount + 1);
+			TEST_CHECK(!text.getModel().isValid());
+			TEST_CHECK_EQUAL(text.getNumLines(), cached.getNumLines());
+			// Enabling the model again shares the cached model
+			text.setModelEnabled(true);
+			TEST_CHECK(&text.getModel().getMeshes() == &cached.getModel().getMeshes());
+			TextLayoutCache::clear();
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar lruTest("TextLayoutCache/the least recently used layout is evicted", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			TextLayoutCache::clear();
+			const std::size_t capacity = TextLayoutCache::getCapacity();
+			TextLayoutCache::setCapacity(3);
+			insertLayout("a");
+			insertLayout("b");
+			insertLayout("c");
+			// Using "a" makes "b" the least recently used layout
+			TEST_CHECK(isCached("a"));
+			insertLayout("d");
+			TEST_CHECK_EQUAL(TextLayoutCache::getSize(), 3u);
+			TEST_CHECK(!isCached("b"));
+			TEST_CHECK(isCached("a"));
+			TEST_CHECK(isCached("c"));
+			TEST_CHECK(isCached("d"));
+			// Inserting an existing key does not evict anything
+			insertLayout("a");
+			TEST_CHECK_EQUAL(TextLayoutCache::getSize(), 3u);
+			// Shrinking the cache evicts the least recently used layouts: "a" is the most recently used one
+			TextLayoutCache::setCapacity(1);
+			TEST_CHECK_EQUAL(TextLayoutCache::getSize(), 1u);
+			TEST_CHECK(isCached("a"));
+			TextLayoutCache::setCapacity(0);
+			TEST_CHECK_EQUAL(TextLayoutCache::getSize(), 0u);
+			insertLayout("a");
+			TEST_CHECK_EQUAL(TextLayoutCache::getSize(), 0u);
+			TextLayoutCache::setCapacity(capacity);
+			TextLayoutCache::clear();
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar limitTest("TextLayoutCache/default capacity and text length", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			TextLayoutCache::clear();
+			TEST_CHECK_EQUAL(TextLayoutCache::getCapacity(), 512u);
+			for (unsigned int i = 0; i <= 512; ++i) insertLayout(std::to_string(i));
+			TEST_CHECK_EQUAL(TextLayoutCache::getSize(), 512u);
+			TEST_CHECK(!isCached("0"));
+			TEST_CHECK(isCached("1"));
+			TEST_CHECK(isCached("512"));
+			// Texts with up to 1024 bytes are cached
+			TEST_CHECK(TextLayoutCache::isCacheable(createKey(std::string(1024, 'x'))));
+			TEST_CHECK(!TextLayoutCache::isCacheable(createKey(std::string(1025, 'x'))));
+			TextLayoutCache::clear();
+			});
+		//--------------------------------------------------------------------------------------------------
+	}
+}
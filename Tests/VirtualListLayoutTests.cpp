@@ -0,0 +1,156 @@
+#include "Test.h"
+#include "Gui/GuiManager.h"
+#include "Gui/Layouts/VirtualListLayout.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// Height of the items and of the list in pixels, such that exactly three items are visible if
+		/// the list is scrolled by a multiple of the item height
+		constexpr int itemHeight = 30;
+		constexpr int listHeight = 90;
+		//--------------------------------------------------------------------------------------------------
+		/// A GuiManager with a registered virtual list whose layout was already enforced. Records the
+		/// rows created by the list and the item that was last bound to each row. The GuiManager is
+		/// declared first, such that the list is signed off before it is destroyed
+		struct ListFixture
+		{
+			GuiManager guiManager;
+			std::vector<GuiElement*> rows;
+			std::vector<std::size_t> boundItems;
+			unsigned int bindCount;
+			GuiVirtualListLayout list;
+			ListFixture(std::size_t itemCount)
+				: guiManager(), rows{}, boundItems{}, bindCount(0),
+				list([this]() {
+						auto row = std::make_unique<GuiElement>();
+						rows.push_back(row.get());
+						boundItems.push_back(GuiVirtualListLayout::noItem);
+						return row;
+					}, [this](GuiElement& row, std::size_t itemIndex) {
+						const auto it = std::find(rows.begin(), rows.end(), &row);
+						if (it != rows.end()) boundItems[it - rows.begin()] = itemIndex;
+						bindCount++;
+					}, itemCount, itemHeight)
+			{
+				list.setResizeMode(GuiElement::ResizeMode::RESIZE_RANGE);
+				list.setPreferredSize(Vec2i(100, listHeight));
+				guiManager.registerElement(list);
+				guiManager.update(0.0);
+			}
+			/// Checks that each visible item is bound to the row with index item % rowCount
+			void checkRowMapping() const
+			{
+				const std::size_t rowCount = rows.size();
+				const std::size_t first = list.getFirstVisibleItem();
+				for (std::size_t row = 0; row < rowCount; ++row) {
+					const std::size_t item = first + (row + rowCount - first % rowCount) % rowCount;
+					TEST_CHECK_EQUAL(item % rowCount, row);
+					if (item < first + list.getVisibleItemCount()) TEST_CHECK_EQUAL(boundItems[row], item);
+				}
+			}
+		};
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar recyclingTest("VirtualListLayout/scrolling recycles one row per item", []() {
+			ListFixture fixture(10);
+			TEST_CHECK_EQUAL(fixture.list.getRowCount(), 3u);
+			TEST_CHECK_EQUAL(fixture.list.getVisibleItemCount(), 3u);
+			fixture.checkRowMapping();
+			for (int item = 1; item <= 7; ++item) {
+				const unsigned int bindCount = fixture.bindCount;
+				fixture.list.setScrollOffset(item * itemHeight);
+				TEST_CHECK_EQUAL(fixture.list.getFirstVisibleItem(), static_cast<std::size_t>(item));
+				TEST_CHECK_EQUAL(fixture.bindCount, bindCount + 1);
+				fixture.checkRowMapping();
+			}
+			// Jumping back binds all rows again, but keeps the mapping
+			fixture.list.scrollToItem(1);
+			TEST_CHECK_EQUAL(fixture.list.getFirstVisibleItem(), 1u);
+			TEST_CHECK_EQUAL(fixture.list.getRowCount(), 3u);
+			fixture.checkRowMapping();
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar itemCountTest("VirtualListLayout/setItemCount truncates and grows the list", []() {
+			ListFixture fixture(10);
+			fixture.list.setScrollOffset(7 * itemHeight);
+			fixture.list.setItemHeight(1, 50);
+			// The scroll offset is clamped to the new maximum
+			fixture.list.setItemCount(5);
+			TEST_CHECK_EQUAL(fixture.list.getItemCount(), 5u);
+			TEST_CHECK_EQUAL(fixture.list.getScrollOffset(), 4 * itemHeight + 50 - listHeight);
+			TEST_CHECK_EQUAL(fixture.list.getFirstVisibleItem() + fixture.list.getVisibleItemCount(), 5u);
+			fixture.checkRowMapping();
+			// Growing by a few items appends them, growing by many builds the tree again
+			fixture.list.setItemCount(8);
+			TEST_CHECK_EQUAL(fixture.list.getItemCount(), 8u);
+			TEST_CHECK_EQUAL(fixture.list.getItemHeight(1), 50);
+			TEST_CHECK_EQUAL(fixture.list.getItemHeight(7), itemHeight);
+			fixture.list.setItemCount(100);
+			TEST_CHECK_EQUAL(fixture.list.getItemCount(), 100u);
+			TEST_CHECK_EQUAL(fixture.list.getItemHeight(1), 50);
+			TEST_CHECK_EQUAL(fixture.list.getItemHeight(99), itemHeight);
+			fixture.list.scrollToItem(99);
+			TEST_CHECK_EQUAL(fixture.list.getScrollOffset(), 99 * itemHeight + 50 - listHeight);
+			fixture.checkRowMapping();
+			fixture.list.setItemCount(0);
+			TEST_CHECK_EQUAL(fixture.list.getItemCount(), 0u);
+			TEST_CHECK_EQUAL(fixture.list.getScrollOffset(), 0);
+			TEST_CHECK_EQUAL(fixture.list.getVisibleItemCount(), 0u);
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar zeroHeightTest("VirtualListLayout/zero height items are never hit", []() {
+			ListFixture fixture(5);
+			fixture.list.setItemHeight(1, 0);
+			fixture.list.setItemHeight(2, 0);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, itemHeight - 1)), 0u);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, itemHeight)), 3u);
+			fixture.checkRowMapping();
+			// Negative heights are clamped
+			fixture.list.setItemHeight(3, -10);
+			TEST_CHECK_EQUAL(fixture.list.getItemHeight(3), 0);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, itemHeight)), 4u);
+			// If all items have zero height, there is nothing to hit or scroll
+			fixture.list.setItemHeight(0);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, 0)), GuiVirtualListLayout::noItem);
+			TEST_CHECK_EQUAL(fixture.list.getScrollOffset(), 0);
+			fixture.list.setItemCount(8);
+			TEST_CHECK_EQUAL(fixture.list.getItemHeight(7), 0);
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar itemIndexTest("VirtualListLayout/getItemIndex at the boundaries", []() {
+			ListFixture fixture(10);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, -1)), GuiVirtualListLayout::noItem);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, 0)), 0u);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, itemHeight - 1)), 0u);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, itemHeight)), 1u);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, listHeight - 1)), 2u);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, listHeight)), GuiVirtualListLayout::noItem);
+			// Scrolled to the end
+			fixture.list.setScrollOffset(10 * itemHeight);
+			TEST_CHECK_EQUAL(fixture.list.getScrollOffset(), 10 * itemHeight - listHeight);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, 0)), 7u);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, listHeight - 1)), 9u);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, listHeight)), GuiVirtualListLayout::noItem);
+			// Below the last item of a short list
+			fixture.list.setItemCount(2);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, 2 * itemHeight - 1)), 1u);
+			TEST_CHECK_EQUAL(fixture.list.getItemIndex(Vec2i(0, 2 * itemHeight)), GuiVirtualListLayout::noItem);
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar negativeItemHeightTest("VirtualListLayout/constructors clamp negative item heights", []() {
+			const GuiVirtualListLayout list({}, {}, 3, -5);
+			TEST_CHECK_EQUAL(list.getItemHeight(), 0);
+			TEST_CHECK_EQUAL(list.getItemHeight(2), 0);
+			const nlohmann::json json = { { "itemHeight", -5 }, { "itemCount", 3 } };
+			const GuiVirtualListLayout jsonList(json, nullptr, nullptr);
+			TEST_CHECK_EQUAL(jsonList.getItemCount(), 3u);
+			TEST_CHECK_EQUAL(jsonList.getItemHeight(), 0);
+			TEST_CHECK_EQUAL(jsonList.getItemHeight(2), 0);
+			});
+	}
+}
@@ -0,0 +1,117 @@
+#include "Test.h"
+#include "Gui/Text/VirtualizedText.h"
+
+#include <cmath>
+
+namespace SnackerEngine
+{
+	namespace
+	{
+		//--------------------------------------------------------------------------------------------------
+		/// Parameters used for all texts
+		constexpr double fontSize = 16.0;
+		constexpr double textWidth = 200.0;
+		constexpr double tolerance = 1.0e-6;
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar paragraphOffsetTest("VirtualizedText/paragraph offsets match the line counts", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			const std::string content = generateTestProse(4000, true);
+			VirtualizedText text(content, *getTestFont(), fontSize, textWidth);
+			// With a margin larger than the text, every paragraph is laid out and all line counts are exact
+			text.setMarginLines(1000000);
+			text.setVisibleRange(text.getTop(), text.getBottom());
+			const std::vector<VirtualizedText::VisibleParagraph> paragraphs = text.getVisibleParagraphs();
+			if (!TEST_CHECK_EQUAL(paragraphs.size(), text.getNumParagraphs())) return;
+			unsigned int firstLine = 0;
+			for (std::size_t i = 0; i < paragraphs.size(); ++i) {
+				const VirtualizedText::VisibleParagraph& paragraph = paragraphs[i];
+				TEST_CHECK_EQUAL(paragraph.firstLine, firstLine);
+				TEST_CHECK_EQUAL(text.getFirstLine(i), firstLine);
+				TEST_CHECK_EQUAL(text.getParagraphIndex(firstLine), i);
+				TEST_CHECK(std::fabs(paragraph.offset.y - text.getBaseline(firstLine)) < tolerance);
+				TEST_CHECK(std::fabs(paragraph.offset.x) < tolerance);
+				// Each paragraph is laid out exactly like a separate DynamicText
+				const auto range = text.getParagraphRange(i);
+				const DynamicText reference(content.substr(range.first, range.second - range.first), *getTestFont(), fontSize, textWidth);
+				TEST_CHECK_EQUAL(paragraph.text->getNumLines(), reference.getNumLines());
+				firstLine += static_cast<unsigned int>(paragraph.text->getNumLines());
+			}
+			TEST_CHECK_EQUAL(text.getNumLines(), firstLine);
+			for (unsigned int line = 0; line < text.getNumLines(); ++line) {
+				TEST_CHECK_EQUAL(text.getLineIndex(text.getBaseline(line)), line);
+			}
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar alignmentOffsetTest("VirtualizedText/paragraph offsets are aligned", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			VirtualizedText text(generateTestProse(1000, true), *getTestFont(), fontSize, textWidth, 1.0, StaticText::ParseMode::WORD_BY_WORD, AlignmentHorizontal::RIGHT);
+			text.setVisibleRange(text.getTop(), text.getBottom());
+			const std::vector<VirtualizedText::VisibleParagraph> paragraphs = text.getVisibleParagraphs();
+			TEST_CHECK(!paragraphs.empty());
+			for (const VirtualizedText::VisibleParagraph& paragraph : paragraphs) {
+				// The right edge of every paragraph is at the text width
+				const double paragraphWidth = paragraph.text->getRight() - paragraph.text->getLeft();
+				TEST_CHECK(std::fabs(paragraph.offset.x + paragraphWidth - textWidth) < tolerance);
+			}
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar visibleRangeTest("VirtualizedText/only the visible window has models", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			VirtualizedText text(generateTestProse(200000, true), *getTestFont(), fontSize, textWidth);
+			const unsigned int marginLines = 4;
+			text.setMarginLines(marginLines);
+			const double lineHeight = text.getLineHeight();
+			// Scroll through the text from top to bottom
+			for (double top = text.getTop(); top > text.getBottom(); top -= 40.0 * lineHeight) {
+				const double bottom = top - 10.0 * lineHeight;
+				const unsigned int firstLine = text.getLineIndex(top);
+				const unsigned int lastLine = text.getLineIndex(bottom);
+				text.setVisibleRange(top, bottom);
+				const std::vector<VirtualizedText::VisibleParagraph> paragraphs = text.getVisibleParagraphs();
+				if (!TEST_CHECK(!paragraphs.empty())) return;
+				// The visible lines are covered by the paragraphs with a model
+				TEST_CHECK(paragraphs.front().firstLine <= firstLine);
+				const std::size_t lastParagraph = text.getParagraphIndex(paragraphs.back().firstLine);
+				TEST_CHECK(lastParagraph + 1 == text.getNumParagraphs() || text.getFirstLine(lastParagraph + 1) > lastLine);
+				// Paragraphs outside of the window plus the margin have no model
+				for (const VirtualizedText::VisibleParagraph& paragraph : paragraphs) {
+					const unsigned int paragraphEnd = paragraph.firstLine + static_cast<unsigned int>(paragraph.text->getNumLines());
+					TEST_CHECK(paragraphEnd + marginLines > firstLine);
+					TEST_CHECK(paragraph.firstLine <= lastLine + marginLines);
+				}
+				// Consecutive paragraphs follow each other without gaps
+				for (std::size_t i = 1; i < paragraphs.size(); ++i) {
+					TEST_CHECK_EQUAL(paragraphs[i].firstLine, paragraphs[i - 1].firstLine + static_cast<unsigned int>(paragraphs[i - 1].text->getNumLines()));
+				}
+			}
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar appendTextTest("VirtualizedText/appended text continues the last paragraph", []() {
+			if (!TEST_CHECK(getTestFont() != nullptr)) return;
+			const std::string content = generateTestProse(2000, true);
+			const std::size_t split = content.size() / 2;
+			VirtualizedText text(content.substr(0, split), *getTestFont(), fontSize, textWidth);
+			text.setVisibleRange(text.getTop(), text.getBottom());
+			text.appendText(content.substr(split));
+			const VirtualizedText reference(content, *getTestFont(), fontSize, textWidth);
+			if (!TEST_CHECK_EQUAL(text.getNumParagraphs(), reference.getNumParagraphs())) return;
+			for (std::size_t i = 0; i < text.getNumParagraphs(); ++i) {
+				TEST_CHECK(text.getParagraphRange(i) == reference.getParagraphRange(i));
+			}
+			});
+		//--------------------------------------------------------------------------------------------------
+		const TestRegistrar appendToEmptyTest("VirtualizedText/text can be appended to an empty text", []() {
+			VirtualizedText text;
+			TEST_CHECK_EQUAL(text.getNumParagraphs(), 0u);
+			text.appendText("first\nsecond");
+			if (!TEST_CHECK_EQUAL(text.getNumParagraphs(), 2u)) return;
+			TEST_CHECK(text.getText() == "first\nsecond");
+			TEST_CHECK(text.getParagraphRange(0) == std::make_pair(std::size_t(0), std::size_t(5)));
+			TEST_CHECK(text.getParagraphRange(1) == std::make_pair(std::size_t(6), std::size_t(12)));
+			text.appendText(" line");
+			TEST_CHECK_EQUAL(text.getNumParagraphs(), 2u);
+			TEST_CHECK(text.getParagraphRange(1) == std::make_pair(std::size_t(6), std::size_t(17)));
+			});
+		//--------------------------------------------------------------------------------------------------
+	}
+}
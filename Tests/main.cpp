@@ -0,0 +1,27 @@
+#include "Test.h"
+#include "Core/Engine.h"
+
+#include <iostream>
+
+/// Runs all tests. Usage:
+///		Tests.exe [filter] [--resources <path>]
+/// Only tests whose name contains the filter are run, eg. "Tests.exe MeshOptimizer".
+/// Returns a non-zero exit code if any test failed.
+/// The engine is started in headless mode, so no window or GPU is required
+int main(int argc, char** argv)
+{
+	std::string filter;
+	std::string resourcePath;
+	for (int i = 1; i < argc; ++i) {
+		const std::string argument = argv[i];
+		if (argument == "--resources" && i + 1 < argc) resourcePath = argv[++i];
+		else filter = argument;
+	}
+	const bool initialized = SnackerEngine::Engine::initializeHeadless(resourcePath);
+	if (!initialized) {
+		std::cout << "Could not initialize the engine, tests that need resources will fail" << std::endl;
+	}
+	const int failedTestCount = SnackerEngine::TestRegistry::run(filter);
+	if (initialized) SnackerEngine::Engine::terminate();
+	return failedTestCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+#include <initializer_list>
+#include <utility>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	/// A gap buffer is a sequence container that stores its elements in a single array with a "gap" of unused
+	/// elements at the position of the last edit. Inserting and erasing at the gap is O(number of elements
+	/// inserted/erased), and moving the gap costs O(distance). This makes it ideal for text editing, where
+	/// most edits happen close to each other (at the cursor). Random access is O(1), but slightly slower than
+	/// for a std::vector, because the gap has to be skipped.
+	/// T has to be default constructible, since the gap is made out of default constructed elements.
+	template<typename T>
+	class GapBuffer
+	{
+	private:
+		/// The storage. buffer.size() is the capacity of the gap buffer
+		std::vector<T> buffer{};
+		/// The gap is stored in [gapBegin, gapEnd)
+		std::size_t gapBegin{};
+		std::size_t gapEnd{};
+		/// Returns the size of the gap
+		std::size_t gapSize() const { return gapEnd - gapBegin; }
+		/// Moves the gap such that it starts at the given (logical) index
+		void moveGapTo(const std::size_t& index);
+		/// Makes sure that the gap can store at least count elements
+		void ensureGapSize(const std::size_t& count);
+		/// Helper class for iterators
+		template<bool isConst>
+		class Iterator
+		{
+			using BufferType = std::conditional_t<isConst, const GapBuffer<T>, GapBuffer<T>>;
+			BufferType* gapBuffer{};
+			std::size_t index{};
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<isConst, const T*, T*>;
+			using reference = std::conditional_t<isConst, const T&, T&>;
+			Iterator() = default;
+			Iterator(BufferType* gapBuffer, const std::size_t& index)
+				: gapBuffer(gapBuffer), index(index) {}
+			/// Conversion from non const iterator to const iterator
+			operator Iterator<true>() const { return Iterator<true>(gapBuffer, index); }
+			reference operator*() const { return (*gapBuffer)[index]; }
+			pointer operator->() const { return &(*gapBuffer)[index]; }
+			reference operator[](const difference_type& offset) const { return (*gapBuffer)[index + offset]; }
+			Iterator& operator++() { ++index; return *this; }
+			Iterator operator++(int) { Iterator result = *this; ++index; return result; }
+			Iterator& operator--() { --index; return *this; }
+			Iterator operator--(int) { Iterator result = *this; --index; return result; }
+			Iterator& operator+=(const difference_type& offset) { index += offset; return *this; }
+			Iterator& operator-=(const difference_type& offset) { index -= offset; return *this; }
+			Iterator operator+(const difference_type& offset) const { return Iterator(gapBuffer, index + offset); }
+			Iterator operator-(const difference_type& offset) const { return Iterator(gapBuffer, index - offset); }
+			friend Iterator operator+(const difference_type& offset, const Iterator& it) { return it + offset; }
+			difference_type operator-(const Iterator& other) const { return static_cast<difference_type>(index) - static_cast<difference_type>(other.index); }
+			bool operator==(const Iterator& other) const { return index == other.index; }
+			bool operator!=(const Iterator& other) const { return index != other.index; }
+			bool operator<(const Iterator& other) const { return index < other.index; }
+			bool operator>(const Iterator& other) const { return index > other.index; }
+			bool operator<=(const Iterator& other) const { return index <= other.index; }
+			bool operator>=(const Iterator& other) const { return index >= other.index; }
+			/// Returns the (logical) index this iterator points to
+			std::size_t getIndex() const { return index; }
+		};
+	public:
+		using value_type = T;
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+		/// Constructors
+		GapBuffer() = default;
+		GapBuffer(const std::size_t& count, const T& value = T())
+			: buffer(count, value), gapBegin(count), gapEnd(count) {}
+		GapBuffer(std::initializer_list<T> values)
+			: buffer(values), gapBegin(values.size()), gapEnd(values.size()) {}
+		/// Returns the number of elements
+		std::size_t size() const { return buffer.size() - gapSize(); }
+		/// Returns true if there are no elements
+		bool empty() const { return size() == 0; }
+		/// Returns the number of elements that can be stored without reallocating
+		std::size_t capacity() const { return buffer.size(); }
+		/// Element access. The index is not checked
+		T& operator[](const std::size_t& index) { return index < gapBegin ? buffer[index] : buffer[index + gapSize()]; }
+		const T& operator[](const std::size_t& index) const { return index < gapBegin ? buffer[index] : buffer[index + gapSize()]; }
+		T& front() { return (*this)[0]; }
+		const T& front() const { return (*this)[0]; }
+		T& back() { return (*this)[size() - 1]; }
+		const T& back() const { return (*this)[size() - 1]; }
+		/// Iterators
+		iterator begin() { return iterator(this, 0); }
+		iterator end() { return iterator(this, size()); }
+		const_iterator begin() const { return const_iterator(this, 0); }
+		const_iterator end() const { return const_iterator(this, size()); }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+		/// Removes all elements. Keeps the capacity
+		void clear() { gapBegin = 0; gapEnd = buffer.size(); }
+		/// Makes sure that at least capacity elements can be stored without reallocating
+		void reserve(const std::size_t& capacity) { if (capacity > size()) ensureGapSize(capacity - size()); }
+		/// Appends an element to the end
+		void push_back(const T& value) { insert(size(), value); }
+		/// Removes the last element
+		void pop_back() { erase(size() - 1, size()); }
+		/// Changes the number of elements. New elements are default constructed
+		void resize(const std::size_t& count);
+		/// Inserts a single element in front of the element at the given index
+		void insert(const std::size_t& index, const T& value);
+		/// Inserts the elements [first, last) in front of the element at the given index
+		template<typename InputIt>
+		void insert(const std::size_t& index, InputIt first, InputIt last);
+		/// Inserts count copies of value in front of the element at the given index
+		void insert(const std::size_t& index, const std::size_t& count, const T& value);
+		/// Erases the elements with indices in [beginIndex, endIndex)
+		void erase(const std::size_t& beginIndex, const std::size_t& endIndex);
+		/// Returns the elements as two contiguous ranges, the part before and the part after the gap.
+		/// Can be used for fast sequential iteration, e.g. when copying all elements
+		std::pair<const T*, std::size_t> getFirstSegment() const { return { buffer.data(), gapBegin }; }
+		std::pair<const T*, std::size_t> getSecondSegment() const { return { buffer.data() + gapEnd, buffer.size() - gapEnd }; }
+	};
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void GapBuffer<T>::moveGapTo(const std::size_t& index)
+	{
+		if (index == gapBegin) return;
+		if (gapSize() == 0) {
+			// Without a gap, moving it is just changing the position
+			gapBegin = gapEnd = index;
+			return;
+		}
+		if (index < gapBegin) {
+			// Move the elements in [index, gapBegin) to the end of the gap
+			const std::size_t count = gapBegin - index;
+			std::move_backward(buffer.begin() + index, buffer.begin() + gapBegin, buffer.begin() + gapEnd);
+			gapBegin -= count;
+			gapEnd -= count;
+		}
+		else {
+			// Move the elements after the gap to the beginning of the gap
+			const std::size_t count = index - gapBegin;
+			std::move(buffer.begin() + gapEnd, buffer.begin() + gapEnd + count, buffer.begin() + gapBegin);
+			gapBegin += count;
+			gapEnd += count;
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void GapBuffer<T>::ensureGapSize(const std::size_t& count)
+	{
+		if (gapSize() >= count) return;
+		// Grow geometrically, such that repeated insertions are amortized O(1)
+		const std::size_t elementCount = size();
+		const std::size_t newCapacity = std::max({ buffer.size() * 2, elementCount + count, std::size_t(16) });
+		std::vector<T> newBuffer(newCapacity);
+		const std::size_t newGapEnd = newCapacity - (buffer.size() - gapEnd);
+		std::move(buffer.begin(), buffer.begin() + gapBegin, newBuffer.begin());
+		std::move(buffer.begin() + gapEnd, buffer.end(), newBuffer.begin() + newGapEnd);
+		buffer = std::move(newBuffer);
+		gapEnd = newGapEnd;
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void GapBuffer<T>::resize(const std::size_t& count)
+	{
+		const std::size_t elementCount = size();
+		if (count < elementCount) erase(count, elementCount);
+		else if (count > elementCount) insert(elementCount, count - elementCount, T());
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void GapBuffer<T>::insert(const std::size_t& index, const T& value)
+	{
+		ensureGapSize(1);
+		moveGapTo(index);
+		buffer[gapBegin++] = value;
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	template<typename InputIt>
+	inline void GapBuffer<T>::insert(const std::size_t& index, InputIt first, InputIt last)
+	{
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+			// The number of elements is known, reserve the space once
+			const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+			ensureGapSize(count);
+			moveGapTo(index);
+			std::copy(first, last, buffer.begin() + gapBegin);
+			gapBegin += count;
+		}
+		else {
+			std::size_t position = index;
+			for (; first != last; ++first) insert(position++, *first);
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void GapBuffer<T>::insert(const std::size_t& index, const std::size_t& count, const T& value)
+	{
+		ensureGapSize(count);
+		moveGapTo(index);
+		std::fill(buffer.begin() + gapBegin, buffer.begin() + gapBegin + count, value);
+		gapBegin += count;
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void GapBuffer<T>::erase(const std::size_t& beginIndex, const std::size_t& endIndex)
+	{
+		if (beginIndex >= endIndex) return;
+		// Erasing is just growing the gap over the erased elements
+		moveGapTo(beginIndex);
+		gapEnd += endIndex - beginIndex;
+	}
+	//------------------------------------------------------------------------------------------------------
+}
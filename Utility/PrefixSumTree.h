@@ -0,0 +1,121 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace SnackerEngine
+{
+	//------------------------------------------------------------------------------------------------------
+	/// A prefix sum tree (also called Fenwick tree or binary indexed tree) stores a sequence of values and
+	/// can compute the sum of the first n values, change a single value and append values in O(log n).
+	/// Can also find the element containing a given position in O(log n) if all values are non-negative,
+	/// which makes it useful for virtualized layouts (eg. finding the line or list element at a given
+	/// height, where each value is the height of one element).
+	template<typename T>
+	class PrefixSumTree
+	{
+	private:
+		/// The values
+		std::vector<T> values{};
+		/// The tree. tree[i - 1] stores the sum of the values in (i - lowestBit(i), i]
+		std::vector<T> tree{};
+		/// Returns the lowest set bit of the given index
+		static std::size_t lowestBit(const std::size_t& index) { return index & (~index + 1); }
+	public:
+		/// Default constructor
+		PrefixSumTree() = default;
+		/// Constructs the tree from the given values in O(n)
+		explicit PrefixSumTree(const std::vector<T>& values) { assign(values); }
+		/// Replaces all values in O(n)
+		void assign(const std::vector<T>& values);
+		/// Appends a value in O(log n)
+		void push_back(const T& value);
+		/// Removes all values after the first count values
+		void truncate(const std::size_t& count);
+		/// Removes all values
+		void clear() { values.clear(); tree.clear(); }
+		/// Sets the value with the given index in O(log n)
+		void set(const std::size_t& index, const T& value) { add(index, value - values[index]); }
+		/// Adds delta to the value with the given index in O(log n)
+		void add(const std::size_t& index, const T& delta);
+		/// Returns the value with the given index
+		const T& operator[](const std::size_t& index) const { return values[index]; }
+		/// Returns the number of values
+		std::size_t size() const { return values.size(); }
+		bool empty() const { return values.empty(); }
+		/// Returns the sum of the first count values in O(log n)
+		T prefixSum(std::size_t count) const;
+		/// Returns the sum of all values in O(log n)
+		T total() const { return prefixSum(values.size()); }
+		/// Returns the index of the value containing the given position, ie. the largest index with
+		/// prefixSum(index) <= position. Returns size() if position >= total(). All values have to be
+		/// non-negative. Runs in O(log n)
+		std::size_t find(const T& position) const;
+	};
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void PrefixSumTree<T>::assign(const std::vector<T>& values)
+	{
+		this->values = values;
+		tree = values;
+		for (std::size_t i = 1; i <= tree.size(); ++i) {
+			const std::size_t parent = i + lowestBit(i);
+			if (parent <= tree.size()) tree[parent - 1] += tree[i - 1];
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void PrefixSumTree<T>::push_back(const T& value)
+	{
+		const std::size_t i = values.size() + 1;
+		values.push_back(value);
+		// The new node stores the sum of (i - lowestBit(i), i]
+		tree.push_back(value + prefixSum(i - 1) - prefixSum(i - lowestBit(i)));
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void PrefixSumTree<T>::truncate(const std::size_t& count)
+	{
+		// Nodes only depend on values before them, so removing the last nodes keeps the tree valid
+		if (count >= values.size()) return;
+		values.resize(count);
+		tree.resize(count);
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline void PrefixSumTree<T>::add(const std::size_t& index, const T& delta)
+	{
+		values[index] += delta;
+		for (std::size_t i = index + 1; i <= tree.size(); i += lowestBit(i)) {
+			tree[i - 1] += delta;
+		}
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline T PrefixSumTree<T>::prefixSum(std::size_t count) const
+	{
+		T sum{};
+		for (; count > 0; count -= lowestBit(count)) {
+			sum += tree[count - 1];
+		}
+		return sum;
+	}
+	//------------------------------------------------------------------------------------------------------
+	template<typename T>
+	inline std::size_t PrefixSumTree<T>::find(const T& position) const
+	{
+		// Descend the implicit tree, from the largest power of two downwards
+		std::size_t step = 1;
+		while (step * 2 <= tree.size()) step *= 2;
+		std::size_t index = 0;
+		T remaining = position;
+		for (; step > 0; step /= 2) {
+			if (index + step <= tree.size() && !(remaining < tree[index + step - 1])) {
+				index += step;
+				remaining -= tree[index - 1];
+			}
+		}
+		return index;
+	}
+	//------------------------------------------------------------------------------------------------------
+}